@@ -8,6 +8,7 @@
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
@@ -98,13 +99,21 @@ int process(std::string const& name, std::string const& executableName, std::fun
     // Set output precision
     storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resourceSettings.isProfileJsonSet()) {
+        storm::utility::Profiler::getInstance().enable();
+    }
+
     // Process options and start computations
     processOptionsFunc();
 
     totalTimer.stop();
-    if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
+    if (resourceSettings.isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
     }
+    if (resourceSettings.isProfileJsonSet()) {
+        storm::utility::Profiler::getInstance().exportToJson(resourceSettings.getProfileJsonFilename());
+    }
 
     // All operations have been performed, so we clean up everything and terminate.
     storm::utility::cleanUp();
@@ -11,6 +11,7 @@
 #include "storm/utility/AutomaticSettings.h"
 #include "storm/utility/Engine.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 
@@ -70,6 +71,7 @@ struct SymbolicInput {
 inline void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input) {
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
     if (ioSettings.isPrismOrJaniInputSet()) {
+        storm::utility::ProfilingScope profilingScope("parsing");
         storm::utility::Stopwatch modelParsingWatch(true);
         if (ioSettings.isPrismInputSet()) {
             input.model =
@@ -91,6 +93,9 @@ inline void parseSymbolicModelDescription(storm::settings::modules::IOSettings c
                 input.properties = std::move(janiInput.second);
             }
         }
+        if (buildSettings.isExpressionHashConsingSet()) {
+            input.model->getManager().setHashConsing(true);
+        }
         modelParsingWatch.stop();
         STORM_PRINT("Time for model input parsing: " << modelParsingWatch << ".\n\n");
     }
@@ -116,6 +121,7 @@ inline SymbolicInput parseSymbolicInputQvbs(storm::settings::modules::IOSettings
     storm::storage::QvbsBenchmark benchmark(ioSettings.getQvbsModelName());
     STORM_PRINT_AND_LOG(benchmark.getInfo(ioSettings.getQvbsInstanceIndex(), ioSettings.getQvbsPropertyFilter()));
     storm::utility::Stopwatch modelParsingWatch(true);
+    storm::utility::ProfilingScope profilingScope("parsing");
     auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(ioSettings.getQvbsInstanceIndex()), ioSettings.getQvbsPropertyFilter());
     input.model = std::move(janiInput.first);
     input.properties = std::move(janiInput.second);
@@ -518,6 +524,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
 template<storm::dd::DdType DdType, typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings,
                                                      ModelProcessingInformation const& mpi) {
+    storm::utility::ProfilingScope profilingScope("building");
     storm::utility::Stopwatch modelBuildingWatch(true);
 
     std::shared_ptr<storm::models::ModelBase> result;
@@ -664,37 +671,41 @@ template<storm::dd::DdType DdType, typename ValueType>
 void exportDdModel(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueType>> const& model, SymbolicInput const&) {
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
 
-    if (ioSettings.isExportBuildSet()) {
-        switch (ioSettings.getExportBuildFormat()) {
-            case storm::exporter::ModelExportFormat::Dot:
-                storm::api::exportSymbolicModelAsDot(model, ioSettings.getExportBuildFilename());
-                break;
-            case storm::exporter::ModelExportFormat::Drdd:
-                storm::api::exportSymbolicModelAsDrdd(model, ioSettings.getExportBuildFilename());
-                break;
-            default:
-                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
-                                "Exporting symbolic models in " << storm::exporter::toString(ioSettings.getExportBuildFormat()) << " format is not supported.");
+    model->getManager().execute([&]() {
+        if (ioSettings.isExportBuildSet()) {
+            switch (ioSettings.getExportBuildFormat()) {
+                case storm::exporter::ModelExportFormat::Dot:
+                    storm::api::exportSymbolicModelAsDot(model, ioSettings.getExportBuildFilename());
+                    break;
+                case storm::exporter::ModelExportFormat::Drdd:
+                    storm::api::exportSymbolicModelAsDrdd(model, ioSettings.getExportBuildFilename());
+                    break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                                    "Exporting symbolic models in " << storm::exporter::toString(ioSettings.getExportBuildFormat())
+                                                                    << " format is not supported.");
+            }
         }
-    }
 
-    // TODO: The following options are depreciated and shall be removed at some point:
+        // TODO: The following options are depreciated and shall be removed at some point:
 
-    if (ioSettings.isExportExplicitSet()) {
-        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in drn format is only supported for sparse models.");
-    }
+        if (ioSettings.isExportExplicitSet()) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in drn format is only supported for sparse models.");
+        }
 
-    if (ioSettings.isExportDdSet()) {
-        storm::api::exportSymbolicModelAsDrdd(model, ioSettings.getExportDdFilename());
-    }
+        if (ioSettings.isExportDdSet()) {
+            storm::api::exportSymbolicModelAsDrdd(model, ioSettings.getExportDdFilename());
+        }
 
-    if (ioSettings.isExportDotSet()) {
-        storm::api::exportSymbolicModelAsDot(model, ioSettings.getExportDotFilename());
-    }
+        if (ioSettings.isExportDotSet()) {
+            storm::api::exportSymbolicModelAsDot(model, ioSettings.getExportDotFilename());
+        }
+    });
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
 void exportModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+    storm::utility::ProfilingScope profilingScope("export");
     if (model->isSparseModel()) {
         exportSparseModel<ValueType>(model->as<storm::models::sparse::Model<ValueType>>(), input);
     } else {
@@ -779,6 +790,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
 template<storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
 std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input,
                                                                            ModelProcessingInformation const& mpi) {
+    storm::utility::ProfilingScope profilingScope("preprocessing");
     storm::utility::Stopwatch preprocessingWatch(true);
 
     std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -981,6 +993,7 @@ template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> verifyProperty(std::shared_ptr<storm::logic::Formula const> const& formula,
                                                                  std::shared_ptr<storm::logic::Formula const> const& statesFilter,
                                                                  VerificationCallbackType const& verificationCallback) {
+    storm::utility::ProfilingScope profilingScope("model checking");
     auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
 
     try {
@@ -1045,6 +1058,7 @@ void computeStateValues(std::string const& description, std::function<std::uniqu
     STORM_PRINT("\nComputing " << description << " ...\n");
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     try {
+        storm::utility::ProfilingScope profilingScope("model checking");
         result = computationCallback();
     } catch (storm::exceptions::BaseException const& ex) {
         STORM_LOG_ERROR("Cannot compute " << description << ": " << ex.what());
@@ -1274,51 +1288,57 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
 
 template<storm::dd::DdType DdType, typename ValueType>
 void verifyWithHybridEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
-    verifyProperties<ValueType>(
-        input, [&model, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
-            bool filterForInitialStates = states->isInitialFormula();
-            auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-
-            auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
-            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithHybridEngine<DdType, ValueType>(mpi.env, symbolicModel, task);
-
-            std::unique_ptr<storm::modelchecker::CheckResult> filter;
-            if (filterForInitialStates) {
-                filter = std::make_unique<storm::modelchecker::SymbolicQualitativeCheckResult<DdType>>(symbolicModel->getReachableStates(),
-                                                                                                       symbolicModel->getInitialStates());
-            } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
-                filter = storm::api::verifyWithHybridEngine<DdType, ValueType>(mpi.env, symbolicModel, storm::api::createTask<ValueType>(states, false));
-            }
-            if (result && filter) {
-                result->filter(filter->asQualitativeCheckResult());
-            }
-            return result;
-        });
+    // Run the verification together with the filtering and the output of the (symbolic) results as one task of the DD library.
+    model->as<storm::models::symbolic::Model<DdType, ValueType>>()->getManager().execute([&]() {
+        verifyProperties<ValueType>(
+            input, [&model, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                bool filterForInitialStates = states->isInitialFormula();
+                auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+
+                auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
+                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithHybridEngine<DdType, ValueType>(mpi.env, symbolicModel, task);
+
+                std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                if (filterForInitialStates) {
+                    filter = std::make_unique<storm::modelchecker::SymbolicQualitativeCheckResult<DdType>>(symbolicModel->getReachableStates(),
+                                                                                                           symbolicModel->getInitialStates());
+                } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
+                    filter = storm::api::verifyWithHybridEngine<DdType, ValueType>(mpi.env, symbolicModel, storm::api::createTask<ValueType>(states, false));
+                }
+                if (result && filter) {
+                    result->filter(filter->asQualitativeCheckResult());
+                }
+                return result;
+            });
+    });
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
 void verifyWithDdEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
-    verifyProperties<ValueType>(
-        input, [&model, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
-            bool filterForInitialStates = states->isInitialFormula();
-            auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-
-            auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
-            std::unique_ptr<storm::modelchecker::CheckResult> result =
-                storm::api::verifyWithDdEngine<DdType, ValueType>(mpi.env, symbolicModel, storm::api::createTask<ValueType>(formula, true));
-
-            std::unique_ptr<storm::modelchecker::CheckResult> filter;
-            if (filterForInitialStates) {
-                filter = std::make_unique<storm::modelchecker::SymbolicQualitativeCheckResult<DdType>>(symbolicModel->getReachableStates(),
-                                                                                                       symbolicModel->getInitialStates());
-            } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
-                filter = storm::api::verifyWithDdEngine<DdType, ValueType>(mpi.env, symbolicModel, storm::api::createTask<ValueType>(states, false));
-            }
-            if (result && filter) {
-                result->filter(filter->asQualitativeCheckResult());
-            }
-            return result;
-        });
+    // Run the verification together with the filtering and the output of the (symbolic) results as one task of the DD library.
+    model->as<storm::models::symbolic::Model<DdType, ValueType>>()->getManager().execute([&]() {
+        verifyProperties<ValueType>(
+            input, [&model, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                bool filterForInitialStates = states->isInitialFormula();
+                auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+
+                auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
+                std::unique_ptr<storm::modelchecker::CheckResult> result =
+                    storm::api::verifyWithDdEngine<DdType, ValueType>(mpi.env, symbolicModel, storm::api::createTask<ValueType>(formula, true));
+
+                std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                if (filterForInitialStates) {
+                    filter = std::make_unique<storm::modelchecker::SymbolicQualitativeCheckResult<DdType>>(symbolicModel->getReachableStates(),
+                                                                                                           symbolicModel->getInitialStates());
+                } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
+                    filter = storm::api::verifyWithDdEngine<DdType, ValueType>(mpi.env, symbolicModel, storm::api::createTask<ValueType>(states, false));
+                }
+                if (result && filter) {
+                    result->filter(filter->asQualitativeCheckResult());
+                }
+                return result;
+            });
+    });
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
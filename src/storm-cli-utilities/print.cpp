@@ -1,6 +1,7 @@
 #include "print.h"
 
 #include "storm-version-info/storm-version.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/cli.h"
 #include "storm/utility/macros.h"
 
@@ -145,14 +146,8 @@ void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds) {
     getrusage(RUSAGE_SELF, &ru);
 
     std::cout << "\nPerformance statistics:\n";
-#ifdef MACOS
-    // For Mac OS, this is returned in bytes.
-    uint64_t maximumResidentSizeInMegabytes = ru.ru_maxrss / 1024 / 1024;
-#endif
-#ifdef LINUX
-    // For Linux, this is returned in kilobytes.
-    uint64_t maximumResidentSizeInMegabytes = ru.ru_maxrss / 1024;
-#endif
+    // The profiler may reset the peak reported by the operating system, so we ask it for the peak.
+    uint64_t maximumResidentSizeInMegabytes = storm::utility::Profiler::getPeakResidentSetSize() / 1024 / 1024;
     std::cout << "  * peak memory usage: " << maximumResidentSizeInMegabytes << "MB\n";
     char oldFillChar = std::cout.fill('0');
     std::cout << "  * CPU time: " << ru.ru_utime.tv_sec << "." << std::setw(3) << ru.ru_utime.tv_usec / 1000 << "s\n";
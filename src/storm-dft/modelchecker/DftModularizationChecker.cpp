@@ -1,14 +1,20 @@
 #include "DftModularizationChecker.h"
 
+#include <algorithm>
 #include <sstream>
 
+#include <boost/functional/hash.hpp>
+
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/DFTBuilder.h"
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
 #include "storm-dft/utility/DftModularizer.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
@@ -18,7 +24,7 @@ namespace modelchecker {
 
 template<typename ValueType>
 DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+    : dft{dft}, sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -26,6 +32,7 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
 
     // Gather all dynamic modules
     populateDynamicModules(topModule);
+    groupIsomorphicModules();
 }
 
 template<typename ValueType>
@@ -41,6 +48,127 @@ void DftModularizationChecker<ValueType>::populateDynamicModules(storm::dft::sto
     }
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::groupIsomorphicModules() {
+    storm::dft::storage::DFTColouring<ValueType> colouring(*dft);
+    std::vector<storm::dft::storage::BijectionCandidates<ValueType>> moduleColours;
+    // Map from hash of the module colouring to the modules which are analysed
+    std::unordered_map<size_t, std::vector<size_t>> hashedModules;
+
+    analysedModules.clear();
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        std::set<size_t> elements = dynamicModules[i].getAllElements();
+        moduleColours.push_back(colouring.colourSubdft(std::vector<size_t>(elements.begin(), elements.end())));
+        auto const& colours = moduleColours.back();
+
+        // The hash is independent of the order of the elements
+        size_t hash = 0;
+        for (auto const& gateColour : colours.gateCandidates) {
+            size_t colourHash = 0;
+            boost::hash_combine(colourHash, gateColour.first);
+            boost::hash_combine(colourHash, gateColour.second.size());
+            hash += colourHash;
+        }
+        for (auto const& beColour : colours.beCandidates) {
+            size_t colourHash = 0;
+            boost::hash_combine(colourHash, std::hash<storm::dft::storage::BEColourClass<ValueType>>()(beColour.first));
+            boost::hash_combine(colourHash, beColour.second.size());
+            hash += colourHash;
+        }
+        boost::hash_combine(hash, colours.nrDeps());
+        boost::hash_combine(hash, colours.nrRestrictions());
+
+        size_t representative = dynamicModules[i].getRepresentative();
+        auto& candidates = hashedModules[hash];
+        auto isomorphicIt = std::find_if(candidates.begin(), candidates.end(), [&](size_t j) {
+            storm::dft::storage::DFTIsomorphismCheck<ValueType> isoCheck(colours, moduleColours[j], *dft);
+            while (isoCheck.findNextIsomorphism()) {
+                auto const& bijection = isoCheck.getIsomorphism();
+                if (bijection.at(representative) == dynamicModules[j].getRepresentative() && isStructurePreserving(bijection)) {
+                    return true;
+                }
+            }
+            return false;
+        });
+        if (isomorphicIt != candidates.end()) {
+            STORM_LOG_DEBUG("Dynamic module " << dft->getElement(representative)->name() << " is isomorphic to module "
+                                              << dft->getElement(dynamicModules[*isomorphicIt].getRepresentative())->name() << ".");
+            analysedModules.push_back(*isomorphicIt);
+        } else {
+            candidates.push_back(i);
+            analysedModules.push_back(i);
+        }
+    }
+}
+
+template<typename ValueType>
+bool DftModularizationChecker<ValueType>::isStructurePreserving(std::map<size_t, size_t> const& bijection) const {
+    auto mapIds = [&bijection](auto const& elements) {
+        std::vector<size_t> ids;
+        for (auto const& element : elements) {
+            auto it = bijection.find(element->id());
+            if (it == bijection.end()) {
+                return std::vector<size_t>();
+            }
+            ids.push_back(it->second);
+        }
+        return ids;
+    };
+    auto getIds = [](auto const& elements) {
+        std::vector<size_t> ids;
+        for (auto const& element : elements) {
+            ids.push_back(element->id());
+        }
+        return ids;
+    };
+
+    for (auto const& [leftId, rightId] : bijection) {
+        std::vector<size_t> mapped;
+        std::vector<size_t> target;
+        bool ordered = true;
+        if (dft->isGate(leftId)) {
+            auto const& leftGate = dft->getGate(leftId);
+            mapped = mapIds(leftGate->children());
+            target = getIds(dft->getGate(rightId)->children());
+            ordered = !leftGate->isStaticElement();
+        } else if (dft->isRestriction(leftId)) {
+            mapped = mapIds(dft->getRestriction(leftId)->children());
+            target = getIds(dft->getRestriction(rightId)->children());
+        } else if (dft->isDependency(leftId)) {
+            auto const& leftDep = dft->getDependency(leftId);
+            auto const& rightDep = dft->getDependency(rightId);
+            auto triggerIt = bijection.find(leftDep->triggerEvent()->id());
+            if (triggerIt == bijection.end() || triggerIt->second != rightDep->triggerEvent()->id()) {
+                return false;
+            }
+            mapped = mapIds(leftDep->dependentEvents());
+            target = getIds(rightDep->dependentEvents());
+            ordered = false;
+        } else {
+            continue;
+        }
+        if (!ordered) {
+            std::sort(mapped.begin(), mapped.end());
+            std::sort(target.begin(), target.end());
+        }
+        if (mapped != target) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+size_t DftModularizationChecker<ValueType>::getNumberOfAnalysedDynamicModules() const {
+    size_t count = 0;
+    for (size_t i = 0; i < analysedModules.size(); ++i) {
+        if (analysedModules[i] == i) {
+            ++count;
+        }
+    }
+    return count;
+}
+
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector const& formulas, size_t chunksize) {
     // Gather time points
@@ -53,15 +181,24 @@ std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector
 
     auto newDft = replaceDynamicModules(timepoints);
 
-    storm::dft::adapters::SFTBDDPropertyFormulaAdapter checker{newDft, formulas, {}, sylvanBddManager};
-    return checker.check(chunksize);
+    // Only the analysis of the static fault tree works on BDDs, the dynamic modules are analysed without waking up the sylvan workers.
+    std::vector<ValueType> result;
+    sylvanBddManager->execute([&]() {
+        storm::dft::adapters::SFTBDDPropertyFormulaAdapter checker{newDft, formulas, {}, sylvanBddManager};
+        result = checker.check(chunksize);
+    });
+    return result;
 }
 
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::getProbabilitiesAtTimepoints(std::vector<ValueType> const& timepoints, size_t chunksize) {
     auto newDft = replaceDynamicModules(timepoints);
-    storm::dft::modelchecker::SFTBDDChecker checker{newDft, sylvanBddManager};
-    return checker.getProbabilitiesAtTimepoints(timepoints, chunksize);
+    std::vector<ValueType> result;
+    sylvanBddManager->execute([&]() {
+        storm::dft::modelchecker::SFTBDDChecker checker{newDft, sylvanBddManager};
+        result = checker.getProbabilitiesAtTimepoints(timepoints, chunksize);
+    });
+    return result;
 }
 
 template<typename ValueType>
@@ -69,18 +206,36 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
 
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+    // First analyse all dynamic modules which are not isomorphic to a previous one
+    std::vector<size_t> modulesToAnalyse;
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        if (analysedModules[i] == i) {
+            modulesToAnalyse.push_back(i);
+        }
+    }
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> results(dynamicModules.size());
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, modulesToAnalyse.size()), [&](tbb::blocked_range<size_t> const& range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            results[modulesToAnalyse[i]] = analyseDynamicModule(dynamicModules[modulesToAnalyse[i]], timepoints);
+        }
+    });
+#else
+    for (size_t i : modulesToAnalyse) {
+        results[i] = analyseDynamicModule(dynamicModules[i], timepoints);
+    }
+#endif
+
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        auto const& result = results[analysedModules[i]];
         // Remember probabilities for module
         std::map<ValueType, ValueType> activeSamples{};
-        for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
-            auto const timebound{timepoints[i]};
+        for (size_t j{0}; j < timepoints.size(); ++j) {
+            auto const probability{boost::get<ValueType>(result[j])};
+            auto const timebound{timepoints[j]};
             activeSamples[timebound] = probability;
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        samplePoints.insert({dynamicModules[i].getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -127,6 +282,7 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftMo
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
 
+    STORM_LOG_DEBUG("Analyse dynamic module " << module.toString(*dft));
     auto subDft = module.getSubtree(*dft);
 
     // Create properties
@@ -136,7 +292,9 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftMo
     }
     auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
 
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    // Use a separate model checker for each module as modules might be analysed concurrently
+    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker(false);
+    return modelchecker.check(subDft, props, false, false, {});
 }
 
 // Explicitly instantiate the class.
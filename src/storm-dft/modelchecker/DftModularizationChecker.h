@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -16,6 +17,7 @@ namespace modelchecker {
  * DFT analysis via modularization.
  * Dynamic modules are analyzed via model checking and replaced by a single BE capturing the probabilities of the module.
  * The resulting (static) fault tree is then analyzed via BDDs.
+ * Isomorphic dynamic modules are only analyzed once. If Storm is built with Intel TBB, the dynamic modules are analyzed concurrently.
  *
  * @note All public functions must make sure that workDFT is set correctly and should assume workDFT to be in an erroneous state.
  */
@@ -58,6 +60,21 @@ class DftModularizationChecker {
         return getProbabilitiesAtTimepoints({timebound}).at(0);
     }
 
+    /*!
+     * Get the number of dynamic modules.
+     * @return Number of dynamic modules.
+     */
+    size_t getNumberOfDynamicModules() const {
+        return dynamicModules.size();
+    }
+
+    /*!
+     * Get the number of dynamic modules which are analysed via model checking.
+     * Dynamic modules which are isomorphic to a previous one are not analysed.
+     * @return Number of analysed dynamic modules.
+     */
+    size_t getNumberOfAnalysedDynamicModules() const;
+
    private:
     /*!
      * Recursively populate the list of dynamic modules.
@@ -65,6 +82,20 @@ class DftModularizationChecker {
      */
     void populateDynamicModules(storm::dft::storage::DftIndependentModule const &module);
 
+    /*!
+     * Detect isomorphic dynamic modules such that each class of isomorphic modules only needs to be analysed once.
+     * Candidates are found by hashing the colouring of the module elements and confirmed via an isomorphism check.
+     */
+    void groupIsomorphicModules();
+
+    /*!
+     * Check whether the given bijection between the elements of two modules preserves the DFT structure,
+     * i.e., children of gates and restrictions as well as triggers and dependent events of dependencies are mapped accordingly.
+     * @param bijection Bijection between the element ids of two modules.
+     * @return True iff the bijection is an isomorphism.
+     */
+    bool isStructurePreserving(std::map<size_t, size_t> const &bijection) const;
+
     /*!
      * Calculate results for dynamic modules and replace them with BE's in workDFT.
      * @param timepoints Time points for which the failure probability should be computed.
@@ -82,13 +113,13 @@ class DftModularizationChecker {
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
-    // DFT modelchecker
-    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker;
     // don't reinitialize Sylvan BDD
     // temporary
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // For each dynamic module, the index of the isomorphic dynamic module whose analysis result is used
+    std::vector<size_t> analysedModules;
 };
 
 }  // namespace modelchecker
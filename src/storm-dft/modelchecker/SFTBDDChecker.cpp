@@ -1,11 +1,15 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/eigen.h"
+#include "storm/utility/macros.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -114,127 +118,116 @@ ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, s
 }
 
 /**
- * \returns
- * The probabilities that the bdd is true
- * given the probabilities that the variables are true.
- *
- * \param chunksize
- * The width of the Eigen Arrays
- *
- * \param bdd
- * The bdd for which to calculate the probabilities
- *
- * \param indexToProbabilities
- * A reference to a mapping
- * that must map every variable in the bdd to probabilities
- *
- * \param bddToProbabilities
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \note
- * Great care was made that all pointers
- * are valid elements in bddToProbabilities.
- *
+ * A Bdd linearized into an array of nodes in topological order,
+ * i.e., the children of a node are always stored before the node itself.
+ * Evaluating the nodes in this order replaces the recursive traversal
+ * of the Bdd (and the lookups in a cache) by a single sweep over the array.
+ * The values of all nodes are Eigen Arrays with one entry per time point.
  */
-Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                             std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToProbabilities.find(bddId)};
-    if (it != bddToProbabilities.end() && it->second.first) {
-        return &it->second.second;
+class LinearizedBdd {
+   public:
+    struct Node {
+        uint32_t variable;
+        size_t thenIndex;
+        size_t elseIndex;
+    };
+
+    static constexpr size_t zeroIndex{0};
+    static constexpr size_t oneIndex{1};
+
+    explicit LinearizedBdd(Bdd const bdd) {
+        // The terminal nodes
+        nodes.push_back({0, zeroIndex, zeroIndex});
+        nodes.push_back({0, oneIndex, oneIndex});
+        std::unordered_map<uint64_t, size_t> bddToIndex{};
+        rootIndex = linearize(bdd, bddToIndex);
     }
 
-    auto &bddToProbabilitiesElement{bddToProbabilities[bddId]};
-    if (bdd.isOne()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 1);
-        return &bddToProbabilitiesElement.second;
-    } else if (bdd.isZero()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToProbabilitiesElement.second;
+    size_t getRootIndex() const noexcept {
+        return rootIndex;
     }
 
-    auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-    auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
-
-    // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
-    bddToProbabilitiesElement.first = true;
-    bddToProbabilitiesElement.second = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
-    return &bddToProbabilitiesElement.second;
-}
-
-/**
- * \returns
- * The birnbaum importance factors of the given variable
- *
- * \param chunksize
- * The width of the Eigen Arrays
- *
- * \param bdd
- * The bdd for which to calculate the factors
- *
- * \param variableIndex
- * The index of the variable the birnbaum factors should be calculated
- *
- * \param indexToProbability
- * A reference to a mapping
- * that must map every variable in the bdd to a probabilities
- *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \param bddToBirnbaumFactor
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- */
-Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, Bdd const bdd,
-                                               std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToBirnbaumFactors) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToBirnbaumFactors.find(bddId)};
-    if (it != bddToBirnbaumFactors.end() && it->second.first) {
-        return &it->second.second;
+    /**
+     * \returns
+     * The probabilities that the sub bdds are true, indexed by node.
+     * Computed in a single bottom-up sweep.
+     *
+     * \param chunksize
+     * The width of the Eigen Arrays
+     *
+     * \param variableProbabilities
+     * The probabilities that the variables are true, indexed by variable.
+     */
+    std::vector<Eigen::ArrayXd> getProbabilities(size_t const chunksize, std::vector<Eigen::ArrayXd> const &variableProbabilities) const {
+        std::vector<Eigen::ArrayXd> probabilities(nodes.size());
+        probabilities[zeroIndex] = Eigen::ArrayXd::Constant(chunksize, 0);
+        probabilities[oneIndex] = Eigen::ArrayXd::Constant(chunksize, 1);
+        for (size_t i{2}; i < nodes.size(); ++i) {
+            auto const &node{nodes[i]};
+            STORM_LOG_ASSERT(node.variable < variableProbabilities.size(), "No probability given for variable " << node.variable << ".");
+            auto const &currentProbabilities{variableProbabilities[node.variable]};
+            // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+            probabilities[i] = currentProbabilities * probabilities[node.thenIndex] + (1 - currentProbabilities) * probabilities[node.elseIndex];
+        }
+        return probabilities;
     }
 
-    auto &bddToBirnbaumFactorsElement{bddToBirnbaumFactors[bddId]};
-    if (bdd.isTerminal() || bdd.TopVar() > variableIndex) {
-        // return vector 0;
-        bddToBirnbaumFactorsElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToBirnbaumFactorsElement.second;
+    /**
+     * \returns
+     * The birnbaum importance factors of all variables, indexed by variable.
+     * The birnbaum factor of a variable is the partial derivative
+     * of the probability of the root with respect to the probability of the variable.
+     * It is computed for all variables at once in a single top-down sweep
+     * propagating the partial derivatives w.r.t. the probabilities of the nodes.
+     *
+     * \param chunksize
+     * The width of the Eigen Arrays
+     *
+     * \param variableProbabilities
+     * The probabilities that the variables are true, indexed by variable.
+     *
+     * \param probabilities
+     * The probabilities of the nodes as returned by getProbabilities.
+     */
+    std::vector<Eigen::ArrayXd> getBirnbaumFactors(size_t const chunksize, std::vector<Eigen::ArrayXd> const &variableProbabilities,
+                                                   std::vector<Eigen::ArrayXd> const &probabilities) const {
+        std::vector<Eigen::ArrayXd> birnbaumFactors(variableProbabilities.size(), Eigen::ArrayXd::Zero(chunksize));
+        std::vector<Eigen::ArrayXd> derivatives(nodes.size(), Eigen::ArrayXd::Zero(chunksize));
+        derivatives[rootIndex] = Eigen::ArrayXd::Ones(chunksize);
+        for (size_t i{nodes.size() - 1}; i >= 2; --i) {
+            auto const &node{nodes[i]};
+            auto const &derivative{derivatives[i]};
+            auto const &currentProbabilities{variableProbabilities[node.variable]};
+            birnbaumFactors[node.variable] += derivative * (probabilities[node.thenIndex] - probabilities[node.elseIndex]);
+            derivatives[node.thenIndex] += derivative * currentProbabilities;
+            derivatives[node.elseIndex] += derivative * (1 - currentProbabilities);
+        }
+        return birnbaumFactors;
     }
 
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+   private:
+    size_t linearize(Bdd const bdd, std::unordered_map<uint64_t, size_t> &bddToIndex) {
+        if (bdd.isOne()) {
+            return oneIndex;
+        } else if (bdd.isZero()) {
+            return zeroIndex;
+        }
 
-    if (currentVar == variableIndex) {
-        auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-        auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
+        auto const it{bddToIndex.find(bdd.GetBDD())};
+        if (it != bddToIndex.end()) {
+            return it->second;
+        }
 
-        bddToBirnbaumFactorsElement.first = true;
-        bddToBirnbaumFactorsElement.second = thenProbabilities - elseProbabilities;
-        return &bddToBirnbaumFactorsElement.second;
+        auto const thenIndex{linearize(bdd.Then(), bddToIndex)};
+        auto const elseIndex{linearize(bdd.Else(), bddToIndex)};
+        nodes.push_back({static_cast<uint32_t>(bdd.TopVar()), thenIndex, elseIndex});
+        bddToIndex[bdd.GetBDD()] = nodes.size() - 1;
+        return nodes.size() - 1;
     }
 
-    // currentVar < variableIndex
-    auto const &thenBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Then(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-    auto const &elseBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Else(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-    bddToBirnbaumFactorsElement.first = true;
-    bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
-    return &bddToBirnbaumFactorsElement.second;
-}
+    std::vector<Node> nodes;
+    size_t rootIndex;
+};
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
@@ -276,7 +269,9 @@ std::vector<std::vector<std::string>> SFTBDDChecker::getMinimalCutSets() {
 }
 
 std::vector<std::vector<uint32_t>> SFTBDDChecker::getMinimalCutSetsAsIndices() {
-    auto const bdd{getTopLevelElementBdd().Minsol()};
+    auto const topLevelElementBdd{getTopLevelElementBdd()};
+    Bdd bdd;
+    getSylvanBddManager()->execute([&]() { bdd = topLevelElementBdd.Minsol(); });
 
     std::vector<std::vector<uint32_t>> mcs{};
     std::vector<uint32_t> buffer{};
@@ -287,32 +282,37 @@ std::vector<std::vector<uint32_t>> SFTBDDChecker::getMinimalCutSetsAsIndices() {
 
 template<typename FuncType>
 void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const {
+    if (timepoints.empty()) {
+        return;
+    }
     if (chunksize == 0) {
         chunksize = timepoints.size();
     }
 
-    // caches
+    // Gather the variable indices of the basic elements once
     auto const basicElements{getDFT()->getBasicElements()};
-    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+    std::vector<uint32_t> basicElementIndices{};
+    basicElementIndices.reserve(basicElements.size());
+    uint32_t nrVariables{0};
+    for (auto const &be : basicElements) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+        nrVariables = std::max(nrVariables, basicElementIndices.back() + 1);
+    }
 
-    // The current timepoints we calculate with
-    Eigen::ArrayXd timepointsArray{chunksize};
+    auto calculateChunk = [&](size_t const chunkIndex) {
+        size_t const chunkStart{chunkIndex * chunksize};
+        size_t const currentChunksize{std::min(chunksize, timepoints.size() - chunkStart)};
 
-    for (size_t currentIndex{0}; currentIndex < timepoints.size(); currentIndex += chunksize) {
-        auto const sizeLeft{timepoints.size() - currentIndex};
-        if (sizeLeft < chunksize) {
-            chunksize = sizeLeft;
-            timepointsArray = Eigen::ArrayXd{chunksize};
-        }
-
-        // Update current timepoints
-        for (size_t i{currentIndex}; i < currentIndex + chunksize; ++i) {
-            timepointsArray(i - currentIndex) = timepoints[i];
+        // The current timepoints we calculate with
+        Eigen::ArrayXd timepointsArray(currentChunksize);
+        for (size_t i{0}; i < currentChunksize; ++i) {
+            timepointsArray(i) = timepoints[chunkStart + i];
         }
 
-        // Update the probabilities of the basic elements
-        for (auto const &be : basicElements) {
-            auto const beIndex{getSylvanBddManager()->getIndex(be->name())};
+        // The probabilities of the basic elements
+        std::vector<Eigen::ArrayXd> variableProbabilities(nrVariables);
+        for (size_t i{0}; i < basicElements.size(); ++i) {
+            auto const &be{basicElements[i]};
             // Vectorize known BETypes
             // fallback to getUnreliability() otherwise
             if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
@@ -320,18 +320,31 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
 
                 // exponential distribution
                 // p(T <= t) = 1 - exp(-lambda*t)
-                indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
+                variableProbabilities[basicElementIndices[i]] = 1 - (-failureRate * timepointsArray).exp();
             } else {
-                auto probabilities{timepointsArray};
-                for (size_t i{0}; i < chunksize; ++i) {
-                    probabilities(i) = be->getUnreliability(timepointsArray(i));
+                Eigen::ArrayXd probabilities(currentChunksize);
+                for (size_t j{0}; j < currentChunksize; ++j) {
+                    probabilities(j) = be->getUnreliability(timepointsArray(j));
                 }
-                indexToProbabilities[beIndex] = probabilities;
+                variableProbabilities[basicElementIndices[i]] = std::move(probabilities);
             }
         }
 
-        func(chunksize, timepointsArray, indexToProbabilities);
+        func(chunkStart, currentChunksize, variableProbabilities);
+    };
+
+    size_t const nrChunks{(timepoints.size() + chunksize - 1) / chunksize};
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, nrChunks), [&](tbb::blocked_range<size_t> const &range) {
+        for (size_t chunkIndex{range.begin()}; chunkIndex < range.end(); ++chunkIndex) {
+            calculateChunk(chunkIndex);
+        }
+    });
+#else
+    for (size_t chunkIndex{0}; chunkIndex < nrChunks; ++chunkIndex) {
+        calculateChunk(chunkIndex);
     }
+#endif
 }
 
 ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound) const {
@@ -347,23 +360,16 @@ ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound)
 }
 
 std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize) const {
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::vector<ValueType> resultProbabilities{};
-    resultProbabilities.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    LinearizedBdd const linearizedBdd{bdd};
+    std::vector<ValueType> resultProbabilities(timepoints.size());
 
-        // Great care was made so that the pointer returned is always valid
-        // and points to an element in bddToProbabilities
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const chunkStart, auto const currentChunksize, auto const &variableProbabilities) {
+        auto const probabilities{linearizedBdd.getProbabilities(currentChunksize, variableProbabilities)};
+        auto const &probabilitiesArray{probabilities[linearizedBdd.getRootIndex()]};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultProbabilities.push_back(probabilitiesArray(i));
+            resultProbabilities[chunkStart + i] = probabilitiesArray(i);
         }
     });
 
@@ -391,26 +397,12 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const importanceMeasures{getAllImportanceMeasuresAtTimepoints({timebound}, 0, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(importanceMeasures.size());
+    for (auto const &beImportanceMeasures : importanceMeasures) {
+        resultVector.push_back(beImportanceMeasures.front());
     }
     return resultVector;
 }
@@ -418,33 +410,21 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<ValueType> resultVector{};
-    resultVector.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd caches
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-        for (auto &i : bddToBirnbaumFactors) {
-            i.second.first = false;
-        }
+    LinearizedBdd const linearizedBdd{getTopLevelElementBdd()};
+    auto const index{getSylvanBddManager()->getIndex(beName)};
+    std::vector<ValueType> resultVector(timepoints.size());
 
-        // Great care was made so that the pointer returned is always valid
-        auto const index{getSylvanBddManager()->getIndex(beName)};
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-        auto const &birnbaumFactorsArray{
-            *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const chunkStart, auto const currentChunksize, auto const &variableProbabilities) {
+        auto const probabilities{linearizedBdd.getProbabilities(currentChunksize, variableProbabilities)};
+        auto const birnbaumFactors{linearizedBdd.getBirnbaumFactors(currentChunksize, variableProbabilities, probabilities)};
 
-        auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-        auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+        auto const &probabilitiesArray{probabilities[linearizedBdd.getRootIndex()]};
+        auto const &beProbabilitiesArray{variableProbabilities.at(index)};
+        auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactors.at(index))};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultVector.push_back(ImportanceMeasureArray(i));
+            resultVector[chunkStart + i] = ImportanceMeasureArray(i);
         }
     });
 
@@ -454,45 +434,30 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    LinearizedBdd const linearizedBdd{getTopLevelElementBdd()};
     auto const basicElements{getDFT()->getBasicElements()};
-
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
+    std::vector<uint32_t> basicElementIndices{};
+    basicElementIndices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
     }
 
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    std::vector<std::vector<ValueType>> resultVector(basicElements.size(), std::vector<ValueType>(timepoints.size()));
 
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const chunkStart, auto const currentChunksize, auto const &variableProbabilities) {
+        // One bottom-up and one top-down sweep yield the birnbaum factors of all basic elements
+        auto const probabilities{linearizedBdd.getProbabilities(currentChunksize, variableProbabilities)};
+        auto const birnbaumFactors{linearizedBdd.getBirnbaumFactors(currentChunksize, variableProbabilities, probabilities)};
+        auto const &probabilitiesArray{probabilities[linearizedBdd.getRootIndex()]};
 
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-            auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-
-            auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+            auto const index{basicElementIndices[basicElementIndex]};
+            auto const &beProbabilitiesArray{variableProbabilities[index]};
+            auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactors[index])};
 
             // Update result Probabilities
             for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
+                resultVector[basicElementIndex][chunkStart + i] = ImportanceMeasureArray(i);
             }
         }
     });
@@ -357,6 +357,16 @@ class SFTBDDChecker {
      */
     void recursiveMCS(Bdd const bdd, std::vector<uint32_t> &buffer, std::vector<std::vector<uint32_t>> &minimalCutSets) const;
 
+    /**
+     * Splits the timepoints into chunks and calls func
+     * with the offset of the chunk, the size of the chunk
+     * and the failure probabilities of the basic elements
+     * at the timepoints of the chunk (indexed by bdd variable).
+     *
+     * \note
+     * The chunks are processed concurrently if Storm is built with Intel TBB.
+     * Thus func must only write to the results of its own chunk.
+     */
     template<typename FuncType>
     void chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const;
 
@@ -0,0 +1,252 @@
+#include "DFTMonteCarloSimulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm::dft {
+namespace simulator {
+
+namespace {
+/*!
+ * Derive the seed of a random number generator stream from the base seed and the stream index (SplitMix64 finalizer).
+ * This yields well-distributed seeds even for consecutive stream indices.
+ */
+uint64_t deriveStreamSeed(uint64_t seed, uint64_t streamIndex) {
+    uint64_t z = seed + (streamIndex + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+}  // namespace
+
+template<typename ValueType>
+DFTMonteCarloSimulator<ValueType>::DFTMonteCarloSimulator(storm::dft::storage::DFT<ValueType> const& dft,
+                                                          storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t seed)
+    : dft(dft),
+      stateGenerationInfo(stateGenerationInfo),
+      seed(seed),
+      precision(0.01),
+      relative(false),
+      confidence(0.95),
+      maximalNumberOfTraces(10000000),
+      batchSize(1000),
+      splittingFactor(1),
+      maximalSplittingLevel(0),
+      numberOfSimulatedTraces(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setPrecision(double precision, bool relative) {
+    STORM_LOG_THROW(precision > 0, storm::exceptions::InvalidArgumentException, "Precision must be positive.");
+    this->precision = precision;
+    this->relative = relative;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setConfidence(double confidence) {
+    STORM_LOG_THROW(confidence > 0 && confidence < 1, storm::exceptions::InvalidArgumentException, "Confidence must be in (0,1).");
+    this->confidence = confidence;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setMaximalNumberOfTraces(uint64_t maximalNumberOfTraces) {
+    STORM_LOG_THROW(maximalNumberOfTraces > 0, storm::exceptions::InvalidArgumentException, "Maximal number of traces must be positive.");
+    this->maximalNumberOfTraces = maximalNumberOfTraces;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setBatchSize(uint64_t batchSize) {
+    STORM_LOG_THROW(batchSize > 0, storm::exceptions::InvalidArgumentException, "Batch size must be positive.");
+    this->batchSize = batchSize;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setImportanceSplitting(uint64_t splittingFactor, uint64_t maximalLevel) {
+    STORM_LOG_THROW(splittingFactor > 0, storm::exceptions::InvalidArgumentException, "Splitting factor must be positive.");
+    this->splittingFactor = splittingFactor;
+    this->maximalSplittingLevel = maximalLevel;
+}
+
+template<typename ValueType>
+uint64_t DFTMonteCarloSimulator<ValueType>::getNumberOfSimulatedTraces() const {
+    return numberOfSimulatedTraces;
+}
+
+template<typename ValueType>
+std::vector<UnreliabilityEstimate> DFTMonteCarloSimulator<ValueType>::estimateUnreliability(std::vector<double> const& timebounds) {
+    STORM_LOG_THROW(!timebounds.empty(), storm::exceptions::InvalidArgumentException, "At least one time bound is required.");
+
+    // Sort time bounds such that a trace only needs to be simulated up to the largest one
+    std::vector<size_t> order(timebounds.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&timebounds](size_t a, size_t b) { return timebounds[a] < timebounds[b]; });
+    std::vector<double> sortedTimebounds;
+    sortedTimebounds.reserve(timebounds.size());
+    for (size_t index : order) {
+        sortedTimebounds.push_back(timebounds[index]);
+    }
+
+    double const quantile = boost::math::quantile(boost::math::normal(), (1 + confidence) / 2);
+#ifdef STORM_HAVE_INTELTBB
+    uint64_t const batchesPerRound = std::max(1u, storm::utility::getNumberOfThreads());
+#else
+    uint64_t const batchesPerRound = 1;
+#endif
+
+    std::vector<double> sum(timebounds.size(), 0.0);
+    std::vector<double> sumOfSquares(timebounds.size(), 0.0);
+    std::vector<UnreliabilityEstimate> estimates(timebounds.size());
+    numberOfSimulatedTraces = 0;
+    uint64_t nextBatchIndex = 0;
+    bool precise = false;
+    while (!precise && numberOfSimulatedTraces < maximalNumberOfTraces) {
+        uint64_t const remainingTraces = maximalNumberOfTraces - numberOfSimulatedTraces;
+        uint64_t const numberOfBatches = std::min(batchesPerRound, (remainingTraces + batchSize - 1) / batchSize);
+        auto tracesInBatch = [&](uint64_t batch) { return std::min(batchSize, remainingTraces - batch * batchSize); };
+
+        std::vector<BatchStatistics> batchStatistics(numberOfBatches);
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBatches), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t batch = range.begin(); batch < range.end(); ++batch) {
+                batchStatistics[batch] = simulateBatch(nextBatchIndex + batch, tracesInBatch(batch), sortedTimebounds);
+            }
+        });
+#else
+        for (uint64_t batch = 0; batch < numberOfBatches; ++batch) {
+            batchStatistics[batch] = simulateBatch(nextBatchIndex + batch, tracesInBatch(batch), sortedTimebounds);
+        }
+#endif
+
+        // Combine batches in a fixed order to obtain reproducible results
+        for (uint64_t batch = 0; batch < numberOfBatches; ++batch) {
+            for (size_t i = 0; i < sortedTimebounds.size(); ++i) {
+                sum[i] += batchStatistics[batch].sum[i];
+                sumOfSquares[i] += batchStatistics[batch].sumOfSquares[i];
+            }
+            numberOfSimulatedTraces += tracesInBatch(batch);
+        }
+        nextBatchIndex += numberOfBatches;
+
+        // Compute confidence intervals
+        double const n = static_cast<double>(numberOfSimulatedTraces);
+        precise = true;
+        for (size_t i = 0; i < sortedTimebounds.size(); ++i) {
+            double const mean = sum[i] / n;
+            double halfWidth;
+            if (sum[i] == 0) {
+                // No failure observed yet: the sample variance is zero and gives no information.
+                // Use the bound for which observing no failure has probability 1-confidence instead.
+                halfWidth = -std::log(1 - confidence) / n;
+            } else {
+                double const variance = numberOfSimulatedTraces > 1 ? std::max(0.0, (sumOfSquares[i] - n * mean * mean) / (n - 1)) : 0.0;
+                halfWidth = quantile * std::sqrt(variance / n);
+            }
+            estimates[order[i]] = UnreliabilityEstimate{sortedTimebounds[i], mean, halfWidth};
+            precise &= halfWidth <= (relative ? precision * mean : precision);
+        }
+        STORM_LOG_DEBUG("Simulated " << numberOfSimulatedTraces << " traces.");
+    }
+    STORM_LOG_WARN_COND(precise, "Required precision not reached after maximal number of " << maximalNumberOfTraces << " traces.");
+    STORM_LOG_INFO("Simulated " << numberOfSimulatedTraces << " traces.");
+    return estimates;
+}
+
+template<typename ValueType>
+typename DFTMonteCarloSimulator<ValueType>::BatchStatistics DFTMonteCarloSimulator<ValueType>::simulateBatch(uint64_t batchIndex, uint64_t numberOfTraces,
+                                                                                                             std::vector<double> const& timebounds) const {
+    // Each batch has its own random number stream and its own simulator
+    uint64_t const streamSeed = deriveStreamSeed(seed, batchIndex);
+    boost::random::seed_seq seedSequence{static_cast<uint32_t>(streamSeed), static_cast<uint32_t>(streamSeed >> 32)};
+    boost::mt19937 randomGenerator(seedSequence);
+    DFTTraceSimulator<ValueType> simulator(dft, stateGenerationInfo, randomGenerator);
+
+    BatchStatistics statistics{std::vector<double>(timebounds.size(), 0.0), std::vector<double>(timebounds.size(), 0.0)};
+    std::vector<double> outcome(timebounds.size());
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        simulateTrace(simulator, timebounds, outcome);
+        for (size_t i = 0; i < timebounds.size(); ++i) {
+            statistics.sum[i] += outcome[i];
+            statistics.sumOfSquares[i] += outcome[i] * outcome[i];
+        }
+    }
+    return statistics;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::simulateTrace(DFTTraceSimulator<ValueType>& simulator, std::vector<double> const& timebounds,
+                                                      std::vector<double>& outcome) const {
+    using DFTStatePointer = std::shared_ptr<storm::dft::storage::DFTState<ValueType>>;
+    // A (partial) trace which still has to be simulated.
+    struct PendingTrace {
+        DFTStatePointer state;
+        double time;
+        double weight;
+        uint64_t level;
+    };
+
+    std::fill(outcome.begin(), outcome.end(), 0.0);
+    simulator.resetToInitial();
+    if (simulator.getCurrentState()->hasFailed(dft.getTopLevelIndex())) {
+        STORM_LOG_TRACE("DFT is initially failed");
+        std::fill(outcome.begin(), outcome.end(), 1.0);
+        return;
+    }
+
+    double const maxTimebound = timebounds.back();
+    // Copies created by splitting share their state until they perform their next step.
+    std::vector<PendingTrace> pendingTraces;
+    pendingTraces.push_back({simulator.getCurrentState(), 0, 1, 0});
+    while (!pendingTraces.empty()) {
+        PendingTrace current = std::move(pendingTraces.back());
+        pendingTraces.pop_back();
+        simulator.setCurrentState(current.state);
+
+        while (true) {
+            auto [nextFailable, addTime, successfulDependency] = simulator.randomNextFailure();
+            if (addTime < 0) {
+                // No element can fail anymore
+                break;
+            }
+            auto stepResult = simulator.step(nextFailable, successfulDependency);
+            STORM_LOG_THROW(stepResult == SimulationResult::SUCCESSFUL, storm::exceptions::NotSupportedException,
+                            "Handling of invalid states is not supported for simulation");
+            current.time += addTime;
+            if (current.time > maxTimebound) {
+                break;
+            }
+            if (simulator.getCurrentState()->hasFailed(dft.getTopLevelIndex())) {
+                STORM_LOG_TRACE("DFT has failed after " << current.time);
+                // Time bounds are sorted, so all bounds from the first one not smaller than the failure time are met
+                auto it = std::lower_bound(timebounds.begin(), timebounds.end(), current.time);
+                for (size_t i = std::distance(timebounds.begin(), it); i < timebounds.size(); ++i) {
+                    outcome[i] += current.weight;
+                }
+                break;
+            }
+
+            ++current.level;
+            if (splittingFactor > 1 && current.level <= maximalSplittingLevel) {
+                // Split trace into copies which continue from the current state
+                current.weight /= splittingFactor;
+                for (uint64_t copy = 1; copy < splittingFactor; ++copy) {
+                    pendingTraces.push_back({simulator.getCurrentState(), current.time, current.weight, current.level});
+                }
+            }
+        }
+    }
+}
+
+template class DFTMonteCarloSimulator<double>;
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/storage/DFT.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Statistical estimate of the unreliability for one time bound.
+ */
+struct UnreliabilityEstimate {
+    // Time bound.
+    double timebound;
+    // Estimated probability that the DFT has failed within the time bound.
+    double probability;
+    // Half width of the confidence interval around the estimated probability.
+    double halfWidth;
+};
+
+/*!
+ * Monte-Carlo simulation engine for DFTs.
+ * The engine simulates failure traces with DFTTraceSimulator until the confidence intervals of the unreliability estimates are sufficiently small.
+ *
+ * Traces are simulated in batches. Each batch uses its own random number generator whose seed is derived from the base seed and the batch index.
+ * Batches are simulated in parallel (if Storm is built with TBB) and their results are combined in the order of the batch indices.
+ * Thus, the estimates only depend on the seed and not on the number of threads or the scheduling.
+ *
+ * Optionally, rare failures can be handled by importance splitting: whenever a trace reaches a new level (given by the number of failures so far),
+ * the trace is split into several copies with correspondingly reduced weight. As all BE failure distributions are memoryless,
+ * the copies can continue independently from the (shared) current DFT state.
+ */
+template<typename ValueType>
+class DFTMonteCarloSimulator {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     * @param seed Base seed from which the seeds of all random number generators are derived.
+     */
+    DFTMonteCarloSimulator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                           uint64_t seed = 0);
+
+    /*!
+     * Set the required precision of the estimates.
+     *
+     * @param precision Maximal half width of the confidence intervals.
+     * @param relative If true, the half width is relative to the estimated probability.
+     */
+    void setPrecision(double precision, bool relative = false);
+
+    /*!
+     * Set the confidence level of the confidence intervals.
+     *
+     * @param confidence Confidence level in (0,1), e.g., 0.95.
+     */
+    void setConfidence(double confidence);
+
+    /*!
+     * Set the maximal number of traces after which the simulation stops regardless of the achieved precision.
+     *
+     * @param maximalNumberOfTraces Maximal number of traces.
+     */
+    void setMaximalNumberOfTraces(uint64_t maximalNumberOfTraces);
+
+    /*!
+     * Set the number of traces simulated within one batch.
+     *
+     * @param batchSize Number of traces per batch.
+     */
+    void setBatchSize(uint64_t batchSize);
+
+    /*!
+     * Enable importance splitting.
+     * A trace is split into the given number of copies whenever its number of failures reaches a level in 1,...,maximalLevel for the first time.
+     * A splitting factor of 1 disables importance splitting.
+     *
+     * @param splittingFactor Number of copies a trace is split into.
+     * @param maximalLevel Maximal level at which traces are split.
+     */
+    void setImportanceSplitting(uint64_t splittingFactor, uint64_t maximalLevel);
+
+    /*!
+     * Estimate the unreliability of the DFT for the given time bounds.
+     * All time bounds are handled by the same traces.
+     *
+     * @param timebounds Time bounds.
+     * @return Estimates for each time bound.
+     */
+    std::vector<UnreliabilityEstimate> estimateUnreliability(std::vector<double> const& timebounds);
+
+    /*!
+     * Get the number of traces simulated in the last call to estimateUnreliability.
+     * If importance splitting is enabled, only the initial traces are counted.
+     *
+     * @return Number of traces.
+     */
+    uint64_t getNumberOfSimulatedTraces() const;
+
+   private:
+    /*!
+     * Statistics collected during the simulation of a batch.
+     * For each time bound, the sum and the sum of squares of the (weighted) trace outcomes are stored.
+     */
+    struct BatchStatistics {
+        std::vector<double> sum;
+        std::vector<double> sumOfSquares;
+    };
+
+    /*!
+     * Simulate one batch of traces.
+     *
+     * @param batchIndex Index of the batch which determines the random number generator.
+     * @param numberOfTraces Number of traces to simulate.
+     * @param timebounds Time bounds sorted in ascending order.
+     * @return Statistics of the batch.
+     */
+    BatchStatistics simulateBatch(uint64_t batchIndex, uint64_t numberOfTraces, std::vector<double> const& timebounds) const;
+
+    /*!
+     * Simulate one trace (including all copies created by importance splitting) starting in the initial state.
+     *
+     * @param simulator Trace simulator.
+     * @param timebounds Time bounds sorted in ascending order.
+     * @param outcome Contains the probability mass of the trace failing within each time bound afterwards.
+     */
+    void simulateTrace(DFTTraceSimulator<ValueType>& simulator, std::vector<double> const& timebounds, std::vector<double>& outcome) const;
+
+    // The DFT to simulate.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    // Base seed.
+    uint64_t seed;
+
+    // Required precision.
+    double precision;
+
+    // Whether the precision is relative.
+    bool relative;
+
+    // Confidence level.
+    double confidence;
+
+    // Maximal number of traces.
+    uint64_t maximalNumberOfTraces;
+
+    // Number of traces per batch.
+    uint64_t batchSize;
+
+    // Splitting factor for importance splitting.
+    uint64_t splittingFactor;
+
+    // Maximal level for importance splitting.
+    uint64_t maximalSplittingLevel;
+
+    // Number of traces simulated in the last run.
+    uint64_t numberOfSimulatedTraces;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
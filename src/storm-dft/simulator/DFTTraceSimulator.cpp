@@ -8,7 +8,8 @@ DFTTraceSimulator<ValueType>::DFTTraceSimulator(storm::dft::storage::DFT<ValueTy
                                                 storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, boost::mt19937& randomGenerator)
     : dft(dft), stateGenerationInfo(stateGenerationInfo), generator(dft, stateGenerationInfo), randomGenerator(randomGenerator) {
     // Set initial state
-    state = generator.createInitialState();
+    initialState = generator.createInitialState();
+    state = initialState;
 }
 
 template<typename ValueType>
@@ -18,7 +19,12 @@ void DFTTraceSimulator<ValueType>::setRandomNumberGenerator(boost::mt19937& rand
 
 template<typename ValueType>
 void DFTTraceSimulator<ValueType>::resetToInitial() {
-    state = generator.createInitialState();
+    state = initialState;
+}
+
+template<typename ValueType>
+void DFTTraceSimulator<ValueType>::setCurrentState(DFTStatePointer newState) {
+    state = newState;
 }
 
 template<typename ValueType>
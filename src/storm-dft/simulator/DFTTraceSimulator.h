@@ -46,9 +46,19 @@ class DFTTraceSimulator {
 
     /*!
      * Set the current state back to the intial state in order to start a new simulation.
+     * The initial state is only created once and shared between all traces.
+     * This is safe as a step never modifies the current state but always creates a copy as successor state.
      */
     void resetToInitial();
 
+    /*!
+     * Set the current DFT state.
+     * The state can be shared with other simulators or traces, as steps do not modify it.
+     *
+     * @param newState DFT state.
+     */
+    void setCurrentState(DFTStatePointer newState);
+
     /*!
      * Get the current DFT state.
      *
@@ -105,6 +115,9 @@ class DFTTraceSimulator {
     // Generator for creating next state in DFT
     storm::dft::generator::DftNextStateGenerator<ValueType> generator;
 
+    // Initial state
+    DFTStatePointer initialState;
+
     // Current state
     DFTStatePointer state;
 
@@ -45,7 +45,7 @@ class SftToBddTransformator {
     Bdd const& transformTopLevel() {
         auto const tlName{dft->getTopLevelElement()->name()};
         if (relevantEventBdds.empty()) {
-            relevantEventBdds[tlName] = translate(dft->getTopLevelElement());
+            translateTopLevel();
         }
         // else relevantEventBdds is not empty and we maintain the invariant
         // that the toplevel event is in there
@@ -66,7 +66,7 @@ class SftToBddTransformator {
      */
     std::map<std::string, Bdd> const& transformRelevantEvents() {
         if (relevantEventBdds.empty()) {
-            relevantEventBdds[dft->getTopLevelElement()->name()] = translate(dft->getTopLevelElement());
+            translateTopLevel();
         }
 
         // we maintain the invariant that if relevantEventBdds is not empty
@@ -98,6 +98,14 @@ class SftToBddTransformator {
     }
 
    private:
+    /**
+     * Translates the toplevel event (and thereby all relevant events).
+     * The translation consists of many BDD operations, so it is run as one task of the sylvan workers.
+     */
+    void translateTopLevel() {
+        sylvanBddManager->execute([this]() { relevantEventBdds[dft->getTopLevelElement()->name()] = translate(dft->getTopLevelElement()); });
+    }
+
     std::map<std::string, Bdd> relevantEventBdds{};
     std::vector<uint32_t> variables{};
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
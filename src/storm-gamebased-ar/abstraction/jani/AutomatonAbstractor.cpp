@@ -15,6 +15,7 @@
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/utility/macros.h"
 
 namespace storm::gbar {
@@ -27,7 +28,11 @@ template<storm::dd::DdType DdType, typename ValueType>
 AutomatonAbstractor<DdType, ValueType>::AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation,
                                                             std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory,
                                                             bool useDecomposition, bool addPredicatesForValidBlocks, bool debug)
-    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton) {
+    : smtSolverFactory(smtSolverFactory),
+      abstractionInformation(abstractionInformation),
+      edges(),
+      automaton(automaton),
+      parallelAbstraction(storm::settings::getModule<AbstractionSettings>().isParallelAbstractionSet()) {
     // For each concrete command, we create an abstract counterpart.
     uint64_t edgeId = 0;
     for (auto const& edge : automaton.getEdges()) {
@@ -71,6 +76,10 @@ std::set<storm::expressions::Variable> const& AutomatonAbstractor<DdType, ValueT
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
+    if (parallelAbstraction) {
+        enumerateSolutionsConcurrently();
+    }
+
     // First, we retrieve the abstractions of all commands.
     std::vector<GameBddResult<DdType>> edgeDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
@@ -88,6 +97,32 @@ GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
     return GameBddResult<DdType>(result, maximalNumberOfUsedOptionVariables);
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+void AutomatonAbstractor<DdType, ValueType>::enumerateSolutionsConcurrently() {
+#ifdef STORM_HAVE_INTELTBB
+    // Only the edges whose relevant predicates changed need to be recomputed.
+    std::vector<uint64_t> edgesToRecompute;
+    for (uint64_t index = 0; index < edges.size(); ++index) {
+        if (edges[index].isRecomputationRequired()) {
+            edgesToRecompute.push_back(index);
+        }
+    }
+
+    // Every edge enumerates the solutions with its own SMT solver, so this can be done concurrently. The BDDs are then built sequentially
+    // when retrieving the abstractions of the edges.
+    if (edgesToRecompute.size() > 1) {
+        STORM_LOG_TRACE("Enumerating solutions of " << edgesToRecompute.size() << " edges concurrently.");
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, edgesToRecompute.size()), [this, &edgesToRecompute](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                edges[edgesToRecompute[index]].enumerateSolutions();
+            }
+        });
+    }
+#else
+    // Without TBB, the solutions are enumerated sequentially when retrieving the abstractions.
+#endif
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 BottomStateResult<DdType> AutomatonAbstractor<DdType, ValueType>::getBottomStateTransitions(storm::dd::Bdd<DdType> const& reachableStates,
                                                                                             uint_fast64_t numberOfPlayer2Variables) {
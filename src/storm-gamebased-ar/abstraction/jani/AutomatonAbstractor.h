@@ -129,6 +129,11 @@ class AutomatonAbstractor {
     void notifyGuardsArePredicates();
 
    private:
+    /*!
+     * Concurrently enumerates the solutions of all edges whose abstraction needs to be recomputed.
+     */
+    void enumerateSolutionsConcurrently();
+
     /*!
      * Retrieves the abstraction information.
      *
@@ -148,6 +153,9 @@ class AutomatonAbstractor {
     // The concrete module this abstract automaton refers to.
     std::reference_wrapper<storm::jani::Automaton const> automaton;
 
+    // A flag indicating whether the solutions of the edges are enumerated concurrently.
+    bool parallelAbstraction;
+
     // If the automaton has more than one location, we need variables to encode that.
     boost::optional<std::pair<storm::expressions::Variable, storm::expressions::Variable>> locationVariables;
 };
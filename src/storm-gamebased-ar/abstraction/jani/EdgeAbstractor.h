@@ -5,6 +5,8 @@
 #include <set>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "storm-gamebased-ar/abstraction/GameBddResult.h"
 #include "storm-gamebased-ar/abstraction/LocalExpressionInformation.h"
 #include "storm-gamebased-ar/abstraction/StateSetAbstractor.h"
@@ -15,6 +17,7 @@
 #include "storm/storage/expressions/Expression.h"
 
 #include "storm/solver/SmtSolver.h"
+#include "storm/storage/BitVector.h"
 
 namespace storm {
 namespace utility {
@@ -100,6 +103,18 @@ class EdgeAbstractor {
      */
     GameBddResult<DdType> abstract();
 
+    /*!
+     * Retrieves whether the abstraction of the edge needs to be recomputed, because its relevant predicates changed.
+     */
+    bool isRecomputationRequired() const;
+
+    /*!
+     * If the abstraction of the edge needs to be recomputed, this enumerates the solutions that make up the abstraction. Since this only
+     * involves the SMT solver of this edge (and no DD operations), it may be called concurrently for different edges. The next call to
+     * abstract() then builds the BDD from the enumerated solutions.
+     */
+    void enumerateSolutions();
+
     /*!
      * Retrieves the transitions to bottom states of this edge.
      *
@@ -165,23 +180,62 @@ class EdgeAbstractor {
     void addMissingPredicates(std::pair<std::set<uint_fast64_t>, std::vector<std::set<uint_fast64_t>>> const& newRelevantPredicates);
 
     /*!
-     * Translates the given model to a source state DD.
+     * The solutions found by an AllSat call, grouped by the values of the relevant source predicates.
+     */
+    struct EnumeratedSolutions {
+        // The variables (and predicates) of the relevant source predicates.
+        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
+        // The variables (and predicates) of the relevant successor predicates for each destination.
+        std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
+        // A mapping from the values of the source predicates to the values of the successor predicates of each found distribution.
+        std::map<storm::storage::BitVector, std::vector<storm::storage::BitVector>> sourceToDistributionsMap;
+        // The number of solutions that were found.
+        uint64_t numberOfSolutions = 0;
+    };
+
+    /*!
+     * Enumerates all solutions of the SMT solver wrt. to the given decision variables.
+     *
+     * @param decisionVariables The variables over which to perform AllSat.
+     * @param sourceVariablesAndPredicates The variables of the source predicates whose values are to be recorded.
+     * @param destinationVariablesAndPredicates The variables of the successor predicates whose values are to be recorded.
+     * @return The found solutions.
+     */
+    EnumeratedSolutions enumerateModels(
+        std::vector<storm::expressions::Variable> const& decisionVariables,
+        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& sourceVariablesAndPredicates,
+        std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& destinationVariablesAndPredicates);
+
+    /*!
+     * Translates the given values of the source predicates to a source state DD.
      *
-     * @param model The model to translate.
+     * @param values The values of the predicates.
+     * @param variablePredicates The variables and predicates to which the values refer.
      * @return The source state encoded as a DD.
      */
-    storm::dd::Bdd<DdType> getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model,
+    storm::dd::Bdd<DdType> getSourceStateBdd(storm::storage::BitVector const& values,
                                              std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
 
     /*!
-     * Translates the given model to a distribution over successor states.
+     * Translates the given values of the successor predicates to a distribution over successor states.
      *
-     * @param model The model to translate.
-     * @return The source state encoded as a DD.
+     * @param values The values of the predicates of all destinations.
+     * @param variablePredicates The variables and predicates to which the values refer.
+     * @return The distribution encoded as a DD.
      */
-    storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model,
+    storm::dd::Bdd<DdType> getDistributionBdd(storm::storage::BitVector const& values,
                                               std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
 
+    /*!
+     * Enumerates the solutions without using the decomposition.
+     */
+    void enumerateSolutionsWithoutDecomposition();
+
+    /*!
+     * Enumerates the solutions using the decomposition.
+     */
+    void enumerateSolutionsWithDecomposition();
+
     /*!
      * Recomputes the cached BDD. This needs to be triggered if any relevant predicates change.
      */
@@ -268,6 +322,15 @@ class EdgeAbstractor {
     // A flag remembering whether we need to force recomputation of the BDD.
     bool forceRecomputation;
 
+    // A flag indicating whether the solutions were enumerated, but not yet turned into the cached BDD.
+    bool solutionsEnumerated;
+
+    // The solutions of the most recent enumeration (one entry per block of the decomposition).
+    std::vector<EnumeratedSolutions> enumeratedSolutions;
+
+    // If the abstract guard was enumerated separately, the solutions of this enumeration.
+    boost::optional<EnumeratedSolutions> enumeratedGuardSolutions;
+
     // The abstract guard of the edge. This is only used if the guard is not a predicate, because it can
     // then be used to constrain the bottom state abstractor.
     storm::dd::Bdd<DdType> abstractGuard;
@@ -9,6 +9,7 @@
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 
 #include "storm/storage/prism/Command.h"
 #include "storm/storage/prism/Update.h"
@@ -38,6 +39,7 @@ CommandAbstractor<DdType, ValueType>::CommandAbstractor(storm::prism::Command co
       addPredicatesForValidBlocks(addPredicatesForValidBlocks),
       skipBottomStates(false),
       forceRecomputation(true),
+      solutionsEnumerated(false),
       abstractGuard(abstractionInformation.getDdManager().getBddZero()),
       bottomStateAbstractor(abstractionInformation, {!command.getGuardExpression()}, smtSolverFactory),
       debug(debug) {
@@ -81,6 +83,9 @@ void CommandAbstractor<DdType, ValueType>::refine(std::vector<uint_fast64_t> con
     bool relevantPredicatesChanged = this->relevantPredicatesChanged(newRelevantPredicates);
     if (relevantPredicatesChanged) {
         addMissingPredicates(newRelevantPredicates);
+
+        // Solutions that were enumerated before are outdated now.
+        solutionsEnumerated = false;
     }
     forceRecomputation |= relevantPredicatesChanged;
 
@@ -116,11 +121,71 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBdd() {
     } else {
         recomputeCachedBddWithoutDecomposition();
     }
+
+    // The enumerated solutions are not needed anymore.
+    enumeratedSolutions.clear();
+    enumeratedGuardSolutions = boost::none;
+    solutionsEnumerated = false;
+    forceRecomputation = false;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
-    STORM_LOG_TRACE("Recomputing BDD for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
+bool CommandAbstractor<DdType, ValueType>::isRecomputationRequired() const {
+    return forceRecomputation;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateSolutions() {
+    if (!forceRecomputation || solutionsEnumerated) {
+        return;
+    }
+
+    if (useDecomposition) {
+        enumerateSolutionsWithDecomposition();
+    } else {
+        enumerateSolutionsWithoutDecomposition();
+    }
+    solutionsEnumerated = true;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+typename CommandAbstractor<DdType, ValueType>::EnumeratedSolutions CommandAbstractor<DdType, ValueType>::enumerateModels(
+    std::vector<storm::expressions::Variable> const& decisionVariables,
+    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& sourceVariablesAndPredicates,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& destinationVariablesAndPredicates) {
+    EnumeratedSolutions result;
+    result.sourceVariablesAndPredicates = sourceVariablesAndPredicates;
+    result.destinationVariablesAndPredicates = destinationVariablesAndPredicates;
+    uint64_t numberOfDestinationVariables = 0;
+    for (auto const& variablesAndPredicates : destinationVariablesAndPredicates) {
+        numberOfDestinationVariables += variablesAndPredicates.size();
+    }
+
+    // Only record the values of the predicates here, so no DD operations are involved.
+    smtSolver->allSat(decisionVariables, [&result, &sourceVariablesAndPredicates, &destinationVariablesAndPredicates,
+                                          numberOfDestinationVariables](storm::solver::SmtSolver::ModelReference const& model) {
+        storm::storage::BitVector sourceValues(sourceVariablesAndPredicates.size());
+        for (uint64_t index = 0; index < sourceVariablesAndPredicates.size(); ++index) {
+            sourceValues.set(index, model.getBooleanValue(sourceVariablesAndPredicates[index].first));
+        }
+        storm::storage::BitVector destinationValues(numberOfDestinationVariables);
+        uint64_t index = 0;
+        for (auto const& variablesAndPredicates : destinationVariablesAndPredicates) {
+            for (auto const& variableIndexPair : variablesAndPredicates) {
+                destinationValues.set(index, model.getBooleanValue(variableIndexPair.first));
+                ++index;
+            }
+        }
+        result.sourceToDistributionsMap[sourceValues].push_back(std::move(destinationValues));
+        ++result.numberOfSolutions;
+        return true;
+    });
+    return result;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateSolutionsWithDecomposition() {
+    STORM_LOG_TRACE("Enumerating solutions for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
     auto start = std::chrono::high_resolution_clock::now();
 
     // compute a decomposition of the command
@@ -265,9 +330,6 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         }
     }
 
-    uint64_t numberOfSolutions = 0;
-    uint64_t numberOfTotalSolutions = 0;
-
     // If we need to enumerate the guard, do it only once now.
     if (enumerateAbstractGuard) {
         std::set<uint64_t> relatedGuardPredicates = localExpressionInformation.getRelatedExpressions(variablesContainedInGuard);
@@ -279,14 +341,8 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
                 guardVariablesAndPredicates.push_back(element);
             }
         }
-        abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
-        smtSolver->allSat(guardDecisionVariables,
-                          [this, &guardVariablesAndPredicates, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-                              abstractGuard |= getSourceStateBdd(model, guardVariablesAndPredicates);
-                              ++numberOfSolutions;
-                              return true;
-                          });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for abstract guard.");
+        enumeratedGuardSolutions = enumerateModels(guardDecisionVariables, guardVariablesAndPredicates, {});
+        STORM_LOG_TRACE("Enumerated " << enumeratedGuardSolutions->numberOfSolutions << " solutions for abstract guard.");
 
         // Now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
         // the other solutions.
@@ -294,26 +350,25 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         // Create a new backtracking point before adding the guard.
         smtSolver->push();
 
-        // Create the guard constraint.
-        std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result =
-            abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
-
-        // Then add it to the solver.
-        for (auto const& expression : result.first) {
-            smtSolver->add(expression);
+        // Create the guard constraint as the disjunction of the found valuations of the guard predicates. Since the decision variables are
+        // already associated with their predicates, this does not require new variables.
+        storm::expressions::ExpressionManager const& manager = this->getAbstractionInformation().getExpressionManager();
+        std::vector<storm::expressions::Expression> guardValuations;
+        for (auto const& sourceDistributionsPair : enumeratedGuardSolutions->sourceToDistributionsMap) {
+            std::vector<storm::expressions::Expression> literals;
+            for (uint64_t index = 0; index < guardVariablesAndPredicates.size(); ++index) {
+                storm::expressions::Expression variable = guardVariablesAndPredicates[index].first.getExpression();
+                literals.push_back(sourceDistributionsPair.first.get(index) ? variable : !variable);
+            }
+            guardValuations.push_back(literals.empty() ? manager.boolean(true) : storm::expressions::conjunction(literals));
         }
 
-        // Finally associate the level variables with the predicates.
-        for (auto const& indexVariablePair : result.second) {
-            smtSolver->add(
-                storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
-        }
+        // Then add it to the solver.
+        smtSolver->add(guardValuations.empty() ? manager.boolean(false) : storm::expressions::disjunction(guardValuations));
     }
 
     // Then enumerate the solutions for each of the blocks of the decomposition.
-    uint64_t usedNondeterminismVariables = 0;
-    uint64_t blockCounter = 0;
-    std::vector<storm::dd::Bdd<DdType>> blockBdds;
+    uint64_t numberOfTotalSolutions = 0;
     for (auto const& block : relevantBlockPartition) {
         std::set<uint64_t> relevantPredicates;
         for (auto const& innerBlock : block) {
@@ -353,22 +408,40 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
             }
         }
 
-        std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-        numberOfSolutions = 0;
-        smtSolver->allSat(transitionDecisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions, &sourceVariablesAndPredicates,
-                                                        &destinationVariablesAndPredicates](storm::solver::SmtSolver::ModelReference const& model) {
-            sourceToDistributionsMap[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(
-                getDistributionBdd(model, destinationVariablesAndPredicates));
-            ++numberOfSolutions;
-            return true;
-        });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
-        numberOfTotalSolutions += numberOfSolutions;
+        enumeratedSolutions.push_back(enumerateModels(transitionDecisionVariables, sourceVariablesAndPredicates, destinationVariablesAndPredicates));
+        STORM_LOG_TRACE("Enumerated " << enumeratedSolutions.back().numberOfSolutions << " solutions for block " << enumeratedSolutions.size() - 1 << ".");
+        numberOfTotalSolutions += enumeratedSolutions.back().numberOfSolutions;
+    }
 
+    if (enumerateAbstractGuard) {
+        smtSolver->pop();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    STORM_LOG_TRACE("Enumerated " << numberOfTotalSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                                  << "ms.");
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
+    // If the guard was enumerated separately, we construct the abstract guard from its solutions.
+    if (enumeratedGuardSolutions) {
+        abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
+        for (auto const& sourceDistributionsPair : enumeratedGuardSolutions->sourceToDistributionsMap) {
+            abstractGuard |= getSourceStateBdd(sourceDistributionsPair.first, enumeratedGuardSolutions->sourceVariablesAndPredicates);
+        }
+    }
+
+    // Then build the BDDs for each of the blocks of the decomposition.
+    uint64_t usedNondeterminismVariables = 0;
+    uint64_t blockCounter = 0;
+    std::vector<storm::dd::Bdd<DdType>> blockBdds;
+    for (auto const& solutions : enumeratedSolutions) {
         // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
         // need to encode the nondeterminism.
         uint_fast64_t maximalNumberOfChoices = 0;
-        for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
+        for (auto const& sourceDistributionsPair : solutions.sourceToDistributionsMap) {
             maximalNumberOfChoices = std::max(maximalNumberOfChoices, static_cast<uint_fast64_t>(sourceDistributionsPair.second.size()));
         }
 
@@ -381,20 +454,20 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         // Finally, build overall result.
         storm::dd::Bdd<DdType> resultBdd = this->getAbstractionInformation().getDdManager().getBddZero();
 
-        for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
-            STORM_LOG_ASSERT(!sourceDistributionsPair.first.isZero(), "The source BDD must not be empty.");
+        for (auto const& sourceDistributionsPair : solutions.sourceToDistributionsMap) {
             STORM_LOG_ASSERT(!sourceDistributionsPair.second.empty(), "The distributions must not be empty.");
 
             // We start with the distribution index of 1, because 0 is reserved for a potential bottom choice.
             uint_fast64_t distributionIndex = blockCounter == 0 ? 1 : 0;
             storm::dd::Bdd<DdType> allDistributions = this->getAbstractionInformation().getDdManager().getBddZero();
             for (auto const& distribution : sourceDistributionsPair.second) {
-                allDistributions |= distribution && this->getAbstractionInformation().encodePlayer2Choice(
-                                                        distributionIndex, usedNondeterminismVariables, usedNondeterminismVariables + numberOfVariablesNeeded);
+                allDistributions |= getDistributionBdd(distribution, solutions.destinationVariablesAndPredicates) &&
+                                    this->getAbstractionInformation().encodePlayer2Choice(distributionIndex, usedNondeterminismVariables,
+                                                                                          usedNondeterminismVariables + numberOfVariablesNeeded);
                 ++distributionIndex;
                 STORM_LOG_ASSERT(!allDistributions.isZero(), "The BDD must not be empty.");
             }
-            resultBdd |= sourceDistributionsPair.first && allDistributions;
+            resultBdd |= getSourceStateBdd(sourceDistributionsPair.first, solutions.sourceVariablesAndPredicates) && allDistributions;
             STORM_LOG_ASSERT(!resultBdd.isZero(), "The BDD must not be empty.");
         }
         usedNondeterminismVariables += numberOfVariablesNeeded;
@@ -403,10 +476,6 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         ++blockCounter;
     }
 
-    if (enumerateAbstractGuard) {
-        smtSolver->pop();
-    }
-
     // multiply the results
     storm::dd::Bdd<DdType> resultBdd = getAbstractionInformation().getDdManager().getBddOne();
     for (auto const& blockBdd : blockBdds) {
@@ -414,7 +483,7 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
     }
 
     // If we did not explicitly enumerate the guard, we can construct it from the result BDD.
-    if (!enumerateAbstractGuard) {
+    if (!enumeratedGuardSolutions) {
         std::set<storm::expressions::Variable> allVariables(getAbstractionInformation().getSuccessorVariables());
         auto player2Variables = getAbstractionInformation().getPlayer2VariableSet(usedNondeterminismVariables);
         allVariables.insert(player2Variables.begin(), player2Variables.end());
@@ -440,33 +509,27 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
 
     // Cache the result.
     cachedDd = GameBddResult<DdType>(resultBdd, usedNondeterminismVariables);
+}
 
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateSolutionsWithoutDecomposition() {
+    STORM_LOG_TRACE("Enumerating solutions for command " << command.get());
+    auto start = std::chrono::high_resolution_clock::now();
+    enumeratedSolutions.push_back(enumerateModels(decisionVariables, relevantPredicatesAndVariables.first, relevantPredicatesAndVariables.second));
     auto end = std::chrono::high_resolution_clock::now();
 
-    STORM_LOG_TRACE("Enumerated " << numberOfTotalSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
-                                  << "ms.");
-    forceRecomputation = false;
+    STORM_LOG_TRACE("Enumerated " << enumeratedSolutions.back().numberOfSolutions << " solutions in "
+                                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
 void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecomposition() {
-    STORM_LOG_TRACE("Recomputing BDD for command " << command.get());
-    auto start = std::chrono::high_resolution_clock::now();
-
-    // Create a mapping from source state DDs to their distributions.
-    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-    uint64_t numberOfSolutions = 0;
-    smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-        sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(
-            getDistributionBdd(model, relevantPredicatesAndVariables.second));
-        ++numberOfSolutions;
-        return true;
-    });
+    EnumeratedSolutions const& solutions = enumeratedSolutions.front();
 
     // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
     // need to encode the nondeterminism.
     uint_fast64_t maximalNumberOfChoices = 0;
-    for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
+    for (auto const& sourceDistributionsPair : solutions.sourceToDistributionsMap) {
         maximalNumberOfChoices = std::max(maximalNumberOfChoices, static_cast<uint_fast64_t>(sourceDistributionsPair.second.size()));
     }
 
@@ -479,37 +542,33 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecompositio
     if (!skipBottomStates) {
         abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
     }
-    for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
+    for (auto const& sourceDistributionsPair : solutions.sourceToDistributionsMap) {
+        storm::dd::Bdd<DdType> source = getSourceStateBdd(sourceDistributionsPair.first, solutions.sourceVariablesAndPredicates);
         if (!skipBottomStates) {
-            abstractGuard |= sourceDistributionsPair.first;
+            abstractGuard |= source;
         }
 
-        STORM_LOG_ASSERT(!sourceDistributionsPair.first.isZero(), "The source BDD must not be empty.");
         STORM_LOG_ASSERT(!sourceDistributionsPair.second.empty(), "The distributions must not be empty.");
         // We start with the distribution index of 1, becase 0 is reserved for a potential bottom choice.
         uint_fast64_t distributionIndex = 1;
         storm::dd::Bdd<DdType> allDistributions = this->getAbstractionInformation().getDdManager().getBddZero();
         for (auto const& distribution : sourceDistributionsPair.second) {
-            allDistributions |= distribution && this->getAbstractionInformation().encodePlayer2Choice(distributionIndex, 0, numberOfVariablesNeeded);
+            allDistributions |= getDistributionBdd(distribution, solutions.destinationVariablesAndPredicates) &&
+                                this->getAbstractionInformation().encodePlayer2Choice(distributionIndex, 0, numberOfVariablesNeeded);
             ++distributionIndex;
             STORM_LOG_ASSERT(!allDistributions.isZero(), "The BDD must not be empty.");
         }
-        resultBdd |= sourceDistributionsPair.first && allDistributions;
+        resultBdd |= source && allDistributions;
         STORM_LOG_ASSERT(!resultBdd.isZero(), "The BDD must not be empty.");
     }
 
     resultBdd &= computeMissingUpdateIdentities();
     resultBdd &=
         this->getAbstractionInformation().encodePlayer1Choice(command.get().getGlobalIndex(), this->getAbstractionInformation().getPlayer1VariableCount());
-    STORM_LOG_ASSERT(sourceToDistributionsMap.empty() || !resultBdd.isZero(), "The BDD must not be empty, if there were distributions.");
+    STORM_LOG_ASSERT(solutions.sourceToDistributionsMap.empty() || !resultBdd.isZero(), "The BDD must not be empty, if there were distributions.");
 
     // Cache the result.
     cachedDd = GameBddResult<DdType>(resultBdd, numberOfVariablesNeeded);
-    auto end = std::chrono::high_resolution_clock::now();
-
-    STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
-                                  << "ms.");
-    forceRecomputation = false;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -624,13 +683,11 @@ void CommandAbstractor<DdType, ValueType>::addMissingPredicates(
 
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
-    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
+    storm::storage::BitVector const& values, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
-    for (auto variableIndexPairIt = variablePredicates.rbegin(), variableIndexPairIte = variablePredicates.rend(); variableIndexPairIt != variableIndexPairIte;
-         ++variableIndexPairIt) {
-        auto const& variableIndexPair = *variableIndexPairIt;
-        if (model.getBooleanValue(variableIndexPair.first)) {
+    for (uint64_t index = variablePredicates.size(); index > 0; --index) {
+        auto const& variableIndexPair = variablePredicates[index - 1];
+        if (values.get(index - 1)) {
             result &= this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
         } else {
             result &= !this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
@@ -643,24 +700,27 @@ storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(
 
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
+    storm::storage::BitVector const& values,
     std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
 
+    // The values of the predicates of all updates are stored consecutively.
+    uint64_t offset = 0;
     for (uint_fast64_t updateIndex = 0; updateIndex < command.get().getNumberOfUpdates(); ++updateIndex) {
         storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
 
         // Translate block variables for this update into a successor block.
-        for (auto variableIndexPairIt = variablePredicates[updateIndex].rbegin(), variableIndexPairIte = variablePredicates[updateIndex].rend();
-             variableIndexPairIt != variableIndexPairIte; ++variableIndexPairIt) {
-            auto const& variableIndexPair = *variableIndexPairIt;
-            if (model.getBooleanValue(variableIndexPair.first)) {
+        for (uint64_t index = variablePredicates[updateIndex].size(); index > 0; --index) {
+            auto const& variableIndexPair = variablePredicates[updateIndex][index - 1];
+            if (values.get(offset + index - 1)) {
                 updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
             } else {
                 updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
             }
         }
 
+        offset += variablePredicates[updateIndex].size();
+
         updateBdd &= this->getAbstractionInformation().encodeAux(updateIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
         result |= updateBdd;
     }
@@ -699,6 +759,7 @@ storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::computeMissingUpdat
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> CommandAbstractor<DdType, ValueType>::abstract() {
     if (forceRecomputation) {
+        this->enumerateSolutions();
         this->recomputeCachedBdd();
     } else {
         cachedDd.bdd &= computeMissingUpdateIdentities();
@@ -14,6 +14,7 @@
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/utility/macros.h"
 
 namespace storm::gbar {
@@ -26,7 +27,11 @@ template<storm::dd::DdType DdType, typename ValueType>
 ModuleAbstractor<DdType, ValueType>::ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation,
                                                       std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition,
                                                       bool addPredicatesForValidBlocks, bool debug)
-    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module) {
+    : smtSolverFactory(smtSolverFactory),
+      abstractionInformation(abstractionInformation),
+      commands(),
+      module(module),
+      parallelAbstraction(storm::settings::getModule<AbstractionSettings>().isParallelAbstractionSet()) {
     // For each concrete command, we create an abstract counterpart.
     for (auto const& command : module.getCommands()) {
         commands.emplace_back(command, abstractionInformation, smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug);
@@ -64,6 +69,10 @@ std::set<storm::expressions::Variable> const& ModuleAbstractor<DdType, ValueType
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
+    if (parallelAbstraction) {
+        enumerateSolutionsConcurrently();
+    }
+
     // First, we retrieve the abstractions of all commands.
     std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
@@ -83,6 +92,30 @@ GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
     return GameBddResult<DdType>(result, maximalNumberOfUsedOptionVariables);
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+void ModuleAbstractor<DdType, ValueType>::enumerateSolutionsConcurrently() {
+#ifdef STORM_HAVE_INTELTBB
+    // Only the commands whose relevant predicates changed need to be recomputed.
+    std::vector<uint64_t> commandsToRecompute;
+    for (uint64_t index = 0; index < commands.size(); ++index) {
+        if (commands[index].isRecomputationRequired()) {
+            commandsToRecompute.push_back(index);
+        }
+    }
+
+    // Every command enumerates the solutions with its own SMT solver, so this can be done concurrently. The BDDs are then built sequentially
+    // when retrieving the abstractions of the commands.
+    if (commandsToRecompute.size() > 1) {
+        STORM_LOG_TRACE("Enumerating solutions of " << commandsToRecompute.size() << " commands concurrently.");
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, commandsToRecompute.size()), [this, &commandsToRecompute](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                commands[commandsToRecompute[index]].enumerateSolutions();
+            }
+        });
+    }
+#endif
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 BottomStateResult<DdType> ModuleAbstractor<DdType, ValueType>::getBottomStateTransitions(storm::dd::Bdd<DdType> const& reachableStates,
                                                                                          uint_fast64_t numberOfPlayer2Variables) {
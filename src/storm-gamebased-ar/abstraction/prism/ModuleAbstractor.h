@@ -120,6 +120,12 @@ class ModuleAbstractor {
     void notifyGuardsArePredicates();
 
    private:
+    /*!
+     * Concurrently enumerates the solutions of all commands whose abstraction needs to be recomputed. Without TBB, this does nothing and the
+     * solutions are enumerated when the abstractions of the commands are retrieved.
+     */
+    void enumerateSolutionsConcurrently();
+
     /*!
      * Retrieves the abstraction information.
      *
@@ -138,6 +144,9 @@ class ModuleAbstractor {
 
     // The concrete module this abstract module refers to.
     std::reference_wrapper<storm::prism::Module const> module;
+
+    // A flag indicating whether the solutions of the commands are enumerated concurrently.
+    bool parallelAbstraction;
 };
 }  // namespace prism
 }  // namespace abstraction
@@ -91,6 +91,21 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
         std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
         std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
 
+        // The valuations are checked in chunks such that results are printed while sampling and the memory consumption is bounded.
+        uint64_t const valuationsPerChunk = 1024;
+        std::vector<storm::utility::parametric::Valuation<ValueType>> valuations;
+        auto checkValuations = [&]() {
+            std::vector<storm::utility::Stopwatch> valuationWatches;
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = modelchecker.checkMultiple(Environment(), valuations, &valuationWatches);
+            for (uint64_t i = 0; i < valuations.size(); ++i) {
+                if (results[i]) {
+                    results[i]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                }
+                printInitialStatesResult<ValueType>(results[i], &valuationWatches[i], &valuations[i]);
+            }
+            valuations.clear();
+        };
+
         storm::utility::Stopwatch watch(true);
         for (auto const& product : samples.cartesianProducts) {
             parameters.clear();
@@ -109,15 +124,7 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
                 for (uint64_t i = 0; i < parameters.size(); ++i) {
                     valuation[parameters[i]] = *iterators[i];
                 }
-
-                storm::utility::Stopwatch valuationWatch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                valuationWatch.stop();
-
-                if (result) {
-                    result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
-                }
-                printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
+                valuations.push_back(valuation);
 
                 for (uint64_t i = 0; i < parameters.size(); ++i) {
                     ++iterators[i];
@@ -134,6 +141,10 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
                         break;
                     }
                 }
+
+                if (done || valuations.size() == valuationsPerChunk) {
+                    checkValuations();
+                }
             }
         }
 
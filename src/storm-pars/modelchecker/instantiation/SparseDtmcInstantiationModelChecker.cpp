@@ -1,12 +1,18 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <deque>
+#include <limits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -14,10 +20,25 @@ namespace modelchecker {
 
 template<typename SparseModelType, typename ConstantType>
 SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel)
-    : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel) {
+    : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel),
+      modelInstantiator(parametricModel),
+      maximalBatchSize(32),
+      maximalNumberOfWarmStartPoints(256) {
     // Intentionally left empty
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::setMaximalBatchSize(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The maximal batch size has to be positive.");
+    maximalBatchSize = value;
+}
+
+template<typename SparseModelType, typename ConstantType>
+void SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::setMaximalNumberOfWarmStartPoints(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The maximal number of warm-start points has to be positive.");
+    maximalNumberOfWarmStartPoints = value;
+}
+
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
@@ -49,6 +70,247 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
     }
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkMultiple(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations,
+    std::vector<storm::utility::Stopwatch>* valuationWatches) {
+    STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+    auto const& formula = this->currentCheckTask->getFormula();
+    bool isReachabilityProbabilityFormula = formula.isInFragment(storm::logic::reachability());
+    bool isReachabilityRewardFormula = formula.isInFragment(storm::logic::propositional()
+                                                                .setRewardOperatorsAllowed(true)
+                                                                .setReachabilityRewardFormulasAllowed(true)
+                                                                .setOperatorAtTopLevelRequired(true)
+                                                                .setNestedOperatorsAllowed(false)) &&
+                                       formula.asRewardOperatorFormula().getMeasureType() == storm::logic::RewardMeasureType::Expectation;
+
+    // The batched computation relies on value iteration and on the maybe states being the same for all valuations.
+    if (valuations.empty() || !this->getInstantiationsAreGraphPreserving() || !(isReachabilityProbabilityFormula || isReachabilityRewardFormula) ||
+        storm::NumberTraits<ConstantType>::IsExact || env.solver().isForceExact() || env.solver().isForceSoundness()) {
+        return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkMultiple(env, valuations, valuationWatches);
+    }
+
+    std::vector<std::unique_ptr<CheckResult>> results;
+    results.reserve(valuations.size());
+    if (valuationWatches) {
+        valuationWatches->assign(valuations.size(), storm::utility::Stopwatch());
+    }
+
+    // Checking the first valuation individually performs the graph analysis that is shared by all valuations.
+    storm::utility::Stopwatch firstValuationWatch(true);
+    results.push_back(check(env, valuations.front()));
+    firstValuationWatch.stop();
+    if (valuationWatches) {
+        valuationWatches->front().add(firstValuationWatch);
+    }
+    ExplicitModelCheckerHint<ConstantType>& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+    STORM_LOG_THROW(hint.hasMaybeStates() && hint.hasResultHint(), storm::exceptions::InvalidStateException,
+                    "Expected the graph analysis to be stored in the model checker hint.");
+    STORM_LOG_THROW(hint.getMaybeStates().size() == this->parametricModel.getNumberOfStates() &&
+                        hint.getResultHint().size() == this->parametricModel.getNumberOfStates(),
+                    storm::exceptions::InvalidStateException, "The model checker hint does not match the number of states of the model.");
+    storm::storage::BitVector const maybeStates = hint.getMaybeStates();
+    std::vector<ConstantType> const resultTemplate = hint.getResultHint();
+
+    auto toPoint = [](storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
+        std::vector<double> point;
+        point.reserve(valuation.size());
+        for (auto const& variableValue : valuation) {
+            point.push_back(storm::utility::convertNumber<double>(variableValue.second));
+        }
+        return point;
+    };
+
+    // The solutions of the most recently solved valuations are used to warm-start the subsequent batches.
+    std::deque<std::vector<double>> solvedPoints = {toPoint(valuations.front())};
+    std::deque<std::vector<ConstantType>> solvedValues = {storm::utility::vector::filterVector(resultTemplate, maybeStates)};
+
+    for (uint64_t batchStart = 1; batchStart < valuations.size(); batchStart += maximalBatchSize) {
+        storm::utility::Stopwatch batchWatch(true);
+        uint64_t batchEnd = std::min<uint64_t>(batchStart + maximalBatchSize, valuations.size());
+        std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const*> batch;
+        std::vector<std::vector<double>> batchPoints;
+        std::vector<std::vector<ConstantType>> initialValues;
+        for (uint64_t valuationIndex = batchStart; valuationIndex < batchEnd; ++valuationIndex) {
+            batch.push_back(&valuations[valuationIndex]);
+            batchPoints.push_back(toPoint(valuations[valuationIndex]));
+
+            // Start from the solution of the closest valuation among the recently solved ones.
+            uint64_t closest = 0;
+            double closestDistance = std::numeric_limits<double>::infinity();
+            for (uint64_t solvedIndex = 0; solvedIndex < solvedPoints.size(); ++solvedIndex) {
+                double distance = 0.0;
+                for (uint64_t dimension = 0; dimension < std::min(batchPoints.back().size(), solvedPoints[solvedIndex].size()); ++dimension) {
+                    double difference = batchPoints.back()[dimension] - solvedPoints[solvedIndex][dimension];
+                    distance += difference * difference;
+                }
+                if (distance < closestDistance) {
+                    closest = solvedIndex;
+                    closestDistance = distance;
+                }
+            }
+            initialValues.push_back(solvedValues[closest]);
+        }
+
+        std::vector<std::vector<ConstantType>> batchValues = solveMaybeStatesBatched(env, batch, std::move(initialValues));
+
+        for (auto const& maybeStateValues : batchValues) {
+            std::vector<ConstantType> values = resultTemplate;
+            storm::utility::vector::setVectorValues(values, maybeStates, maybeStateValues);
+            if (formula.asOperatorFormula().hasQuantitativeResult()) {
+                results.push_back(std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(values)));
+            } else {
+                results.push_back(ExplicitQuantitativeCheckResult<ConstantType>(std::move(values))
+                                      .compareAgainstBound(formula.asOperatorFormula().getComparisonType(),
+                                                           formula.asOperatorFormula().template getThresholdAs<ConstantType>()));
+            }
+        }
+        solvedPoints.insert(solvedPoints.end(), std::make_move_iterator(batchPoints.begin()), std::make_move_iterator(batchPoints.end()));
+        solvedValues.insert(solvedValues.end(), std::make_move_iterator(batchValues.begin()), std::make_move_iterator(batchValues.end()));
+        while (solvedPoints.size() > maximalNumberOfWarmStartPoints) {
+            solvedPoints.pop_front();
+            solvedValues.pop_front();
+        }
+
+        batchWatch.stop();
+        if (valuationWatches) {
+            // The valuations of a batch are solved simultaneously, so each of them is attributed the same share of the time.
+            std::chrono::nanoseconds timePerValuation(batchWatch.getTimeInNanoseconds() / static_cast<int64_t>(batch.size()));
+            for (uint64_t valuationIndex = batchStart; valuationIndex < batchEnd; ++valuationIndex) {
+                (*valuationWatches)[valuationIndex].addToTime(timePerValuation);
+            }
+        }
+    }
+
+    // Store the last solution as a hint for subsequent calls.
+    std::vector<ConstantType> lastValues = resultTemplate;
+    storm::utility::vector::setVectorValues(lastValues, maybeStates, solvedValues.back());
+    hint.setResultHint(std::move(lastValues));
+
+    return results;
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::vector<ConstantType>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::solveMaybeStatesBatched(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const*> const& valuations,
+    std::vector<std::vector<ConstantType>>&& initialValues) {
+    ExplicitModelCheckerHint<ConstantType> const& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+    storm::storage::BitVector const& maybeStates = hint.getMaybeStates();
+    std::vector<ConstantType> const& fixedValues = hint.getResultHint();
+    bool const isRewardFormula = this->currentCheckTask->getFormula().isRewardOperatorFormula();
+    uint64_t const batchSize = valuations.size();
+    uint64_t const numberOfMaybeStates = maybeStates.getNumberOfSetBits();
+
+    // Extract the structure of the equation system restricted to the maybe states. It is the same for all valuations.
+    std::vector<uint_fast64_t> maybeStateToIndex = maybeStates.getNumberOfSetBitsBeforeIndices();
+    std::vector<uint64_t> rowStarts;
+    rowStarts.reserve(numberOfMaybeStates + 1);
+    rowStarts.push_back(0);
+    std::vector<uint64_t> columns;
+    for (auto state : maybeStates) {
+        for (auto const& entry : this->parametricModel.getTransitionMatrix().getRow(state)) {
+            if (maybeStates.get(entry.getColumn())) {
+                columns.push_back(maybeStateToIndex[entry.getColumn()]);
+            }
+        }
+        rowStarts.push_back(columns.size());
+    }
+
+    // Instantiate the valuations. The values of the different valuations are stored interleaved, i.e.,
+    // the value of the i-th entry for the j-th valuation is stored at position i * batchSize + j.
+    std::vector<ConstantType> matrixValues(columns.size() * batchSize);
+    std::vector<ConstantType> offsets(numberOfMaybeStates * batchSize, storm::utility::zero<ConstantType>());
+    for (uint64_t valuationIndex = 0; valuationIndex < batchSize; ++valuationIndex) {
+        auto const& instantiatedModel = modelInstantiator.instantiate(*valuations[valuationIndex]);
+        auto const& matrix = instantiatedModel.getTransitionMatrix();
+        STORM_LOG_THROW(matrix.isProbabilistic(), storm::exceptions::InvalidArgumentException,
+                        "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+        std::vector<ConstantType> stateRewards;
+        if (isRewardFormula) {
+            auto const& rewardModel = this->currentCheckTask->isRewardModelSet() ? instantiatedModel.getRewardModel(this->currentCheckTask->getRewardModel())
+                                                                                 : instantiatedModel.getUniqueRewardModel();
+            stateRewards = rewardModel.getTotalRewardVector(matrix);
+        }
+
+        uint64_t entryIndex = 0;
+        uint64_t rowIndex = 0;
+        for (auto state : maybeStates) {
+            ConstantType& offset = offsets[rowIndex * batchSize + valuationIndex];
+            if (isRewardFormula) {
+                offset = stateRewards[state];
+            }
+            for (auto const& entry : matrix.getRow(state)) {
+                if (maybeStates.get(entry.getColumn())) {
+                    matrixValues[entryIndex * batchSize + valuationIndex] = entry.getValue();
+                    ++entryIndex;
+                } else if (!storm::utility::isZero(entry.getValue())) {
+                    offset += entry.getValue() * fixedValues[entry.getColumn()];
+                }
+            }
+            ++rowIndex;
+        }
+    }
+
+    std::vector<ConstantType> x(numberOfMaybeStates * batchSize);
+    for (uint64_t valuationIndex = 0; valuationIndex < batchSize; ++valuationIndex) {
+        for (uint64_t rowIndex = 0; rowIndex < numberOfMaybeStates; ++rowIndex) {
+            x[rowIndex * batchSize + valuationIndex] = initialValues[valuationIndex][rowIndex];
+        }
+    }
+
+    // Perform Gauss-Seidel value iteration. Each sweep traverses the matrix once and updates all valuations of the batch.
+    // Use the precision of the selected linear equation solver. Solvers without a precision fall back to the one of the native solver.
+    auto const solverPrecision = env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType());
+    ConstantType const precision =
+        storm::utility::convertNumber<ConstantType>(solverPrecision.first ? solverPrecision.first.get() : env.solver().native().getPrecision());
+    bool const relative = solverPrecision.second ? solverPrecision.second.get() : env.solver().native().getRelativeTerminationCriterion();
+    uint64_t const maxIterations = env.solver().native().getMaximalNumberOfIterations();
+    std::vector<ConstantType> newValues(batchSize);
+    std::vector<ConstantType> maxDifferences(batchSize);
+    storm::storage::BitVector converged(batchSize, false);
+    uint64_t iterations = 0;
+    while (!converged.full() && iterations < maxIterations) {
+        std::fill(maxDifferences.begin(), maxDifferences.end(), storm::utility::zero<ConstantType>());
+        for (uint64_t rowIndex = 0; rowIndex < numberOfMaybeStates; ++rowIndex) {
+            std::copy(offsets.begin() + rowIndex * batchSize, offsets.begin() + (rowIndex + 1) * batchSize, newValues.begin());
+            for (uint64_t entryIndex = rowStarts[rowIndex]; entryIndex < rowStarts[rowIndex + 1]; ++entryIndex) {
+                auto entryValueIt = matrixValues.begin() + entryIndex * batchSize;
+                auto successorValueIt = x.begin() + columns[entryIndex] * batchSize;
+                for (uint64_t valuationIndex = 0; valuationIndex < batchSize; ++valuationIndex) {
+                    newValues[valuationIndex] += entryValueIt[valuationIndex] * successorValueIt[valuationIndex];
+                }
+            }
+            auto rowValueIt = x.begin() + rowIndex * batchSize;
+            for (uint64_t valuationIndex = 0; valuationIndex < batchSize; ++valuationIndex) {
+                ConstantType difference = storm::utility::abs<ConstantType>(newValues[valuationIndex] - rowValueIt[valuationIndex]);
+                if (relative && !storm::utility::isZero(newValues[valuationIndex])) {
+                    difference /= storm::utility::abs<ConstantType>(newValues[valuationIndex]);
+                }
+                if (difference > maxDifferences[valuationIndex]) {
+                    maxDifferences[valuationIndex] = difference;
+                }
+                rowValueIt[valuationIndex] = newValues[valuationIndex];
+            }
+        }
+        for (uint64_t valuationIndex = 0; valuationIndex < batchSize; ++valuationIndex) {
+            if (maxDifferences[valuationIndex] <= precision) {
+                converged.set(valuationIndex);
+            }
+        }
+        ++iterations;
+    }
+    STORM_LOG_WARN_COND(converged.full(), "Batched value iteration did not converge within " << iterations << " iterations.");
+    STORM_LOG_INFO("Batched value iteration for " << batchSize << " valuations terminated after " << iterations << " iterations.");
+
+    std::vector<std::vector<ConstantType>> result(batchSize, std::vector<ConstantType>(numberOfMaybeStates));
+    for (uint64_t valuationIndex = 0; valuationIndex < batchSize; ++valuationIndex) {
+        for (uint64_t rowIndex = 0; rowIndex < numberOfMaybeStates; ++rowIndex) {
+            result[valuationIndex][rowIndex] = x[rowIndex * batchSize + valuationIndex];
+        }
+    }
+    return result;
+}
+
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(
     Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
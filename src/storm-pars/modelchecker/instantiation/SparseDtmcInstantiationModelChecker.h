@@ -23,6 +23,28 @@ class SparseDtmcInstantiationModelChecker : public SparseInstantiationModelCheck
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+    /*!
+     * Checks the specified formula for each of the given valuations.
+     * If the instantiations are graph preserving and the formula is an unbounded reachability probability or reward formula,
+     * the valuations are solved in batches that share the graph analysis. Each batch performs value iteration over interleaved
+     * value vectors (one per valuation) such that a single traversal of the matrix updates all valuations of the batch.
+     * Each valuation is initialized with the solution of the closest (w.r.t. the parameter values) valuation solved before.
+     * Otherwise, the valuations are checked one after another.
+     */
+    virtual std::vector<std::unique_ptr<CheckResult>> checkMultiple(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations,
+        std::vector<storm::utility::Stopwatch>* valuationWatches = nullptr) override;
+
+    /*!
+     * Sets the maximal number of valuations that are solved simultaneously in checkMultiple.
+     */
+    void setMaximalBatchSize(uint64_t value);
+
+    /*!
+     * Sets the maximal number of solved valuations whose solutions are kept to warm-start subsequent batches in checkMultiple.
+     */
+    void setMaximalNumberOfWarmStartPoints(uint64_t value);
+
    protected:
     // Optimizations for the different formula types
     std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(
@@ -32,7 +54,20 @@ class SparseDtmcInstantiationModelChecker : public SparseInstantiationModelCheck
     std::unique_ptr<CheckResult> checkBoundedUntilFormula(
         Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
 
+    /*!
+     * Solves the given valuations simultaneously on the maybe states of the current hint.
+     *
+     * @param valuations the valuations of the batch
+     * @param initialValues for each valuation, the values of the maybe states to start the iteration with
+     * @return for each valuation, the values of the maybe states
+     */
+    std::vector<std::vector<ConstantType>> solveMaybeStatesBatched(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const*> const& valuations,
+        std::vector<std::vector<ConstantType>>&& initialValues);
+
     storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
+    uint64_t maximalBatchSize;
+    uint64_t maximalNumberOfWarmStartPoints;
 };
 }  // namespace modelchecker
 }  // namespace storm
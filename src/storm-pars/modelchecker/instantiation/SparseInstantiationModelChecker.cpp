@@ -25,6 +25,26 @@ void SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyForm
         checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkMultiple(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations,
+    std::vector<storm::utility::Stopwatch>* valuationWatches) {
+    std::vector<std::unique_ptr<CheckResult>> results;
+    results.reserve(valuations.size());
+    if (valuationWatches) {
+        valuationWatches->assign(valuations.size(), storm::utility::Stopwatch());
+    }
+    for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+        storm::utility::Stopwatch valuationWatch(true);
+        results.push_back(check(env, valuations[valuationIndex]));
+        valuationWatch.stop();
+        if (valuationWatches) {
+            (*valuationWatches)[valuationIndex].add(valuationWatch);
+        }
+    }
+    return results;
+}
+
 template<typename SparseModelType, typename ConstantType>
 void SparseInstantiationModelChecker<SparseModelType, ConstantType>::setInstantiationsAreGraphPreserving(bool value) {
     instantiationsAreGraphPreserving = value;
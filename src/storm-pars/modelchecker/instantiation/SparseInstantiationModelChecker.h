@@ -5,6 +5,7 @@
 #include "storm/modelchecker/CheckTask.h"
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/modelchecker/results/CheckResult.h"
+#include "storm/utility/Stopwatch.h"
 
 namespace storm {
 
@@ -26,6 +27,19 @@ class SparseInstantiationModelChecker {
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
 
+    /*!
+     * Checks the specified formula for each of the given valuations.
+     * The default implementation checks one valuation after another. Derived classes may solve the valuations as a batch.
+     *
+     * @param valuations the valuations to check
+     * @param valuationWatches if given, this is filled with the time spent on each of the valuations. If valuations are solved as a batch,
+     * the time spent on the batch is distributed evenly among its valuations.
+     * @return the results, in the same order as the given valuations
+     */
+    virtual std::vector<std::unique_ptr<CheckResult>> checkMultiple(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations,
+        std::vector<storm::utility::Stopwatch>* valuationWatches = nullptr);
+
     // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
     // This bypasses the graph analysis for the different instantiations.
     void setInstantiationsAreGraphPreserving(bool value);
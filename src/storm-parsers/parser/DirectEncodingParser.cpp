@@ -1,13 +1,16 @@
 #include "storm-parsers/parser/DirectEncodingParser.h"
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
-#include <iostream>
-#include <regex>
+#include <limits>
+#include <optional>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/parser/ValueParser.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -26,10 +29,379 @@
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace parser {
 
+namespace {
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool startsWith(std::string_view str, std::string_view prefix) {
+    return str.substr(0, prefix.size()) == prefix;
+}
+
+std::string_view trimLeft(std::string_view str) {
+    while (!str.empty() && isBlank(str.front())) {
+        str.remove_prefix(1);
+    }
+    return str;
+}
+
+std::string_view trim(std::string_view str) {
+    str = trimLeft(str);
+    while (!str.empty() && isBlank(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+/*!
+ * Removes the first token (everything up to the first space) and the subsequent space from the given string.
+ *
+ * @return The removed token.
+ */
+std::string_view nextToken(std::string_view& str) {
+    size_t posEnd = str.find(' ');
+    std::string_view token = str.substr(0, posEnd);
+    str = posEnd == std::string_view::npos ? std::string_view() : str.substr(posEnd + 1);
+    return token;
+}
+
+/*!
+ * Returns the number (counting from one) of the line that contains the given position.
+ * Line numbers are only needed for error messages, so they are not tracked while parsing.
+ */
+uint64_t getLineNumber(char const* fileBegin, char const* position) {
+    return std::count(fileBegin, position, '\n') + 1;
+}
+
+size_t parseIndex(std::string_view str) {
+    size_t result = 0;
+    for (char c : str) {
+        if (c < '0' || c > '9' || result > (std::numeric_limits<size_t>::max() - 9) / 10) {
+            // Let the general number parser deal with (or complain about) everything else.
+            return parseNumber<size_t>(std::string(str));
+        }
+        result = 10 * result + (c - '0');
+    }
+    if (str.empty()) {
+        return parseNumber<size_t>(std::string(str));
+    }
+    return result;
+}
+
+/*!
+ * Parses a number of the form [-]digits[.digits] such that the digits (ignoring the decimal point) form an integer of at most the given maximal value.
+ * The number is then given by the (negated) mantissa divided by 10^fractionDigits.
+ *
+ * @return False if the given string is not of this form.
+ */
+bool parseDecimal(std::string_view str, uint64_t maxMantissa, bool& negative, uint64_t& mantissa, uint64_t& fractionDigits) {
+    negative = startsWith(str, "-");
+    if (negative) {
+        str.remove_prefix(1);
+    }
+    mantissa = 0;
+    fractionDigits = 0;
+    bool sawDigit = false;
+    bool sawPoint = false;
+    for (char c : str) {
+        if (c >= '0' && c <= '9') {
+            uint64_t digit = c - '0';
+            if (mantissa > (maxMantissa - digit) / 10) {
+                return false;
+            }
+            mantissa = 10 * mantissa + digit;
+            sawDigit = true;
+            if (sawPoint) {
+                ++fractionDigits;
+            }
+        } else if (c == '.' && !sawPoint) {
+            sawPoint = true;
+        } else {
+            return false;
+        }
+    }
+    return sawDigit;
+}
+
+/*!
+ * Converts the given string to a number without invoking the (general, but slow) value parser. This is only done if the result is exact, i.e., if it
+ * coincides with the result of the value parser.
+ *
+ * @return The number or none if the string can not be converted directly.
+ */
+template<typename ValueType>
+std::optional<ValueType> parseNumberDirectly(std::string_view) {
+    return std::nullopt;
+}
+
+template<>
+std::optional<double> parseNumberDirectly<double>(std::string_view str) {
+    // All powers of ten that are exactly representable as doubles.
+    static double const powersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    bool negative;
+    uint64_t mantissa, fractionDigits;
+    // If both the mantissa and the power of ten are exactly representable, the (correctly rounded) quotient is the correctly rounded value of the number.
+    if (!parseDecimal(str, 1ull << 53, negative, mantissa, fractionDigits) || fractionDigits > 22) {
+        return std::nullopt;
+    }
+    double result = static_cast<double>(mantissa) / powersOfTen[fractionDigits];
+    return negative ? -result : result;
+}
+
+template<>
+std::optional<storm::RationalNumber> parseNumberDirectly<storm::RationalNumber>(std::string_view str) {
+    uint64_t const maxValue = std::numeric_limits<int64_t>::max();
+    size_t posSlash = str.find('/');
+    bool negative;
+    uint64_t numerator, fractionDigits;
+    if (!parseDecimal(str.substr(0, posSlash), maxValue, negative, numerator, fractionDigits) || fractionDigits > 18) {
+        return std::nullopt;
+    }
+    uint64_t denominator = 1;
+    for (uint64_t i = 0; i < fractionDigits; ++i) {
+        denominator *= 10;
+    }
+    if (posSlash != std::string_view::npos) {
+        // A fraction of two integers.
+        bool negativeDenominator;
+        uint64_t denominatorFractionDigits;
+        if (fractionDigits > 0 || !parseDecimal(str.substr(posSlash + 1), maxValue, negativeDenominator, denominator, denominatorFractionDigits) ||
+            negativeDenominator || denominatorFractionDigits > 0 || denominator == 0) {
+            return std::nullopt;
+        }
+    }
+    storm::RationalNumber result = storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint_fast64_t>(numerator));
+    if (denominator != 1) {
+        result = result / storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint_fast64_t>(denominator));
+    }
+    return negative ? storm::RationalNumber(-result) : result;
+}
+
+/*!
+ * Splits the given string into labels. Labels are separated by whitespace and can optionally be enclosed in quotation marks.
+ */
+std::vector<std::string_view> splitLabels(std::string_view str) {
+    std::vector<std::string_view> labels;
+    str = trimLeft(str);
+    while (!str.empty()) {
+        size_t posEnd;
+        if (str.front() == '"') {
+            posEnd = str.find('"', 1);
+            STORM_LOG_THROW(posEnd != std::string_view::npos, storm::exceptions::WrongFormatException, "Quotation mark missing in labels '" << str << "'.");
+            if (posEnd > 1) {
+                labels.push_back(str.substr(1, posEnd - 1));
+            }
+            ++posEnd;
+        } else {
+            posEnd = std::min(str.find_first_of(" \t\r"), str.size());
+            labels.push_back(str.substr(0, posEnd));
+        }
+        str = trimLeft(str.substr(posEnd));
+    }
+    return labels;
+}
+
+/*!
+ * The content of a chunk of the model section, i.e., of a range of consecutive states.
+ * States and choices are indexed relative to the chunk.
+ */
+template<typename ValueType>
+struct ParsedChunk {
+    uint64_t getNumberOfStates() const {
+        return stateChoiceStarts.size() - 1;
+    }
+
+    uint64_t getNumberOfChoices() const {
+        return choiceEntryStarts.size() - 1;
+    }
+
+    // The id of the first state and the position of its declaration.
+    uint64_t firstState = 0;
+    char const* firstStatePosition = nullptr;
+    // For each state, the index of its first choice. The last element is the number of choices.
+    std::vector<uint64_t> stateChoiceStarts;
+    // For each choice, the index of its first entry. The last element is the number of entries.
+    std::vector<uint64_t> choiceEntryStarts;
+    // The target states and values of all transitions.
+    std::vector<std::pair<uint64_t, ValueType>> entries;
+    std::vector<ValueType> exitRates;
+    std::vector<uint32_t> observations;
+    // For each reward model, the non-zero rewards of states and choices, respectively.
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> stateRewards;
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> choiceRewards;
+    // The labels refer to the content of the (mapped) file.
+    std::vector<std::pair<uint64_t, std::string_view>> stateLabels;
+    std::vector<std::pair<uint64_t, std::string_view>> choiceLabels;
+};
+
+/*!
+ * Parses the comma-separated rewards of the given state or choice.
+ */
+template<typename ValueType, typename ValueParsingFunction>
+void parseRewards(std::string_view rewardsStr, uint64_t index, std::vector<std::vector<std::pair<uint64_t, ValueType>>>& rewards,
+                  ValueParsingFunction const& parseValue) {
+    for (uint64_t rewardModel = 0; true; ++rewardModel) {
+        size_t posComma = rewardsStr.find(',');
+        ValueType rewardValue = parseValue(trim(rewardsStr.substr(0, posComma)));
+        if (rewards.size() <= rewardModel) {
+            rewards.resize(rewardModel + 1);
+        }
+        if (!storm::utility::isZero(rewardValue)) {
+            rewards[rewardModel].emplace_back(index, std::move(rewardValue));
+        }
+        if (posComma == std::string_view::npos) {
+            break;
+        }
+        rewardsStr.remove_prefix(posComma + 1);
+    }
+}
+
+/*!
+ * Parses the given chunk of the model section. Apart from the first chunk, each chunk has to start with a state declaration.
+ */
+template<typename ValueType, typename ValueParsingFunction>
+void parseChunk(char const* fileBegin, char const* chunkBegin, char const* chunkEnd, storm::models::ModelType type, size_t stateSize, bool buildChoiceLabeling,
+                ValueParsingFunction const& parseValue, ParsedChunk<ValueType>& chunk) {
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    bool firstActionForState = true;
+    char const* position = chunkBegin;
+    while (position < chunkEnd) {
+        char const* lineBegin = position;
+        char const* lineEnd = std::find(position, chunkEnd, '\n');
+        position = lineEnd == chunkEnd ? chunkEnd : lineEnd + 1;
+        std::string_view line(lineBegin, lineEnd - lineBegin);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty() || startsWith(line, "//")) {
+            continue;
+        }
+        line = trimLeft(line);
+        if (startsWith(line, "state ")) {
+            // New state
+            uint64_t state = chunk.stateChoiceStarts.size();
+            line.remove_prefix(6);  // Remove "state "
+            size_t parsedId = parseIndex(nextToken(line));
+            if (state == 0) {
+                chunk.firstState = parsedId;
+                chunk.firstStatePosition = lineBegin;
+            } else {
+                STORM_LOG_THROW(chunk.firstState + state == parsedId, storm::exceptions::WrongFormatException,
+                                "In line " << getLineNumber(fileBegin, lineBegin) << " state ids are not ordered and without gaps. Expected "
+                                           << chunk.firstState + state << " but got " << parsedId << ".");
+            }
+            STORM_LOG_THROW(parsedId < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+            chunk.stateChoiceStarts.push_back(chunk.choiceEntryStarts.size());
+            chunk.choiceEntryStarts.push_back(chunk.entries.size());
+            firstActionForState = true;
+
+            if (continuousTime) {
+                // Parse exit rate for CTMC or MA
+                STORM_LOG_THROW(startsWith(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << getLineNumber(fileBegin, lineBegin));
+                line.remove_prefix(1);  // Remove "!"
+                chunk.exitRates.push_back(parseValue(nextToken(line)));
+            }
+
+            if (startsWith(line, "[")) {
+                // Parse rewards
+                size_t posEndReward = line.find(']');
+                STORM_LOG_THROW(posEndReward != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                "] missing in line " << getLineNumber(fileBegin, lineBegin) << " .");
+                parseRewards(line.substr(1, posEndReward - 1), state, chunk.stateRewards, parseValue);
+                line.remove_prefix(posEndReward + 1);
+            }
+
+            if (type == storm::models::ModelType::Pomdp) {
+                STORM_LOG_THROW(startsWith(line, "{"), storm::exceptions::WrongFormatException,
+                                "Expected an observation for state " << parsedId << " in line " << getLineNumber(fileBegin, lineBegin));
+                size_t posEndObservation = line.find('}');
+                STORM_LOG_THROW(posEndObservation != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                "} missing in line " << getLineNumber(fileBegin, lineBegin) << " .");
+                chunk.observations.push_back(std::stoi(std::string(line.substr(1, posEndObservation - 1))));
+                line.remove_prefix(posEndObservation + 1);
+            }
+
+            // Parse labels
+            for (auto const& label : splitLabels(line)) {
+                chunk.stateLabels.emplace_back(state, label);
+            }
+
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+            }
+        } else {
+            STORM_LOG_THROW(!chunk.stateChoiceStarts.empty(), storm::exceptions::WrongFormatException,
+                            "Expected a state declaration before line " << getLineNumber(fileBegin, lineBegin) << ".");
+            if (startsWith(line, "action ")) {
+                // New action
+                if (firstActionForState) {
+                    firstActionForState = false;
+                } else {
+                    chunk.choiceEntryStarts.push_back(chunk.entries.size());
+                }
+                uint64_t choice = chunk.choiceEntryStarts.size() - 1;
+                line.remove_prefix(7);  // Remove "action "
+                std::string_view actionName = nextToken(line);
+                if (buildChoiceLabeling && actionName != "__NOLABEL__") {
+                    chunk.choiceLabels.emplace_back(choice, actionName);
+                }
+                if (startsWith(line, "[")) {
+                    // Parse rewards
+                    size_t posEndReward = line.find(']');
+                    STORM_LOG_THROW(posEndReward != std::string_view::npos, storm::exceptions::WrongFormatException, "] missing.");
+                    parseRewards(line.substr(1, posEndReward - 1), choice, chunk.choiceRewards, parseValue);
+                }
+            } else {
+                // New transition
+                size_t posColon = line.find(':');
+                STORM_LOG_THROW(posColon != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                "':' not found in '" << line << "' on line " << getLineNumber(fileBegin, lineBegin) << ".");
+                size_t target = parseIndex(trim(line.substr(0, posColon)));
+                STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
+                                "In line " << getLineNumber(fileBegin, lineBegin) << " target state " << target << " is greater than state size " << stateSize);
+                chunk.entries.emplace_back(target, parseValue(trim(line.substr(posColon + 1))));
+            }
+        }
+    }
+    chunk.stateChoiceStarts.push_back(chunk.choiceEntryStarts.size());
+    chunk.choiceEntryStarts.push_back(chunk.entries.size());
+}
+
+/*!
+ * Splits the given range into at most the given number of chunks such that each chunk except for the first one starts with a state declaration.
+ *
+ * @return The boundaries of the chunks, i.e., the beginning of each chunk followed by the end of the last chunk.
+ */
+std::vector<char const*> splitIntoChunks(char const* begin, char const* end, uint64_t numberOfChunks) {
+    std::vector<char const*> boundaries = {begin};
+    uint64_t size = end - begin;
+    for (uint64_t i = 1; i < numberOfChunks; ++i) {
+        char const* position = std::max(begin + i * size / numberOfChunks, boundaries.back());
+        // Move to the beginning of the next line that declares a state.
+        while (position < end) {
+            position = std::find(position, end, '\n');
+            if (position != end) {
+                ++position;
+            }
+            if (startsWith(trimLeft(std::string_view(position, std::min<uint64_t>(end - position, 128))), "state ")) {
+                break;
+            }
+        }
+        if (position < end && position > boundaries.back()) {
+            boundaries.push_back(position);
+        }
+    }
+    boundaries.push_back(end);
+    return boundaries;
+}
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
@@ -117,8 +489,12 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
             STORM_LOG_THROW(!options.buildChoiceLabeling || nrChoices != 0, storm::exceptions::WrongFormatException,
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
-            // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            // Construct model components from the remainder of the file, which is accessed directly in memory
+            std::streamoff modelOffset = file.tellg();
+            MappedFile mappedFile(filename.c_str());
+            char const* modelBegin = modelOffset < 0 ? mappedFile.getDataEnd() : mappedFile.getData() + modelOffset;
+            modelComponents = parseStates(mappedFile.getData(), modelBegin, mappedFile.getDataEnd(), type, nrStates, nrChoices, placeholders, valueParser,
+                                          rewardModelNames, options);
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
@@ -133,14 +509,60 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
-    std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-    ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    char const* fileBegin, char const* modelBegin, char const* modelEnd, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
     // Initialize
     auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
     bool nonDeterministic =
         (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
     bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-    storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
+    auto parseValueFunction = [&placeholders, &valueParser](std::string_view valueStr) { return parseValue(valueStr, placeholders, valueParser); };
+
+    // Split the model section into chunks of consecutive states.
+    STORM_LOG_THROW(options.minimalChunkSize > 0, storm::exceptions::InvalidArgumentException, "The minimal chunk size must be positive.");
+    uint64_t numberOfChunks =
+        std::max<uint64_t>(1, std::min<uint64_t>((modelEnd - modelBegin) / options.minimalChunkSize, 8 * storm::utility::getNumberOfThreads()));
+    std::vector<char const*> chunkBoundaries = splitIntoChunks(modelBegin, modelEnd, numberOfChunks);
+    std::vector<ParsedChunk<ValueType>> chunks(chunkBoundaries.size() - 1);
+    STORM_LOG_TRACE("Parsing model section in " << chunks.size() << " chunks.");
+    auto parseChunks = [&](uint64_t firstChunk, uint64_t lastChunk) {
+        for (uint64_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+            parseChunk(fileBegin, chunkBoundaries[chunk], chunkBoundaries[chunk + 1], type, stateSize, options.buildChoiceLabeling, parseValueFunction,
+                       chunks[chunk]);
+        }
+    };
+    // Values of types other than double and rational numbers are parsed sequentially, because the value parser for them is not thread-safe.
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (std::is_same_v<ValueType, double> || std::is_same_v<ValueType, storm::RationalNumber>) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, chunks.size(), 1),
+                          [&parseChunks](tbb::blocked_range<uint64_t> const& range) { parseChunks(range.begin(), range.end()); });
+    } else {
+        parseChunks(0, chunks.size());
+    }
+#else
+    parseChunks(0, chunks.size());
+#endif
+    STORM_LOG_TRACE("Finished parsing");
+
+    // Check that the chunks fit together and determine the dimensions of the matrix
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfRows = 0;
+    uint64_t numberOfEntries = 0;
+    for (auto const& chunk : chunks) {
+        if (chunk.getNumberOfStates() > 0) {
+            STORM_LOG_THROW(chunk.firstState == numberOfStates, storm::exceptions::WrongFormatException,
+                            "In line " << getLineNumber(fileBegin, chunk.firstStatePosition) << " state ids are not ordered and without gaps. Expected "
+                                       << numberOfStates << " but got " << chunk.firstState << ".");
+        }
+        numberOfStates += chunk.getNumberOfStates();
+        numberOfRows += chunk.getNumberOfChoices();
+        numberOfEntries += chunk.entries.size();
+    }
+
+    // Assemble the model components
+    storm::storage::SparseMatrixBuilder<ValueType> builder =
+        storm::storage::SparseMatrixBuilder<ValueType>(numberOfRows, stateSize, numberOfEntries, false, nonDeterministic, nonDeterministic ? stateSize : 0);
     modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
     modelComponents->observabilityClasses = std::vector<uint32_t>();
     modelComponents->observabilityClasses->resize(stateSize);
@@ -160,222 +582,77 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         modelComponents->rateTransitions = true;
     }
 
-    // Iterate over all lines
-    std::string line;
-    size_t row = 0;
-    size_t state = 0;
-    uint64_t lineNumber = 0;
-    bool firstState = true;
-    bool firstActionForState = true;
-    while (storm::utility::getline(file, line)) {
-        lineNumber++;
-        if (boost::starts_with(line, "//")) {
-            continue;
-        }
-        if (line.empty()) {
-            continue;
-        }
-        STORM_LOG_TRACE("Parsing line no " << lineNumber << " : " << line);
-        boost::trim_left(line);
-        if (boost::starts_with(line, "state ")) {
-            // New state
-            if (firstState) {
-                firstState = false;
-            } else {
-                ++state;
-                ++row;
-            }
-            firstActionForState = true;
-            STORM_LOG_TRACE("New state " << state);
-            STORM_LOG_THROW(state <= stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
-
-            // Parse state id
-            line = line.substr(6);  // Remove "state "
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
-            }
-            size_t parsedId = parseNumber<size_t>(curString);
-            STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
+    uint64_t stateOffset = 0;
+    uint64_t rowOffset = 0;
+    for (auto& chunk : chunks) {
+        for (uint64_t state = 0; state < chunk.getNumberOfStates(); ++state) {
             if (nonDeterministic) {
-                STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                builder.newRowGroup(row);
+                builder.newRowGroup(rowOffset + chunk.stateChoiceStarts[state]);
                 STORM_LOG_THROW(nrChoices == 0 || builder.getCurrentRowGroupCount() <= nrChoices, storm::exceptions::WrongFormatException,
                                 "More actions detected than declared (in @nr_choices).");
             }
-
-            if (continuousTime) {
-                // Parse exit rate for CTMC or MA
-                STORM_LOG_THROW(boost::starts_with(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << lineNumber);
-                line = line.substr(1);  // Remove "!"
-                curString = line;
-                posEnd = line.find(" ");
-                if (posEnd != std::string::npos) {
-                    curString = line.substr(0, posEnd);
-                    line = line.substr(posEnd + 1);
-                } else {
-                    line = "";
-                }
-                ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                    modelComponents->markovianStates.get().set(state);
-                }
-                STORM_LOG_TRACE("Exit rate " << exitRate);
-                modelComponents->exitRates.get()[state] = exitRate;
-            }
-
-            if (boost::starts_with(line, "[")) {
-                // Parse rewards
-                size_t posEndReward = line.find(']');
-                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing in line " << lineNumber << " .");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("State rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (stateRewards.size() < rewards.size()) {
-                    stateRewards.resize(rewards.size());
-                }
-                auto stateRewardsIt = stateRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (stateRewardsIt->empty()) {
-                            stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
-                        }
-                        (*stateRewardsIt)[state] = std::move(rewardValue);
-                    }
-                    ++stateRewardsIt;
+            for (uint64_t choice = chunk.stateChoiceStarts[state]; choice < chunk.stateChoiceStarts[state + 1]; ++choice) {
+                for (uint64_t entry = chunk.choiceEntryStarts[choice]; entry < chunk.choiceEntryStarts[choice + 1]; ++entry) {
+                    builder.addNextValue(rowOffset + choice, chunk.entries[entry].first, std::move(chunk.entries[entry].second));
                 }
-                line = line.substr(posEndReward + 1);
             }
+        }
 
-            if (type == storm::models::ModelType::Pomdp) {
-                if (boost::starts_with(line, "{")) {
-                    size_t posEndObservation = line.find("}");
-                    std::string observation = line.substr(1, posEndObservation - 1);
-                    STORM_LOG_TRACE("State observation " << observation);
-                    modelComponents->observabilityClasses.value()[state] = std::stoi(observation);
-                    line = line.substr(posEndObservation + 1);
-                } else {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << " in line " << lineNumber);
+        if (continuousTime) {
+            for (uint64_t state = 0; state < chunk.getNumberOfStates(); ++state) {
+                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(chunk.exitRates[state])) {
+                    modelComponents->markovianStates.get().set(stateOffset + state);
                 }
+                modelComponents->exitRates.get()[stateOffset + state] = std::move(chunk.exitRates[state]);
             }
+        }
+        if (type == storm::models::ModelType::Pomdp) {
+            std::copy(chunk.observations.begin(), chunk.observations.end(), modelComponents->observabilityClasses->begin() + stateOffset);
+        }
 
-            // Parse labels
-            if (!line.empty()) {
-                std::vector<std::string> labels;
-                // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                // Regex for labels with two cases:
-                // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
-                //   (?=(\s|$|\"))
-                // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
-                // Iterate over matches
-                auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
-                auto match_end = std::sregex_iterator();
-                for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
-                    std::smatch match = *i;
-                    // Find matched group and add as label
-                    if (match.length(1) > 0) {
-                        labels.push_back(match.str(1));
-                    } else {
-                        labels.push_back(match.str(3));
-                    }
-                }
-
-                for (std::string const& label : labels) {
-                    if (!modelComponents->stateLabeling.containsLabel(label)) {
-                        modelComponents->stateLabeling.addLabel(label);
-                    }
-                    modelComponents->stateLabeling.addLabelToState(label, state);
-                    STORM_LOG_TRACE("New label: '" << label << "'");
-                }
+        for (auto const& stateAndLabel : chunk.stateLabels) {
+            std::string label(stateAndLabel.second);
+            if (!modelComponents->stateLabeling.containsLabel(label)) {
+                modelComponents->stateLabeling.addLabel(label);
             }
-        } else if (boost::starts_with(line, "action ")) {
-            // New action
-            if (firstActionForState) {
-                firstActionForState = false;
-            } else {
-                ++row;
-            }
-            STORM_LOG_TRACE("New action: " << row);
-            line = line.substr(7);
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
+            modelComponents->stateLabeling.addLabelToState(label, stateOffset + stateAndLabel.first);
+        }
+        for (auto const& choiceAndLabel : chunk.choiceLabels) {
+            std::string label(choiceAndLabel.second);
+            if (!modelComponents->choiceLabeling.value().containsLabel(label)) {
+                modelComponents->choiceLabeling.value().addLabel(label);
             }
+            modelComponents->choiceLabeling.value().addLabelToChoice(label, rowOffset + choiceAndLabel.first);
+        }
 
-            // curString contains action name.
-            if (options.buildChoiceLabeling) {
-                if (curString != "__NOLABEL__") {
-                    if (!modelComponents->choiceLabeling.value().containsLabel(curString)) {
-                        modelComponents->choiceLabeling.value().addLabel(curString);
-                    }
-                    modelComponents->choiceLabeling.value().addLabelToChoice(curString, row);
+        if (stateRewards.size() < chunk.stateRewards.size()) {
+            stateRewards.resize(chunk.stateRewards.size());
+        }
+        for (uint64_t rewardModel = 0; rewardModel < chunk.stateRewards.size(); ++rewardModel) {
+            for (auto& stateAndReward : chunk.stateRewards[rewardModel]) {
+                if (stateRewards[rewardModel].empty()) {
+                    stateRewards[rewardModel].resize(stateSize, storm::utility::zero<ValueType>());
                 }
+                stateRewards[rewardModel][stateOffset + stateAndReward.first] = std::move(stateAndReward.second);
             }
-            // Check for rewards
-            if (boost::starts_with(line, "[")) {
-                // Rewards found
-                size_t posEndReward = line.find(']');
-                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing.");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("Action rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (actionRewards.size() < rewards.size()) {
-                    actionRewards.resize(rewards.size());
-                }
-                auto actionRewardsIt = actionRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (actionRewardsIt->size() <= row) {
-                            actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
-                        }
-                        (*actionRewardsIt)[row] = std::move(rewardValue);
-                    }
-                    ++actionRewardsIt;
+        }
+        if (actionRewards.size() < chunk.choiceRewards.size()) {
+            actionRewards.resize(chunk.choiceRewards.size());
+        }
+        for (uint64_t rewardModel = 0; rewardModel < chunk.choiceRewards.size(); ++rewardModel) {
+            for (auto& choiceAndReward : chunk.choiceRewards[rewardModel]) {
+                if (actionRewards[rewardModel].empty()) {
+                    actionRewards[rewardModel].resize(numberOfRows, storm::utility::zero<ValueType>());
                 }
-                line = line.substr(posEndReward + 1);
+                actionRewards[rewardModel][rowOffset + choiceAndReward.first] = std::move(choiceAndReward.second);
             }
-
-        } else {
-            // New transition
-            size_t posColon = line.find(':');
-            STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException,
-                            "':' not found in '" << line << "' on line " << lineNumber << ".");
-            size_t target = parseNumber<size_t>(line.substr(0, posColon - 1));
-            std::string valueStr = line.substr(posColon + 2);
-            ValueType value = parseValue(valueStr, placeholders, valueParser);
-            STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
-            STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
-            builder.addNextValue(row, target, value);
         }
 
-        if (storm::utility::resources::isTerminate()) {
-            std::cout << "Parsed " << state << "/" << stateSize << " states before abort.\n";
-            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-            break;
-        }
-
-    }  // end state iteration
-    STORM_LOG_TRACE("Finished parsing");
+        stateOffset += chunk.getNumberOfStates();
+        rowOffset += chunk.getNumberOfChoices();
+        // Release the memory of the chunk as early as possible.
+        chunk = ParsedChunk<ValueType>();
+    }
 
     if (nonDeterministic) {
         STORM_LOG_THROW(nrChoices == 0 || builder.getLastRow() + 1 == nrChoices, storm::exceptions::WrongFormatException,
@@ -384,7 +661,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
     }
 
     // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
+    modelComponents->transitionMatrix = builder.build(numberOfRows, stateSize, nonDeterministic ? stateSize : 0);
     STORM_LOG_TRACE("Built matrix");
 
     // Build reward models
@@ -401,7 +678,6 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             stateRewardVector = std::move(stateRewards[i]);
         }
         if (i < actionRewards.size() && !actionRewards[i].empty()) {
-            actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
             actionRewardVector = std::move(actionRewards[i]);
         }
         modelComponents->rewardModels.emplace(
@@ -412,16 +688,18 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
 }
 
 template<typename ValueType, typename RewardModelType>
-ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr,
+ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string_view valueStr,
                                                                        std::unordered_map<std::string, ValueType> const& placeholders,
                                                                        ValueParser<ValueType> const& valueParser) {
-    if (boost::starts_with(valueStr, "$")) {
-        auto it = placeholders.find(valueStr.substr(1));
+    if (startsWith(valueStr, "$")) {
+        auto it = placeholders.find(std::string(valueStr.substr(1)));
         STORM_LOG_THROW(it != placeholders.end(), storm::exceptions::WrongFormatException, "Placeholder " << valueStr << " unknown.");
         return it->second;
+    } else if (auto value = parseNumberDirectly<ValueType>(valueStr)) {
+        return std::move(*value);
     } else {
         // Use default value parser
-        return valueParser.parseValue(valueStr);
+        return valueParser.parseValue(std::string(valueStr));
     }
 }
 
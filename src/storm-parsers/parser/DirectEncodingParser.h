@@ -1,6 +1,8 @@
 #ifndef STORM_PARSER_DIRECTENCODINGPARSER_H_
 #define STORM_PARSER_DIRECTENCODINGPARSER_H_
 
+#include <string_view>
+
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/sparse/ModelComponents.h"
@@ -13,6 +15,8 @@ class ValueParser;
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // The minimal size (in bytes) of a chunk of the model section that is parsed by a single task.
+    uint64_t minimalChunkSize = 1ull << 20;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -33,8 +37,11 @@ class DirectEncodingParser {
    private:
     /*!
      * Parse states and return transition matrix.
+     * The model section is split into chunks of consecutive states which are parsed independently (and concurrently, if possible).
      *
-     * @param file Input file stream.
+     * @param fileBegin Beginning of the file content (used to determine line numbers).
+     * @param modelBegin Beginning of the model section, i.e., the first character after the line containing @model.
+     * @param modelEnd End of the model section.
      * @param type Model type.
      * @param stateSize No. of states
      * @param placeholders Placeholders for values.
@@ -44,17 +51,19 @@ class DirectEncodingParser {
      * @return Transition matrix.
      */
     static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(
-        std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+        char const* fileBegin, char const* modelBegin, char const* modelEnd, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
     /*!
      * Parse value from string while using placeholders.
+     * Plain decimal numbers are converted directly if this is exact, all other values are passed to the value parser.
      * @param valueStr String.
      * @param placeholders Placeholders.
      * @param valueParser Value parser.
      * @return
      */
-    static ValueType parseValue(std::string const& valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
+    static ValueType parseValue(std::string_view valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
                                 ValueParser<ValueType> const& valueParser);
 };
 
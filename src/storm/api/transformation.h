@@ -107,24 +107,31 @@ template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> transformSymbolicToSparseModel(
     std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& symbolicModel,
     std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>()) {
-    switch (symbolicModel->getType()) {
-        case storm::models::ModelType::Dtmc:
-            return storm::transformer::SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>().translate(
-                *symbolicModel->template as<storm::models::symbolic::Dtmc<Type, ValueType>>(), formulas);
-        case storm::models::ModelType::Mdp:
-            return storm::transformer::SymbolicMdpToSparseMdpTransformer<Type, ValueType>::translate(
-                *symbolicModel->template as<storm::models::symbolic::Mdp<Type, ValueType>>(), formulas);
-        case storm::models::ModelType::Ctmc:
-            return storm::transformer::SymbolicCtmcToSparseCtmcTransformer<Type, ValueType>::translate(
-                *symbolicModel->template as<storm::models::symbolic::Ctmc<Type, ValueType>>(), formulas);
-        case storm::models::ModelType::MarkovAutomaton:
-            return storm::transformer::SymbolicMaToSparseMaTransformer<Type, ValueType>::translate(
-                *symbolicModel->template as<storm::models::symbolic::MarkovAutomaton<Type, ValueType>>(), formulas);
-        default:
-            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
-                            "Transformation of symbolic " << symbolicModel->getType() << " to sparse model is not supported.");
-    }
-    return nullptr;
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> result;
+    symbolicModel->getManager().execute([&]() {
+        switch (symbolicModel->getType()) {
+            case storm::models::ModelType::Dtmc:
+                result = storm::transformer::SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>().translate(
+                    *symbolicModel->template as<storm::models::symbolic::Dtmc<Type, ValueType>>(), formulas);
+                break;
+            case storm::models::ModelType::Mdp:
+                result = storm::transformer::SymbolicMdpToSparseMdpTransformer<Type, ValueType>::translate(
+                    *symbolicModel->template as<storm::models::symbolic::Mdp<Type, ValueType>>(), formulas);
+                break;
+            case storm::models::ModelType::Ctmc:
+                result = storm::transformer::SymbolicCtmcToSparseCtmcTransformer<Type, ValueType>::translate(
+                    *symbolicModel->template as<storm::models::symbolic::Ctmc<Type, ValueType>>(), formulas);
+                break;
+            case storm::models::ModelType::MarkovAutomaton:
+                result = storm::transformer::SymbolicMaToSparseMaTransformer<Type, ValueType>::translate(
+                    *symbolicModel->template as<storm::models::symbolic::MarkovAutomaton<Type, ValueType>>(), formulas);
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                                "Transformation of symbolic " << symbolicModel->getType() << " to sparse model is not supported.");
+        }
+    });
+    return result;
 }
 
 template<typename ValueType>
@@ -108,20 +108,28 @@ DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool
       buildAllRewardModels(buildAllRewardModels),
       applyMaximumProgressAssumption(applyMaximumProgressAssumption),
       rewardModelsToBuild(),
-      constantDefinitions() {
+      constantDefinitions(),
+      variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
     // Intentionally left empty.
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula)
-    : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      constantDefinitions(),
+      variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
     this->preserveFormula(formula);
     this->setTerminalStatesFromFormula(formula);
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
-    : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+    : buildAllLabels(false),
+      buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      constantDefinitions(),
+      variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
     if (!formulas.empty()) {
         for (auto const& formula : formulas) {
             this->preserveFormula(*formula);
@@ -301,8 +309,9 @@ struct CompositionVariables {
 template<storm::dd::DdType Type, typename ValueType>
 class CompositionVariableCreator : public storm::jani::CompositionVisitor {
    public:
-    CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation)
-        : model(model), automata(), actionInformation(actionInformation) {
+    CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation,
+                               storm::builder::DdVariableOrdering variableOrdering)
+        : model(model), automata(), actionInformation(actionInformation), variableOrdering(variableOrdering) {
         // Intentionally left empty.
     }
 
@@ -379,42 +388,49 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
         }
 
+        // Gather the location variables and the non-transient variables of the model.
+        std::map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomaton;
         for (auto const& automatonName : this->automata) {
             storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+            locationVariableToAutomaton.emplace(automaton.getLocationExpressionVariable(), &automaton);
+        }
+        std::map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariable;
+        for (auto const& variable : this->model.getGlobalVariables()) {
+            expressionVariableToVariable.emplace(variable.getExpressionVariable(), &variable);
+        }
+        for (auto const& automaton : this->model.getAutomata()) {
+            for (auto const& variable : automaton.getVariables()) {
+                expressionVariableToVariable.emplace(variable.getExpressionVariable(), &variable);
+            }
+        }
 
-            // Start by creating a meta variable for the location of the automaton.
-            storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-            result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-            result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-            result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-            result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-
-            // Add the location variable to the row/column variables.
-            result.rowMetaVariables.insert(variablePair.first);
-            result.columnMetaVariables.insert(variablePair.second);
-
-            // Add the legal range for the location variables.
-            result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-            result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+        // Create the meta variables. As the position of a DD variable is fixed upon creation for some libraries (e.g. sylvan),
+        // the variables are created in the order given by the ordering heuristic.
+        // Location variables of automata that do not appear in the composition are skipped.
+        for (auto const& expressionVariable : storm::builder::getDdVariableOrder(this->model, variableOrdering)) {
+            auto locationIt = locationVariableToAutomaton.find(expressionVariable);
+            auto variableIt = expressionVariableToVariable.find(expressionVariable);
+            if (locationIt != locationVariableToAutomaton.end()) {
+                createLocationVariable(*locationIt->second, result);
+            } else if (variableIt != expressionVariableToVariable.end()) {
+                createVariable(*variableIt->second, result);
+            }
         }
+        STORM_LOG_DEBUG("Created DD variables in " << variableOrdering << " order.");
 
-        // Create global variables.
+        // Compute the ranges of the global variables.
         storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
         for (auto const& variable : this->model.getGlobalVariables()) {
-            // Only create the variable if it's non-transient.
+            // Only non-transient variables have been created.
             if (variable.isTransient()) {
                 continue;
             }
 
-            createVariable(variable, result);
             globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
         }
         result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
 
-        // Create the variables for the individual automata.
+        // Compute the identities and ranges of the individual automata.
         for (auto const& automaton : this->model.getAutomata()) {
             storm::dd::Bdd<Type> identity = result.manager->getBddOne();
             storm::dd::Bdd<Type> range = result.manager->getBddOne();
@@ -426,14 +442,13 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             identity &= variableIdentity;
             range &= result.manager->getRange(locationVariables.first);
 
-            // Then create variables for the variables of the automaton.
+            // Then add the identities and ranges of the variables of the automaton.
             for (auto const& variable : automaton.getVariables()) {
-                // Only create the variable if it's non-transient.
+                // Only non-transient variables have been created.
                 if (variable.isTransient()) {
                     continue;
                 }
 
-                createVariable(variable, result);
                 identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                 range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
             }
@@ -451,6 +466,25 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         return result;
     }
 
+    void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+        storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+            result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+        result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+        result.rowColumnMetaVariablePairs.push_back(variablePair);
+
+        result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+        result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+
+        // Add the location variable to the row/column variables.
+        result.rowMetaVariables.insert(variablePair.first);
+        result.columnMetaVariables.insert(variablePair.second);
+
+        // Add the legal range for the location variables.
+        result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+        result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+    }
+
     void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
         auto const& type = variable.getType();
         if (type.isBasicType() && type.asBasicType().isBooleanType()) {
@@ -518,6 +552,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
     storm::jani::Model const& model;
     std::set<std::string> automata;
     storm::jani::CompositionInformation actionInformation;
+    storm::builder::DdVariableOrdering variableOrdering;
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -2344,7 +2379,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     storm::jani::CompositionInformation actionInformation = visitor.getInformation();
 
     // Create all necessary variables.
-    CompositionVariableCreator<Type, ValueType> variableCreator(model, actionInformation);
+    CompositionVariableCreator<Type, ValueType> variableCreator(model, actionInformation, options.variableOrdering);
     CompositionVariables<Type, ValueType> variables = variableCreator.create(manager);
 
     // Determine which transient assignments need to be considered in the building process.
@@ -6,6 +6,7 @@
 #include "storm/storage/expressions/Variable.h"
 #include "storm/storage/jani/Property.h"
 
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/builder/TerminalStatesGetter.h"
 #include "storm/logic/Formula.h"
 
@@ -117,6 +118,9 @@ class DdJaniModelBuilder {
         // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
         // If this is set, the outgoing transitions of these states are replaced with a self-loop.
         storm::builder::TerminalStates terminalStates;
+
+        // The heuristic that determines the order in which the DD variables for the model variables are created.
+        storm::builder::DdVariableOrdering variableOrdering;
     };
 
     /*!
@@ -7,6 +7,7 @@
 
 #include "storm/storage/prism/Program.h"
 
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/builder/TerminalStatesGetter.h"
 
 #include "storm/logic/Formulas.h"
@@ -99,6 +100,9 @@ class DdPrismModelBuilder {
         // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
         // If this is set, the outgoing transitions of these states are replaced with a self-loop.
         storm::builder::TerminalStates terminalStates;
+
+        // The heuristic that determines the order in which the DD variables for the program variables are created.
+        storm::builder::DdVariableOrdering variableOrdering;
     };
 
     /*!
@@ -0,0 +1,238 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering) {
+    switch (ordering) {
+        case DdVariableOrdering::Declaration:
+            out << "declaration";
+            break;
+        case DdVariableOrdering::Force:
+            out << "force";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+namespace {
+uint64_t computeSpan(std::vector<std::vector<uint64_t>> const& hyperedges, std::vector<uint64_t> const& positions) {
+    uint64_t span = 0;
+    for (auto const& hyperedge : hyperedges) {
+        auto minMax = std::minmax_element(hyperedge.begin(), hyperedge.end(),
+                                          [&positions](uint64_t first, uint64_t second) { return positions[first] < positions[second]; });
+        span += positions[*minMax.second] - positions[*minMax.first];
+    }
+    return span;
+}
+}  // namespace
+
+std::vector<storm::expressions::Variable> computeForceVariableOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                                    std::vector<std::set<storm::expressions::Variable>> const& hyperedges,
+                                                                    uint64_t maximalIterations) {
+    std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndex;
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        variableToIndex.emplace(variables[index], index);
+    }
+
+    // Translate the hyperedges to variable indices. Hyperedges with less than two variables do not influence the order.
+    std::vector<std::vector<uint64_t>> indexHyperedges;
+    std::vector<std::vector<uint64_t>> variableToHyperedges(variables.size());
+    for (auto const& hyperedge : hyperedges) {
+        std::vector<uint64_t> indexHyperedge;
+        for (auto const& variable : hyperedge) {
+            auto it = variableToIndex.find(variable);
+            if (it != variableToIndex.end()) {
+                indexHyperedge.push_back(it->second);
+            }
+        }
+        if (indexHyperedge.size() > 1) {
+            for (auto const& variableIndex : indexHyperedge) {
+                variableToHyperedges[variableIndex].push_back(indexHyperedges.size());
+            }
+            indexHyperedges.push_back(std::move(indexHyperedge));
+        }
+    }
+    if (indexHyperedges.empty()) {
+        return variables;
+    }
+
+    // positions[i] is the position of variable i and order[p] the variable at position p.
+    std::vector<uint64_t> order(variables.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<uint64_t> positions = order;
+    std::vector<uint64_t> bestOrder = order;
+    uint64_t bestSpan = computeSpan(indexHyperedges, positions);
+    STORM_LOG_TRACE("Initial span of variable order is " << bestSpan << ".");
+
+    std::vector<double> centersOfGravity(indexHyperedges.size());
+    std::vector<double> tentativePositions(variables.size());
+    for (uint64_t iteration = 0; iteration < maximalIterations; ++iteration) {
+        for (uint64_t edgeIndex = 0; edgeIndex < indexHyperedges.size(); ++edgeIndex) {
+            double sum = 0;
+            for (auto const& variableIndex : indexHyperedges[edgeIndex]) {
+                sum += positions[variableIndex];
+            }
+            centersOfGravity[edgeIndex] = sum / indexHyperedges[edgeIndex].size();
+        }
+        for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+            if (variableToHyperedges[variableIndex].empty()) {
+                tentativePositions[variableIndex] = positions[variableIndex];
+            } else {
+                double sum = 0;
+                for (auto const& edgeIndex : variableToHyperedges[variableIndex]) {
+                    sum += centersOfGravity[edgeIndex];
+                }
+                tentativePositions[variableIndex] = sum / variableToHyperedges[variableIndex].size();
+            }
+        }
+
+        // Ties are broken by the current positions to keep the procedure deterministic.
+        std::sort(order.begin(), order.end(), [&](uint64_t first, uint64_t second) {
+            return tentativePositions[first] < tentativePositions[second] ||
+                   (tentativePositions[first] == tentativePositions[second] && positions[first] < positions[second]);
+        });
+        for (uint64_t position = 0; position < order.size(); ++position) {
+            positions[order[position]] = position;
+        }
+
+        uint64_t span = computeSpan(indexHyperedges, positions);
+        STORM_LOG_TRACE("Span of variable order after iteration " << iteration << " is " << span << ".");
+        if (span >= bestSpan) {
+            break;
+        }
+        bestSpan = span;
+        bestOrder = order;
+    }
+
+    std::vector<storm::expressions::Variable> result;
+    result.reserve(variables.size());
+    for (auto const& variableIndex : bestOrder) {
+        result.push_back(variables[variableIndex]);
+    }
+    return result;
+}
+
+namespace {
+void addVariables(storm::expressions::Expression const& expression, std::set<storm::expressions::Variable>& variables) {
+    std::set<storm::expressions::Variable> expressionVariables = expression.getVariables();
+    variables.insert(expressionVariables.begin(), expressionVariables.end());
+}
+}  // namespace
+
+std::vector<storm::expressions::Variable> getDdVariableOrder(storm::prism::Program const& program, DdVariableOrdering ordering) {
+    std::vector<storm::expressions::Variable> variables;
+    for (auto const& integerVariable : program.getGlobalIntegerVariables()) {
+        variables.push_back(integerVariable.getExpressionVariable());
+    }
+    for (auto const& booleanVariable : program.getGlobalBooleanVariables()) {
+        variables.push_back(booleanVariable.getExpressionVariable());
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& integerVariable : module.getIntegerVariables()) {
+            variables.push_back(integerVariable.getExpressionVariable());
+        }
+        for (auto const& booleanVariable : module.getBooleanVariables()) {
+            variables.push_back(booleanVariable.getExpressionVariable());
+        }
+    }
+    if (ordering == DdVariableOrdering::Declaration) {
+        return variables;
+    }
+
+    std::vector<std::set<storm::expressions::Variable>> hyperedges;
+    std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariables;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            std::set<storm::expressions::Variable> commandVariables;
+            addVariables(command.getGuardExpression(), commandVariables);
+            for (auto const& update : command.getUpdates()) {
+                addVariables(update.getLikelihoodExpression(), commandVariables);
+                for (auto const& assignment : update.getAssignments()) {
+                    commandVariables.insert(assignment.getVariable());
+                    addVariables(assignment.getExpression(), commandVariables);
+                }
+            }
+            if (command.isLabeled()) {
+                actionToVariables[command.getActionIndex()].insert(commandVariables.begin(), commandVariables.end());
+            }
+            hyperedges.push_back(std::move(commandVariables));
+        }
+    }
+    for (auto& actionVariables : actionToVariables) {
+        hyperedges.push_back(std::move(actionVariables.second));
+    }
+
+    return computeForceVariableOrder(variables, hyperedges);
+}
+
+std::vector<storm::expressions::Variable> getDdVariableOrder(storm::jani::Model const& model, DdVariableOrdering ordering) {
+    // Location variables are ordered by the names of their automata.
+    std::map<std::string, storm::expressions::Variable> automatonToLocationVariable;
+    for (auto const& automaton : model.getAutomata()) {
+        automatonToLocationVariable.emplace(automaton.getName(), automaton.getLocationExpressionVariable());
+    }
+    std::vector<storm::expressions::Variable> variables;
+    for (auto const& locationVariable : automatonToLocationVariable) {
+        variables.push_back(locationVariable.second);
+    }
+    for (auto const& variable : model.getGlobalVariables()) {
+        if (!variable.isTransient()) {
+            variables.push_back(variable.getExpressionVariable());
+        }
+    }
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& variable : automaton.getVariables()) {
+            if (!variable.isTransient()) {
+                variables.push_back(variable.getExpressionVariable());
+            }
+        }
+    }
+    if (ordering == DdVariableOrdering::Declaration) {
+        return variables;
+    }
+
+    std::vector<std::set<storm::expressions::Variable>> hyperedges;
+    std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariables;
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& edge : automaton.getEdges()) {
+            std::set<storm::expressions::Variable> edgeVariables = {automaton.getLocationExpressionVariable()};
+            addVariables(edge.getGuard(), edgeVariables);
+            for (auto const& destination : edge.getDestinations()) {
+                addVariables(destination.getProbability(), edgeVariables);
+                for (auto const& assignment : destination.getOrderedAssignments()) {
+                    if (assignment.lValueIsVariable()) {
+                        edgeVariables.insert(assignment.getExpressionVariable());
+                    }
+                    addVariables(assignment.getAssignedExpression(), edgeVariables);
+                }
+            }
+            if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                actionToVariables[edge.getActionIndex()].insert(edgeVariables.begin(), edgeVariables.end());
+            }
+            hyperedges.push_back(std::move(edgeVariables));
+        }
+    }
+    for (auto& actionVariables : actionToVariables) {
+        hyperedges.push_back(std::move(actionVariables.second));
+    }
+
+    return computeForceVariableOrder(variables, hyperedges);
+}
+
+}  // namespace builder
+}  // namespace storm
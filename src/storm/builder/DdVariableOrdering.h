@@ -0,0 +1,62 @@
+#pragma once
+
+#include <ostream>
+#include <set>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+// An enum that contains all supported heuristics to order the variables of the decision diagrams built for a model.
+enum class DdVariableOrdering { Declaration, Force };
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering);
+
+/*!
+ * Computes an order of the given variables with the FORCE heuristic (Aloul, Markov, Sakallah: "FORCE: A Fast and Easy-To-Implement
+ * Variable-Ordering Heuristic", GLSVLSI 2003). The heuristic iteratively moves each variable to the average center of gravity of the
+ * hyperedges it belongs to and thereby reduces the total span of the hyperedges. Variables that interact are thus placed close to
+ * each other, which typically keeps decision diagrams of transition relations small.
+ *
+ * @param variables The variables in their initial order.
+ * @param hyperedges Sets of variables that interact with each other. Variables not contained in the given variables are ignored.
+ * @param maximalIterations The maximal number of iterations of the heuristic.
+ * @return The variables in the computed order.
+ */
+std::vector<storm::expressions::Variable> computeForceVariableOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                                    std::vector<std::set<storm::expressions::Variable>> const& hyperedges,
+                                                                    uint64_t maximalIterations = 50);
+
+/*!
+ * Retrieves the order in which DD variables are to be created for the (global and module) variables of the given program.
+ * For the FORCE heuristic, every command yields a hyperedge of the variables it reads or writes and every synchronizing action yields
+ * a hyperedge of all variables of the commands labeled with it.
+ *
+ * @param program The program.
+ * @param ordering The ordering heuristic to use.
+ * @return The variables of the program in the order in which DD variables are to be created.
+ */
+std::vector<storm::expressions::Variable> getDdVariableOrder(storm::prism::Program const& program, DdVariableOrdering ordering);
+
+/*!
+ * Retrieves the order in which DD variables are to be created for the non-transient (global and automaton) variables and the location
+ * variables of the given model. For the FORCE heuristic, every edge yields a hyperedge of the location variable of its automaton and the
+ * variables it reads or writes. Every action yields a hyperedge of all variables of the edges labeled with it.
+ *
+ * @param model The JANI model.
+ * @param ordering The ordering heuristic to use.
+ * @return The variables of the model in the order in which DD variables are to be created.
+ */
+std::vector<storm::expressions::Variable> getDdVariableOrder(storm::jani::Model const& model, DdVariableOrdering ordering);
+
+}  // namespace builder
+}  // namespace storm
@@ -172,6 +172,9 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint64_t numberOfExploredStates = 0;
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
 
+    // The behavior of the current state. It is reused for all states, so the storage of its choices is only allocated once.
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+
     // Perform a search through the model.
     while (!statesToExplore.empty()) {
         // Get the first state in the queue.
@@ -193,7 +196,7 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
-        storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+        generator->expand(stateToIdCallback, behavior);
 
         // If there is no behavior, we might have to introduce a self-loop.
         if (behavior.empty()) {
@@ -43,6 +43,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
     if (multiobjectiveSettings.isMaxStepsSet()) {
         maxSteps = multiobjectiveSettings.getMaxSteps();
     }
+    batchSize = multiobjectiveSettings.getBatchSize();
     if (multiobjectiveSettings.hasSchedulerRestriction()) {
         schedulerRestriction = multiobjectiveSettings.getSchedulerRestriction();
     }
@@ -165,6 +166,15 @@ void MultiObjectiveModelCheckerEnvironment::unsetMaxSteps() {
     maxSteps = boost::none;
 }
 
+uint64_t const& MultiObjectiveModelCheckerEnvironment::getBatchSize() const {
+    return batchSize;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setBatchSize(uint64_t const& value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The batch size must be positive.");
+    batchSize = value;
+}
+
 bool MultiObjectiveModelCheckerEnvironment::isSchedulerRestrictionSet() const {
     return schedulerRestriction.is_initialized();
 }
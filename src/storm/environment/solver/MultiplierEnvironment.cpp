@@ -11,6 +11,7 @@ MultiplierEnvironment::MultiplierEnvironment() {
     auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
     type = multiplierSettings.getMultiplierType();
     typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+    parallel = false;
 }
 
 MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +31,12 @@ void MultiplierEnvironment::setType(storm::solver::MultiplierType value, bool is
     typeSetFromDefault = isSetFromDefault;
 }
 
+bool const& MultiplierEnvironment::isParallel() const {
+    return parallel;
+}
+
+void MultiplierEnvironment::setParallel(bool value) {
+    parallel = value;
+}
+
 }  // namespace storm
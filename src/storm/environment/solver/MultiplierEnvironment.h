@@ -14,8 +14,15 @@ class MultiplierEnvironment {
     bool const& isTypeSetFromDefault() const;
     void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
 
+    /*!
+     * Whether the matrix-vector multiplications may be parallelized (if Storm is built with TBB).
+     */
+    bool const& isParallel() const;
+    void setParallel(bool value);
+
    private:
     storm::solver::MultiplierType type;
     bool typeSetFromDefault;
+    bool parallel;
 };
 }  // namespace storm
@@ -178,4 +178,12 @@ void SolverEnvironment::setLinearEquationSolverPrecision(boost::optional<storm::
         // gmm, eigen, elimination, and topological solvers do not have a precision
     }
 }
+
+storm::solver::IterationTelemetryCallback const& SolverEnvironment::getIterationTelemetryCallback() const {
+    return iterationTelemetryCallback;
+}
+
+void SolverEnvironment::setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback) {
+    iterationTelemetryCallback = callback;
+}
 }  // namespace storm
@@ -6,6 +6,7 @@
 #include "storm/adapters/RationalNumberForward.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/SubEnvironment.h"
+#include "storm/solver/IterationTelemetry.h"
 #include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
@@ -62,6 +63,13 @@ class SolverEnvironment {
     void setLinearEquationSolverPrecision(boost::optional<storm::RationalNumber> const& newPrecision,
                                           boost::optional<bool> const& relativePrecision = boost::none);
 
+    /*!
+     * Retrieves the callback that is invoked after each iteration of value iteration, interval iteration, sound value iteration and optimistic value
+     * iteration. If no callback is set, the returned function is empty.
+     */
+    storm::solver::IterationTelemetryCallback const& getIterationTelemetryCallback() const;
+    void setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback);
+
    private:
     SubEnvironment<EigenSolverEnvironment> eigenSolverEnvironment;
     SubEnvironment<GmmxxSolverEnvironment> gmmxxSolverEnvironment;
@@ -78,5 +86,6 @@ class SolverEnvironment {
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
     bool forceExact;
+    storm::solver::IterationTelemetryCallback iterationTelemetryCallback;
 };
 }  // namespace storm
@@ -45,6 +45,18 @@ void Choice<ValueType, StateType>::add(Choice const& other) {
     }
 }
 
+template<typename ValueType, typename StateType>
+void Choice<ValueType, StateType>::reset(uint_fast64_t actionIndex, bool markovian) {
+    this->markovian = markovian;
+    this->actionIndex = actionIndex;
+    this->distribution.clear();
+    this->totalMass = storm::utility::zero<ValueType>();
+    this->rewards.clear();
+    this->originData = boost::none;
+    this->labels = boost::none;
+    this->playerIndex = boost::none;
+}
+
 template<typename ValueType, typename StateType>
 StateType Choice<ValueType, StateType>::sampleFromDistribution(ValueType const& quantile) const {
     return distribution.sampleFromDistribution(quantile);
@@ -30,6 +30,12 @@ struct Choice {
      */
     void add(Choice const& other);
 
+    /*!
+     * Resets this choice to an empty choice with the given action index. In contrast to creating a new choice, the storage that was allocated
+     * for the distribution and the rewards is kept, so resetting and refilling a choice does not need to allocate memory.
+     */
+    void reset(uint_fast64_t actionIndex = 0, bool markovian = false);
+
     /**
      * Given a value q, find the event in the ordered distribution that corresponds to this prob.
      * Example: Given a (sub)distribution { x -> 0.4, y -> 0.3, z -> 0.2 },
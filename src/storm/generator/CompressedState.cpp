@@ -8,6 +8,7 @@
 #include "storm/exceptions/NotImplementedException.h"
 
 #include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/BatchExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/SimpleValuation.h"
@@ -34,6 +35,42 @@ void unpackStateIntoEvaluator(CompressedState const& state, VariableInformation
     }
 }
 
+std::vector<uint64_t> getBatchColumnIndices(VariableInformation const& variableInformation, storm::expressions::BatchExpressionEvaluator& evaluator) {
+    std::vector<uint64_t> result;
+    result.reserve(variableInformation.locationVariables.size() + variableInformation.booleanVariables.size() +
+                   variableInformation.integerVariables.size());
+    for (auto const& locationVariable : variableInformation.locationVariables) {
+        result.push_back(evaluator.getColumnIndex(locationVariable.variable));
+    }
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        result.push_back(evaluator.getColumnIndex(booleanVariable.variable));
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        result.push_back(evaluator.getColumnIndex(integerVariable.variable));
+    }
+    return result;
+}
+
+void unpackStateIntoBatch(CompressedState const& state, VariableInformation const& variableInformation, std::vector<uint64_t> const& columnIndices,
+                          storm::expressions::BatchExpressionEvaluator& evaluator, uint64_t index) {
+    auto columnIt = columnIndices.begin();
+    for (auto const& locationVariable : variableInformation.locationVariables) {
+        double value = locationVariable.bitWidth != 0 ? static_cast<double>(state.getAsInt(locationVariable.bitOffset, locationVariable.bitWidth)) : 0.0;
+        evaluator.setValue(*columnIt, index, value);
+        ++columnIt;
+    }
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        evaluator.setValue(*columnIt, index, state.get(booleanVariable.bitOffset) ? 1.0 : 0.0);
+        ++columnIt;
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        evaluator.setValue(*columnIt, index,
+                           static_cast<double>(static_cast<int_fast64_t>(state.getAsInt(integerVariable.bitOffset, integerVariable.bitWidth)) +
+                                               integerVariable.lowerBound));
+        ++columnIt;
+    }
+}
+
 storm::expressions::SimpleValuation unpackStateIntoValuation(CompressedState const& state, VariableInformation const& variableInformation,
                                                              storm::expressions::ExpressionManager const& manager) {
     storm::expressions::SimpleValuation result(manager.getSharedPointer());
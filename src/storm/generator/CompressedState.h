@@ -3,6 +3,7 @@
 
 #include <map>
 #include <unordered_map>
+#include <vector>
 #include "storm/adapters/JsonForward.h"
 #include "storm/storage/BitVector.h"
 
@@ -11,6 +12,7 @@ namespace expressions {
 template<typename ValueType>
 class ExpressionEvaluator;
 
+class BatchExpressionEvaluator;
 class ExpressionManager;
 class SimpleValuation;
 class Variable;
@@ -33,6 +35,27 @@ template<typename ValueType>
 void unpackStateIntoEvaluator(CompressedState const& state, VariableInformation const& variableInformation,
                               storm::expressions::ExpressionEvaluator<ValueType>& evaluator);
 
+/*!
+ * Retrieves the columns of the batch evaluator that hold the values of the variables. The columns are ordered as the location, boolean and integer
+ * variables of the variable information.
+ *
+ * @param variableInformation The information about how the variables are packed within the state.
+ * @param evaluator The evaluator that holds the columns.
+ */
+std::vector<uint64_t> getBatchColumnIndices(VariableInformation const& variableInformation, storm::expressions::BatchExpressionEvaluator& evaluator);
+
+/*!
+ * Unpacks the compressed state into the valuation with the given index of the batch evaluator.
+ *
+ * @param state The state to unpack.
+ * @param variableInformation The information about how the variables are packed within the state.
+ * @param columnIndices The columns of the variables as retrieved by getBatchColumnIndices.
+ * @param evaluator The evaluator into which to load the state.
+ * @param index The index of the valuation within the batch.
+ */
+void unpackStateIntoBatch(CompressedState const& state, VariableInformation const& variableInformation, std::vector<uint64_t> const& columnIndices,
+                          storm::expressions::BatchExpressionEvaluator& evaluator, uint64_t index);
+
 /*!
  * Converts the compressed state into an explicit representation in the form of a valuation.
  *
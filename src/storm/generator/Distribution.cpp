@@ -1,33 +1,48 @@
 #include "storm/generator/Distribution.h"
 
+#include <algorithm>
+#include <functional>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/BitVector.h"
+#include "storm/utility/macros.h"
 
 namespace storm::generator {
 
+namespace {
+// The minimal number of slots of the hash table. Most distributions are small, so they never need to grow the table.
+uint64_t const minimalNumberOfSlots = 16;
+}  // namespace
+
 template<typename IndexType, typename ValueType>
-Distribution<IndexType, ValueType>::Distribution() : compressed(true) {
+Distribution<IndexType, ValueType>::Distribution() : slotShift(64), compressed(true) {
     // Intentionally left empty.
 }
 
 template<typename IndexType, typename ValueType>
 Distribution<IndexType, ValueType>::Distribution(Distribution<IndexType, ValueType> const& other) {
     this->storage = other.storage;
+    this->slots = other.slots;
+    this->slotShift = other.slotShift;
     this->compressed = other.compressed;
 }
 
 template<typename IndexType, typename ValueType>
 Distribution<IndexType, ValueType>::Distribution(Distribution<IndexType, ValueType>&& other) {
     this->storage = std::move(other.storage);
+    this->slots = std::move(other.slots);
+    this->slotShift = other.slotShift;
     this->compressed = other.compressed;
-    other.compressed = true;
+    other.clear();
 }
 
 template<typename IndexType, typename ValueType>
 Distribution<IndexType, ValueType>& Distribution<IndexType, ValueType>::operator=(Distribution<IndexType, ValueType> const& other) {
     if (this != &other) {
         this->storage = other.storage;
+        this->slots = other.slots;
+        this->slotShift = other.slotShift;
         this->compressed = other.compressed;
     }
     return *this;
@@ -37,28 +52,41 @@ template<typename IndexType, typename ValueType>
 Distribution<IndexType, ValueType>& Distribution<IndexType, ValueType>::operator=(Distribution<IndexType, ValueType>&& other) {
     if (this != &other) {
         this->storage = std::move(other.storage);
+        this->slots = std::move(other.slots);
+        this->slotShift = other.slotShift;
         this->compressed = other.compressed;
-        other.compressed = true;
+        other.clear();
     }
     return *this;
 }
 
 template<typename IndexType, typename ValueType>
 void Distribution<IndexType, ValueType>::add(DistributionEntry<IndexType, ValueType> const& entry) {
-    storage.push_back(entry);
-    compressed &= storage.back().getState() < entry.getState();
+    add(entry.getState(), entry.getValue());
 }
 
 template<typename IndexType, typename ValueType>
 void Distribution<IndexType, ValueType>::add(IndexType const& index, ValueType const& value) {
-    storage.emplace_back(index, value);
-    compressed &= storage.back().getState() < index;
+    // Keep the load factor of the hash table at most one half.
+    if (2 * (storage.size() + 1) > slots.size()) {
+        rehash(std::max(minimalNumberOfSlots, 2 * slots.size()));
+    }
+    uint64_t slot = findSlot(index);
+    if (slots[slot] != 0) {
+        storage[slots[slot] - 1].addToValue(value);
+    } else {
+        compressed &= storage.empty() || storage.back().getState() < index;
+        storage.emplace_back(index, value);
+        slots[slot] = storage.size();
+    }
 }
 
 template<typename IndexType, typename ValueType>
 void Distribution<IndexType, ValueType>::add(Distribution&& distribution) {
-    storage.insert(storage.end(), std::make_move_iterator(distribution.begin()), std::make_move_iterator(distribution.end()));
-    compressed = false;
+    for (auto const& entry : distribution) {
+        add(entry);
+    }
+    distribution.clear();
 }
 
 template<typename IndexType, typename ValueType>
@@ -67,30 +95,37 @@ void Distribution<IndexType, ValueType>::compress() {
         std::sort(storage.begin(), storage.end(), [](DistributionEntry<IndexType, ValueType> const& a, DistributionEntry<IndexType, ValueType> const& b) {
             return a.getState() < b.getState();
         });
-
-        // Code taken from std::unique and modified to fit needs.
-        auto first = storage.begin();
-        auto last = storage.end();
-
-        if (first != last) {
-            auto result = first;
-            while (++first != last) {
-                if (!(result->getState() == first->getState())) {
-                    if (++result != first) {
-                        *result = std::move(*first);
-                    }
-                } else {
-                    result->addToValue(first->getValue());
-                }
-            }
-            ++result;
-
-            storage.resize(std::distance(storage.begin(), result));
-        }
+        // The positions of the entries changed, so the hash table needs to be rebuilt.
+        rehash(slots.size());
         compressed = true;
     }
 }
 
+template<typename IndexType, typename ValueType>
+uint64_t Distribution<IndexType, ValueType>::findSlot(IndexType const& index) const {
+    // Multiplicative (Fibonacci) hashing spreads consecutive indices over the table.
+    uint64_t slot = (static_cast<uint64_t>(std::hash<IndexType>()(index)) * 0x9E3779B97F4A7C15ull) >> slotShift;
+    uint64_t mask = slots.size() - 1;
+    while (slots[slot] != 0 && !(storage[slots[slot] - 1].getState() == index)) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template<typename IndexType, typename ValueType>
+void Distribution<IndexType, ValueType>::rehash(uint64_t numberOfSlots) {
+    STORM_LOG_ASSERT((numberOfSlots & (numberOfSlots - 1)) == 0, "Number of slots must be a power of two.");
+    slots.assign(numberOfSlots, 0);
+    slotShift = 64;
+    while (numberOfSlots > 1) {
+        --slotShift;
+        numberOfSlots >>= 1;
+    }
+    for (uint64_t position = 0; position < storage.size(); ++position) {
+        slots[findSlot(storage[position].getState())] = position + 1;
+    }
+}
+
 template<typename IndexType, typename ValueType>
 void Distribution<IndexType, ValueType>::divide(ValueType const& value) {
     for (auto& entry : storage) {
@@ -101,6 +136,7 @@ void Distribution<IndexType, ValueType>::divide(ValueType const& value) {
 template<typename IndexType, typename ValueType>
 void Distribution<IndexType, ValueType>::clear() {
     this->storage.clear();
+    std::fill(this->slots.begin(), this->slots.end(), 0);
     this->compressed = true;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "storm/generator/DistributionEntry.h"
@@ -19,12 +20,12 @@ class Distribution {
     Distribution& operator=(Distribution&&);
 
     /*!
-     * Adds the given entry to the distribution.
+     * Adds the given entry to the distribution. If there already is an entry for the same index, the value is added to it.
      */
     void add(DistributionEntry<IndexType, ValueType> const& entry);
 
     /*!
-     * Adds the given entry to the distribution.
+     * Adds the given entry to the distribution. If there already is an entry for the same index, the value is added to it.
      */
     void add(IndexType const& index, ValueType const& value);
 
@@ -34,8 +35,8 @@ class Distribution {
     void add(Distribution&& distribution);
 
     /*!
-     * Compresses the internal storage by summing the values of entries which agree on the index. As a side
-     * effect, this sorts the entries in the distribution by their index.
+     * Sorts the entries in the distribution by their index. Since values of entries that agree on the index are already summed when they
+     * are added, this yields the same result as summing them and sorting afterwards.
      */
     void compress();
 
@@ -45,14 +46,13 @@ class Distribution {
     void divide(ValueType const& value);
 
     /*!
-     * Clears this distribution.
+     * Clears this distribution. The allocated storage is kept, so the distribution can be refilled cheaply.
      */
     void clear();
 
     /*!
-     * Access to iterators over the entries of the distribution. Note that there may be multiple entries for
-     * the same index. Also, no order is guaranteed. After a call to compress, the order is guaranteed to be
-     * ascending wrt. index and there are no elements with the same index.
+     * Access to iterators over the entries of the distribution. There are no elements with the same index, but no order is guaranteed.
+     * After a call to compress, the order is guaranteed to be ascending wrt. index.
      */
     typename ContainerType::iterator begin();
     typename ContainerType::const_iterator begin() const;
@@ -60,9 +60,28 @@ class Distribution {
     typename ContainerType::const_iterator end() const;
 
    private:
+    /*!
+     * Retrieves the slot of the hash table that refers to the entry with the given index or, if there is no such entry, the empty slot at
+     * which such an entry is to be inserted.
+     */
+    uint64_t findSlot(IndexType const& index) const;
+
+    /*!
+     * Rebuilds the hash table with the given number of slots (which must be a power of two).
+     */
+    void rehash(uint64_t numberOfSlots);
+
     // The underlying storage of the distribution.
     ContainerType storage;
 
+    // A hash table (with open addressing and linear probing) that maps indices to the position of their entry in the storage. Slots hold
+    // the position plus one, so that zero marks an empty slot.
+    std::vector<uint64_t> slots;
+
+    // The number of bits that the hash of an index is shifted to obtain a slot.
+    uint64_t slotShift;
+
+    // Whether the entries are sorted by their index.
     bool compressed;
 };
 
@@ -629,10 +629,17 @@ void JaniNextStateGenerator<ValueType, StateType>::addStateValuation(storm::stor
 
 template<typename ValueType, typename StateType>
 StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+    StateBehavior<ValueType, StateType> result;
+    expand(stateToIdCallback, result);
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback, StateBehavior<ValueType, StateType>& result) {
     // The evaluator should have the default values of the transient variables right now.
 
     // Prepare the result, in case we return early.
-    StateBehavior<ValueType, StateType> result;
+    result.clear();
 
     // Retrieve the locations from the state.
     std::vector<uint64_t> locations = getLocations(*this->state);
@@ -650,7 +657,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
             if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
                 // Set back transient variables to default values so we are ready to process the next state
                 this->transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
-                return result;
+                return;
             }
         }
     }
@@ -660,28 +667,28 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
 
     // Get all choices for the state.
     result.setExpanded();
-    std::vector<Choice<ValueType>> allChoices;
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
-        allChoices = getActionChoices(locations, *this->state, stateToIdCallback, EdgeFilter::WithoutRate);
-        if (allChoices.empty()) {
+        addActionChoices(result, locations, *this->state, stateToIdCallback, EdgeFilter::WithoutRate);
+        if (result.empty()) {
             // Expand the Markovian edges if there are no probabilistic ones.
-            allChoices = getActionChoices(locations, *this->state, stateToIdCallback, EdgeFilter::WithRate);
+            addActionChoices(result, locations, *this->state, stateToIdCallback, EdgeFilter::WithRate);
         }
     } else {
-        allChoices = getActionChoices(locations, *this->state, stateToIdCallback);
+        addActionChoices(result, locations, *this->state, stateToIdCallback);
     }
-    std::size_t totalNumberOfChoices = allChoices.size();
+    std::size_t totalNumberOfChoices = result.getNumberOfChoices();
 
     // If there is not a single choice, we return immediately, because the state has no behavior (other than
     // the state reward).
     if (totalNumberOfChoices == 0) {
-        return result;
+        return;
     }
 
     // If the model is a deterministic model, we need to fuse the choices into one.
     if (this->isDeterministicModel() && totalNumberOfChoices > 1) {
-        Choice<ValueType> globalChoice;
+        Choice<ValueType, StateType>& globalChoice = fusedChoice;
+        globalChoice.reset();
 
         if (this->options.isAddOverlappingGuardLabelSet()) {
             this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
@@ -692,7 +699,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
         ValueType totalExitRate = this->isDiscreteTimeModel() ? static_cast<ValueType>(totalNumberOfChoices) : storm::utility::zero<ValueType>();
 
         // Iterate over all choices and combine the probabilities/rates into one choice.
-        for (auto const& choice : allChoices) {
+        for (auto const& choice : result) {
             for (auto const& stateProbabilityPair : choice) {
                 if (this->isDiscreteTimeModel()) {
                     globalChoice.addProbability(stateProbabilityPair.first, stateProbabilityPair.second / totalNumberOfChoices);
@@ -707,7 +714,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
         }
 
         std::vector<ValueType> stateActionRewards(rewardExpressions.size(), storm::utility::zero<ValueType>());
-        for (auto const& choice : allChoices) {
+        for (auto const& choice : result) {
             if (hasStateActionRewards) {
                 for (uint_fast64_t rewardVariableIndex = 0; rewardVariableIndex < rewardExpressions.size(); ++rewardVariableIndex) {
                     stateActionRewards[rewardVariableIndex] += choice.getRewards()[rewardVariableIndex] * choice.getTotalMass() / totalExitRate;
@@ -721,31 +728,26 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
         globalChoice.addRewards(std::move(stateActionRewards));
 
         // Move the newly fused choice in place.
-        allChoices.clear();
-        allChoices.push_back(std::move(globalChoice));
-    }
-
-    // Move all remaining choices in place.
-    for (auto& choice : allChoices) {
-        result.addChoice(std::move(choice));
+        result.truncateChoices(0);
+        result.addChoice(std::move(globalChoice));
     }
 
     this->postprocess(result);
-
-    return result;
 }
 
 template<typename ValueType, typename StateType>
-Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex,
-                                                                                           uint64_t automatonIndex, CompressedState const& state,
-                                                                                           StateToIdCallback stateToIdCallback) {
+Choice<ValueType, StateType>& JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(StateBehavior<ValueType, StateType>& behavior,
+                                                                                                       storm::jani::Edge const& edge,
+                                                                                                       uint64_t outputActionIndex, uint64_t automatonIndex,
+                                                                                                       CompressedState const& state,
+                                                                                                       StateToIdCallback stateToIdCallback) {
     // Determine the exit rate if it's a Markovian edge.
     boost::optional<ValueType> exitRate = boost::none;
     if (edge.hasRate()) {
         exitRate = this->evaluator->asRational(edge.getRate());
     }
 
-    Choice<ValueType> choice(edge.getActionIndex(), static_cast<bool>(exitRate));
+    Choice<ValueType, StateType>& choice = behavior.addChoice(edge.getActionIndex(), static_cast<bool>(exitRate));
     std::vector<ValueType> stateActionRewards;
 
     // Perform the transient edge assignments and create the state action rewards
@@ -958,7 +960,7 @@ void JaniNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribut
 template<typename ValueType, typename StateType>
 void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombination(AutomataEdgeSets const& edgeCombination, uint64_t outputActionIndex,
                                                                                       CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                                                      std::vector<Choice<ValueType>>& newChoices) {
+                                                                                      StateBehavior<ValueType, StateType>& behavior) {
     if (this->options.isExplorationChecksSet()) {
         // Check whether a global variable is written multiple times in any combination.
         checkGlobalVariableWritesValid(edgeCombination);
@@ -971,7 +973,7 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
         iteratorList[i] = edgeCombination[i].second.cbegin();
     }
 
-    storm::generator::Distribution<StateType, ValueType> distribution;
+    storm::generator::Distribution<StateType, ValueType>& distribution = synchronizedDistribution;
 
     // As long as there is one feasible combination of commands, keep on expanding it.
     bool done = false;
@@ -988,10 +990,8 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
         // At this point, we applied all commands of the current command combination and newTargetStates
         // contains all target states and their respective probabilities. That means we are now ready to
         // add the choice to the list of transitions.
-        newChoices.emplace_back(outputActionIndex);
-
         // Now create the actual distribution.
-        Choice<ValueType>& choice = newChoices.back();
+        Choice<ValueType, StateType>& choice = behavior.addChoice(outputActionIndex);
 
         // Add the edge indices if requested.
         if (this->getOptions().isBuildChoiceOriginsSet()) {
@@ -1036,11 +1036,9 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
 }
 
 template<typename ValueType, typename StateType>
-std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::getActionChoices(std::vector<uint64_t> const& locations,
-                                                                                              CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                                                              EdgeFilter const& edgeFilter) {
-    std::vector<Choice<ValueType>> result;
-
+void JaniNextStateGenerator<ValueType, StateType>::addActionChoices(StateBehavior<ValueType, StateType>& behavior, std::vector<uint64_t> const& locations,
+                                                                    CompressedState const& state, StateToIdCallback stateToIdCallback,
+                                                                    EdgeFilter const& edgeFilter) {
     // To avoid reallocations, we declare some memory here here.
     // This vector will store for each automaton the set of edges with the current output and the current source location
     std::vector<EdgeSetWithIndices const*> edgeSetsMemory;
@@ -1067,14 +1065,14 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                         continue;
                     }
 
-                    result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second,
-                                                                outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
-                                                                automatonIndex, state, stateToIdCallback));
+                    auto& choice = expandNonSynchronizingEdge(behavior, *indexAndEdge.second,
+                                                              outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
+                                                              automatonIndex, state, stateToIdCallback);
 
                     if (this->getOptions().isBuildChoiceOriginsSet()) {
                         auto modelAutomatonIndex = model.getAutomatonIndex(parallelAutomata[automatonIndex].get().getName());
                         EdgeIndexSet edgeIndex{model.encodeAutomatonAndEdgeIndices(automatonIndex, indexAndEdge.first)};
-                        result.back().addOriginData(boost::any(std::move(edgeIndex)));
+                        choice.addOriginData(boost::any(std::move(edgeIndex)));
                     }
                 }
             }
@@ -1169,13 +1167,11 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                     ++edgeSetIt;
                     ++edgeIteratorIt;
                 }
-                // insert choices in the result vector.
-                expandSynchronizingEdgeCombination(automataEdgeSets, outputActionIndex, state, stateToIdCallback, result);
+                // insert choices in the behavior.
+                expandSynchronizingEdgeCombination(automataEdgeSets, outputActionIndex, state, stateToIdCallback, behavior);
             }
         }
     }
-
-    return result;
 }
 
 template<typename ValueType, typename StateType>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storm/generator/Distribution.h"
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
 
@@ -15,8 +16,6 @@ class EdgeDestination;
 }  // namespace jani
 
 namespace generator {
-template<typename StateType, typename ValueType>
-class Distribution;
 
 template<typename ValueType, typename StateType = uint32_t>
 class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
@@ -49,6 +48,7 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     virtual storm::storage::sparse::StateValuationsBuilder initializeStateValuationsBuilder() const override;
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
+    virtual void expand(StateToIdCallback const& stateToIdCallback, StateBehavior<ValueType, StateType>& result) override;
 
     /// Adds the valuation for the currently loaded state to the given builder
     virtual void addStateValuation(storm::storage::sparse::state_type const& currentStateIndex,
@@ -141,21 +141,24 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
                                                                                    storm::expressions::ExpressionEvaluator<ValueType> const& evaluator) const;
 
     /*!
-     * Retrieves all choices possible from the given state.
+     * Adds all choices possible from the given state.
      *
+     * @param behavior The new choices are added to this behavior.
      * @param locations The current locations of all automata.
      * @param state The state for which to retrieve the silent choices.
      * @param edgeFilter Restricts the kind of edges to be considered.
-     * @return The action choices of the state.
      */
-    std::vector<Choice<ValueType>> getActionChoices(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                    EdgeFilter const& edgeFilter = EdgeFilter::All);
+    void addActionChoices(StateBehavior<ValueType, StateType>& behavior, std::vector<uint64_t> const& locations, CompressedState const& state,
+                          StateToIdCallback stateToIdCallback, EdgeFilter const& edgeFilter = EdgeFilter::All);
 
     /*!
-     * Retrieves the choice generated by the given edge.
+     * Adds the choice generated by the given edge to the given behavior.
+     *
+     * @return The new choice.
      */
-    Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex,
-                                                 CompressedState const& state, StateToIdCallback stateToIdCallback);
+    Choice<ValueType, StateType>& expandNonSynchronizingEdge(StateBehavior<ValueType, StateType>& behavior, storm::jani::Edge const& edge,
+                                                             uint64_t outputActionIndex, uint64_t automatonIndex, CompressedState const& state,
+                                                             StateToIdCallback stateToIdCallback);
 
     typedef std::vector<std::pair<uint64_t, storm::jani::Edge const*>> EdgeSetWithIndices;
     typedef std::unordered_map<uint64_t, EdgeSetWithIndices> LocationsAndEdges;
@@ -166,7 +169,7 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     typedef std::vector<AutomatonAndEdgeSet> AutomataEdgeSets;
 
     void expandSynchronizingEdgeCombination(AutomataEdgeSets const& edgeCombination, uint64_t outputActionIndex, CompressedState const& state,
-                                            StateToIdCallback stateToIdCallback, std::vector<Choice<ValueType>>& newChoices);
+                                            StateToIdCallback stateToIdCallback, StateBehavior<ValueType, StateType>& behavior);
     void generateSynchronizedDistribution(storm::storage::BitVector const& state, AutomataEdgeSets const& edgeCombination,
                                           std::vector<EdgeSetWithIndices::const_iterator> const& iteratorList,
                                           storm::generator::Distribution<StateType, ValueType>& distribution, std::vector<ValueType>& stateActionRewards,
@@ -231,6 +234,11 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     /// Information about the transient variables of the model.
     TransientVariableInformation<ValueType> transientVariableInformation;
+
+    /// Storage that is reused for all states to avoid allocations: the distribution of a combination of synchronizing edges and the choice
+    /// that combines all choices of a state of a deterministic model.
+    storm::generator::Distribution<StateType, ValueType> synchronizedDistribution;
+    Choice<ValueType, StateType> fusedChoice;
 };
 
 }  // namespace generator
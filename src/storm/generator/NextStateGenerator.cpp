@@ -7,6 +7,7 @@
 
 #include "storm/logic/Formulas.h"
 
+#include "storm/storage/expressions/BatchExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/SimpleValuation.h"
@@ -197,16 +198,62 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
     }
 
     auto const& states = stateStorage.stateToId;
-    for (auto const& stateIndexPair : states) {
-        unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
-        unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
 
+    // For floating point models, labels that only refer to state variables are evaluated for a batch of states at once. All other labels (e.g. the
+    // ones that refer to transient variables of JANI models) are evaluated state by state.
+    uint64_t const maximalBatchSize = 1ull << 14;
+    storm::expressions::BatchExpressionEvaluator batchEvaluator(*expressionManager, std::min<uint64_t>(states.size(), maximalBatchSize));
+    std::vector<std::pair<std::string, storm::expressions::Expression>> batchLabelsAndExpressions;
+    std::vector<std::pair<std::string, storm::expressions::Expression>> singleLabelsAndExpressions;
+    std::vector<uint64_t> batchColumnIndices;
+    if (std::is_same<ValueType, double>::value && states.size() > 0) {
+        // Creating the columns of all state variables is required to check which labels can be evaluated.
+        batchColumnIndices = getBatchColumnIndices(variableInformation, batchEvaluator);
         for (auto const& label : labelsAndExpressions) {
-            // Add label to state, if the corresponding expression is true.
-            if (evaluator->asBool(label.second)) {
-                result.addLabelToState(label.first, stateIndexPair.second);
+            if (batchEvaluator.canEvaluate(label.second)) {
+                batchLabelsAndExpressions.push_back(label);
+            } else {
+                singleLabelsAndExpressions.push_back(label);
             }
         }
+    } else {
+        singleLabelsAndExpressions = labelsAndExpressions;
+    }
+
+    std::vector<StateType> batchStateIds;
+    auto labelBatch = [&]() {
+        batchEvaluator.setBatchSize(batchStateIds.size());
+        for (auto const& label : batchLabelsAndExpressions) {
+            for (auto index : batchEvaluator.asBool(label.second)) {
+                result.addLabelToState(label.first, batchStateIds[index]);
+            }
+        }
+        batchStateIds.clear();
+    };
+
+    for (auto const& stateIndexPair : states) {
+        if (!batchLabelsAndExpressions.empty()) {
+            unpackStateIntoBatch(stateIndexPair.first, variableInformation, batchColumnIndices, batchEvaluator, batchStateIds.size());
+            batchStateIds.push_back(stateIndexPair.second);
+            if (batchStateIds.size() == maximalBatchSize) {
+                labelBatch();
+            }
+        }
+
+        if (!singleLabelsAndExpressions.empty()) {
+            unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+            unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
+
+            for (auto const& label : singleLabelsAndExpressions) {
+                // Add label to state, if the corresponding expression is true.
+                if (evaluator->asBool(label.second)) {
+                    result.addLabelToState(label.first, stateIndexPair.second);
+                }
+            }
+        }
+    }
+    if (!batchStateIds.empty()) {
+        labelBatch();
     }
 
     if (!result.containsLabel("init")) {
@@ -249,6 +296,11 @@ void NextStateGenerator<ValueType, StateType>::unpackTransientVariableValuesInto
     // This method should be overwritten in case there are transient variables (e.g. JANI).
 }
 
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback, StateBehavior<ValueType, StateType>& behavior) {
+    behavior = expand(stateToIdCallback);
+}
+
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::postprocess(StateBehavior<ValueType, StateType>& result) {
     // If the model we build is a Markov Automaton, we postprocess the choices to sum all Markovian choices
@@ -268,7 +320,7 @@ void NextStateGenerator<ValueType, StateType>::postprocess(StateBehavior<ValueTy
 
                     // Swap the choice to the end to indicate it can be removed (if it's not already there).
                     if (index != result.getNumberOfChoices() - 1 - numberOfChoicesToDelete) {
-                        choice = std::move(result.getChoices()[result.getNumberOfChoices() - 1 - numberOfChoicesToDelete]);
+                        std::swap(choice, result.getChoices()[result.getNumberOfChoices() - 1 - numberOfChoicesToDelete]);
                     }
                     ++numberOfChoicesToDelete;
                 } else {
@@ -286,7 +338,7 @@ void NextStateGenerator<ValueType, StateType>::postprocess(StateBehavior<ValueTy
 
         // Finally remove the choices that were added to other Markovian choices.
         if (numberOfChoicesToDelete > 0) {
-            result.getChoices().resize(result.getChoices().size() - numberOfChoicesToDelete);
+            result.truncateChoices(result.getNumberOfChoices() - numberOfChoicesToDelete);
         }
     }
 }
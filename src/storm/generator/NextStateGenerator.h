@@ -101,6 +101,12 @@ class NextStateGenerator {
 
     void load(CompressedState const& state);
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) = 0;
+
+    /*!
+     * Expands the currently loaded state into the given behavior, which is cleared first. Generators may reuse the storage of the choices
+     * that the behavior held before, so passing the same behavior for all states avoids most allocations.
+     */
+    virtual void expand(StateToIdCallback const& stateToIdCallback, StateBehavior<ValueType, StateType>& behavior);
     bool satisfies(storm::expressions::Expression const& expression) const;
 
     /// Adds the valuation for the currently loaded state to the given builder
@@ -281,8 +281,15 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
 
 template<typename ValueType, typename StateType>
 StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
-    // Prepare the result, in case we return early.
     StateBehavior<ValueType, StateType> result;
+    expand(stateToIdCallback, result);
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback, StateBehavior<ValueType, StateType>& result) {
+    // Prepare the result, in case we return early.
+    result.clear();
 
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
@@ -302,7 +309,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     if (!this->terminalStates.empty()) {
         for (auto const& expressionBool : this->terminalStates) {
             if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
-                return result;
+                return;
             }
         }
     }
@@ -310,32 +317,32 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     // Get all choices for the state.
     result.setExpanded();
 
-    std::vector<Choice<ValueType>> allChoices;
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
-        addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
-        if (allChoices.empty()) {
+        addAsynchronousChoices(result, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
+        addSynchronousChoices(result, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
+        if (result.empty()) {
             // Expand the Markovian edges if there are no probabilistic ones.
-            allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
-            addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
+            addAsynchronousChoices(result, *this->state, stateToIdCallback, CommandFilter::Markovian);
+            addSynchronousChoices(result, *this->state, stateToIdCallback, CommandFilter::Markovian);
         }
     } else {
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback);
-        addSynchronousChoices(allChoices, *this->state, stateToIdCallback);
+        addAsynchronousChoices(result, *this->state, stateToIdCallback);
+        addSynchronousChoices(result, *this->state, stateToIdCallback);
     }
 
-    std::size_t totalNumberOfChoices = allChoices.size();
+    std::size_t totalNumberOfChoices = result.getNumberOfChoices();
 
     // If there is not a single choice, we return immediately, because the state has no behavior (other than
     // the state reward).
     if (totalNumberOfChoices == 0) {
-        return result;
+        return;
     }
 
     // If the model is a deterministic model, we need to fuse the choices into one.
     if (this->isDeterministicModel() && totalNumberOfChoices > 1) {
-        Choice<ValueType> globalChoice;
+        Choice<ValueType, StateType>& globalChoice = fusedChoice;
+        globalChoice.reset();
 
         if (this->options.isAddOverlappingGuardLabelSet()) {
             this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
@@ -346,7 +353,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         ValueType totalExitRate = this->isDiscreteTimeModel() ? static_cast<ValueType>(totalNumberOfChoices) : storm::utility::zero<ValueType>();
 
         // Iterate over all choices and combine the probabilities/rates into one choice.
-        for (auto const& choice : allChoices) {
+        for (auto const& choice : result) {
             for (auto const& stateProbabilityPair : choice) {
                 if (this->isDiscreteTimeModel()) {
                     globalChoice.addProbability(stateProbabilityPair.first, stateProbabilityPair.second / totalNumberOfChoices);
@@ -373,7 +380,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
             ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
             if (rewardModel.get().hasStateActionRewards()) {
                 for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                    for (auto const& choice : allChoices) {
+                    for (auto const& choice : result) {
                         if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
                             this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
                             stateActionRewardValue +=
@@ -388,13 +395,13 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
 
         // Move the newly fused choice in place.
-        allChoices.clear();
-        allChoices.push_back(std::move(globalChoice));
+        result.truncateChoices(0);
+        result.addChoice(std::move(globalChoice));
     }
 
     // For SMG we check whether the state has a unique player
-    if (program.getModelType() == storm::prism::Program::ModelType::SMG && allChoices.size() > 1) {
-        auto choiceIt = allChoices.begin();
+    if (program.getModelType() == storm::prism::Program::ModelType::SMG && result.getNumberOfChoices() > 1) {
+        auto choiceIt = result.begin();
         STORM_LOG_ASSERT(choiceIt->hasPlayerIndex(),
                          "State '" << this->stateToString(*this->state)
                                    << "' features a choice without player index.");  // This should have been catched while creating the choice already
@@ -402,7 +409,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         STORM_LOG_ASSERT(statePlayerIndex != storm::storage::INVALID_PLAYER_INDEX,
                          "State '" << this->stateToString(*this->state)
                                    << "' features a choice with invalid player index.");  // This should have been catched while creating the choice already
-        for (++choiceIt; choiceIt != allChoices.end(); ++choiceIt) {
+        for (++choiceIt; choiceIt != result.end(); ++choiceIt) {
             STORM_LOG_ASSERT(choiceIt->hasPlayerIndex(),
                              "State '" << this->stateToString(*this->state)
                                        << "' features a choice without player index.");  // This should have been catched while creating the choice already
@@ -415,14 +422,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
     }
 
-    // Move all remaining choices in place.
-    for (auto& choice : allChoices) {
-        result.addChoice(std::move(choice));
-    }
-
     this->postprocess(result);
-
-    return result;
 }
 
 template<typename ValueType, typename StateType>
@@ -579,11 +579,8 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
 }
 
 template<typename ValueType, typename StateType>
-std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAsynchronousChoices(CompressedState const& state,
-                                                                                                     StateToIdCallback stateToIdCallback,
-                                                                                                     CommandFilter const& commandFilter) {
-    std::vector<Choice<ValueType>> result;
-
+void PrismNextStateGenerator<ValueType, StateType>::addAsynchronousChoices(StateBehavior<ValueType, StateType>& behavior, CompressedState const& state,
+                                                                           StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter) {
     // Iterate over all modules.
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
         storm::prism::Module const& module = program.getModule(i);
@@ -613,8 +610,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
                 continue;
             }
 
-            result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-            Choice<ValueType>& choice = result.back();
+            Choice<ValueType, StateType>& choice = behavior.addChoice(command.getActionIndex(), command.isMarkovian());
 
             // Remember the choice origin only if we were asked to.
             if (this->options.isBuildChoiceOriginsSet()) {
@@ -673,8 +669,6 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
         }
     }
-
-    return result;
 }
 
 template<typename ValueType, typename StateType>
@@ -700,7 +694,7 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
 }
 
 template<typename ValueType, typename StateType>
-void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state,
+void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(StateBehavior<ValueType, StateType>& behavior, CompressedState const& state,
                                                                           StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter) {
     for (uint_fast64_t actionIndex : program.getSynchronizingActionIndices()) {
         if (this->actionMask != nullptr) {
@@ -721,7 +715,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 iteratorList[i] = activeCommandList[i].cbegin();
             }
 
-            storm::generator::Distribution<StateType, ValueType> distribution;
+            storm::generator::Distribution<StateType, ValueType>& distribution = synchronizedDistribution;
 
             // As long as there is one feasible combination of commands, keep on expanding it.
             bool done = false;
@@ -733,10 +727,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 // At this point, we applied all commands of the current command combination and newTargetStates
                 // contains all target states and their respective probabilities. That means we are now ready to
                 // add the choice to the list of transitions.
-                choices.push_back(Choice<ValueType>(actionIndex));
-
-                // Now create the actual distribution.
-                Choice<ValueType>& choice = choices.back();
+                Choice<ValueType, StateType>& choice = behavior.addChoice(actionIndex);
 
                 if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
                     storm::storage::PlayerIndex const& playerOfAction = actionIndexToPlayerIndexMap.at(actionIndex);
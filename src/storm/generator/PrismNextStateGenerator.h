@@ -1,6 +1,7 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include "storm/generator/Distribution.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -8,8 +9,6 @@
 
 namespace storm {
 namespace generator {
-template<typename StateType, typename ValueType>
-class Distribution;
 
 template<typename ValueType, typename StateType = uint32_t>
 class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
@@ -35,6 +34,7 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
+    virtual void expand(StateToIdCallback const& stateToIdCallback, StateBehavior<ValueType, StateType>& result) override;
     bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const&) const;
 
     virtual std::size_t getNumberOfRewardModels() const override;
@@ -87,23 +87,22 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
         uint_fast64_t const& actionIndex, CommandFilter const& commandFilter = CommandFilter::All);
 
     /*!
-     * Retrieves all choices that are definitively asynchronous, possible from the given state.
+     * Adds all choices that are definitively asynchronous, possible from the given state.
      *
+     * @param behavior The new choices are added to this behavior.
      * @param state The state for which to retrieve the unlabeled choices.
-     * @return The asynchronous choices of the state.
      */
-    std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                          CommandFilter const& commandFilter = CommandFilter::All);
+    void addAsynchronousChoices(StateBehavior<ValueType, StateType>& behavior, CompressedState const& state, StateToIdCallback stateToIdCallback,
+                                CommandFilter const& commandFilter = CommandFilter::All);
 
     /*!
-     * Retrieves all (potentially) synchronous choices possible from the given state.
+     * Adds all (potentially) synchronous choices possible from the given state.
      * Note that these may include choices that run asynchronously for this state.
      *
-     * @param choices The new choices are inserted in this vector
+     * @param behavior The new choices are added to this behavior.
      * @param state The state for which to retrieve the unlabeled choices.
-     * @return The synchronous choices of the state.
      */
-    void addSynchronousChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state, StateToIdCallback stateToIdCallback,
+    void addSynchronousChoices(StateBehavior<ValueType, StateType>& behavior, CompressedState const& state, StateToIdCallback stateToIdCallback,
                                CommandFilter const& commandFilter = CommandFilter::All);
 
     /*!
@@ -137,6 +136,11 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // Storage that is reused for all states to avoid allocations: the distribution of a combination of synchronizing commands and the choice
+    // that combines all choices of a state of a deterministic model.
+    storm::generator::Distribution<StateType, ValueType> synchronizedDistribution;
+    Choice<ValueType, StateType> fusedChoice;
 };
 
 }  // namespace generator
@@ -12,7 +12,42 @@ StateBehavior<ValueType, StateType>::StateBehavior() : expanded(false) {
 
 template<typename ValueType, typename StateType>
 void StateBehavior<ValueType, StateType>::addChoice(Choice<ValueType, StateType>&& choice) {
-    choices.push_back(std::move(choice));
+    if (unusedChoices.empty()) {
+        choices.push_back(std::move(choice));
+    } else {
+        // Swap the storage of an unused choice into the given one, so the caller may reuse it.
+        choices.push_back(std::move(unusedChoices.back()));
+        unusedChoices.pop_back();
+        std::swap(choices.back(), choice);
+    }
+}
+
+template<typename ValueType, typename StateType>
+Choice<ValueType, StateType>& StateBehavior<ValueType, StateType>::addChoice(uint_fast64_t actionIndex, bool markovian) {
+    if (unusedChoices.empty()) {
+        choices.emplace_back(actionIndex, markovian);
+    } else {
+        choices.push_back(std::move(unusedChoices.back()));
+        unusedChoices.pop_back();
+        choices.back().reset(actionIndex, markovian);
+    }
+    return choices.back();
+}
+
+template<typename ValueType, typename StateType>
+void StateBehavior<ValueType, StateType>::truncateChoices(std::size_t numberOfChoices) {
+    while (choices.size() > numberOfChoices) {
+        choices.back().reset();
+        unusedChoices.push_back(std::move(choices.back()));
+        choices.pop_back();
+    }
+}
+
+template<typename ValueType, typename StateType>
+void StateBehavior<ValueType, StateType>::clear() {
+    truncateChoices(0);
+    stateRewards.clear();
+    expanded = false;
 }
 
 template<typename ValueType, typename StateType>
@@ -17,10 +17,30 @@ class StateBehavior {
     StateBehavior();
 
     /*!
-     * Adds the given choice to the behavior of the state.
+     * Adds the given choice to the behavior of the state. The given choice is left in a valid but unspecified state. In particular, it may obtain
+     * the storage of a previously removed choice.
      */
     void addChoice(Choice<ValueType, StateType>&& choice);
 
+    /*!
+     * Adds an empty choice with the given action index to the behavior of the state. If possible, the storage of a previously removed choice
+     * is reused.
+     *
+     * @return The new choice. The reference is invalidated by adding further choices.
+     */
+    Choice<ValueType, StateType>& addChoice(uint_fast64_t actionIndex, bool markovian = false);
+
+    /*!
+     * Removes all but the first given number of choices. The storage of the removed choices is kept for choices that are added later.
+     */
+    void truncateChoices(std::size_t numberOfChoices);
+
+    /*!
+     * Resets the behavior to the one of a state that was not yet expanded. The storage of all choices is kept, so the same object can be used
+     * to expand many states without (re)allocating memory for the choices of each state.
+     */
+    void clear();
+
     /*!
      * Adds the given state reward to the behavior of the state.
      */
@@ -80,6 +100,9 @@ class StateBehavior {
     // The choices available in the state.
     std::vector<Choice<ValueType, StateType>> choices;
 
+    // Previously removed (and reset) choices whose storage can be reused.
+    std::vector<Choice<ValueType, StateType>> unusedChoices;
+
     // The state rewards (under the different, selected reward models) of the state.
     std::vector<ValueType> stateRewards;
 
@@ -11,6 +11,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/utility/FilteredRewardModel.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 #include "storm/solver/SolveGoal.h"
@@ -103,6 +104,34 @@ std::unique_ptr<CheckResult> SparseMarkovAutomatonCslModelChecker<SparseMarkovAu
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(result)));
 }
 
+template<typename SparseMarkovAutomatonModelType>
+std::vector<std::unique_ptr<CheckResult>> SparseMarkovAutomatonCslModelChecker<SparseMarkovAutomatonModelType>::computeMultipleBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& upperTimeBounds) {
+    storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+                    "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+    STORM_LOG_THROW(this->getModel().isClosed(), storm::exceptions::InvalidPropertyException,
+                    "Unable to compute time-bounded reachability probabilities in non-closed Markov automaton.");
+    STORM_LOG_THROW(pathFormula.getTimeBoundReference().isTimeBound(), storm::exceptions::NotImplementedException,
+                    "Currently step-bounded and reward-bounded properties on MAs are not supported.");
+    STORM_LOG_THROW(storm::utility::isZero(pathFormula.getLowerBound<double>()), storm::exceptions::InvalidPropertyException,
+                    "Computing probabilities for multiple time bounds is only supported without lower time bound.");
+    std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
+    ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+
+    std::unique_ptr<CheckResult> leftResultPointer = this->check(env, pathFormula.getLeftSubformula());
+    ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
+
+    std::vector<std::vector<ValueType>> values = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeMultipleBoundedUntilProbabilities(
+        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getExitRates(),
+        this->getModel().getMarkovianStates(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), upperTimeBounds);
+    std::vector<std::unique_ptr<CheckResult>> results;
+    for (auto& resultValues : values) {
+        results.push_back(std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(resultValues))));
+    }
+    return results;
+}
+
 template<typename SparseMarkovAutomatonModelType>
 std::unique_ptr<CheckResult> SparseMarkovAutomatonCslModelChecker<SparseMarkovAutomatonModelType>::computeNextProbabilities(
     Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
@@ -52,6 +52,17 @@ class SparseMarkovAutomatonCslModelChecker : public SparsePropositionalModelChec
                                                                   CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(Environment const& env,
                                                                     CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
+
+    /*!
+     * Computes the probabilities of the given time-bounded until formula for several upper time bounds at once, sharing the work that is
+     * independent of the time bound. The time bound of the given formula is ignored and it must not have a lower time bound.
+     *
+     * @param upperTimeBounds The (non-strict) upper time bounds.
+     * @return For each upper time bound, the resulting probabilities.
+     */
+    std::vector<std::unique_ptr<CheckResult>> computeMultipleBoundedUntilProbabilities(Environment const& env,
+                                                                                       CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask,
+                                                                                       std::vector<double> const& upperTimeBounds);
 };
 }  // namespace modelchecker
 }  // namespace storm
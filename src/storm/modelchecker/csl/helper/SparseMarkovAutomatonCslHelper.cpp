@@ -1,5 +1,8 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include <algorithm>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
@@ -71,6 +74,20 @@ class UnifPlusHelper {
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                             ValueType const& upperTimeBound,
                                                             boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
+        return std::move(computeBoundedUntilProbabilities(env, dir, phiStates, psiStates, std::vector<ValueType>({upperTimeBound}), relevantStates).front());
+    }
+
+    /*!
+     * Computes the bounded until probabilities for all given upper time bounds.
+     * The upper bounds on the result only depend on the number of uniformization steps and are therefore computed for all time bounds in one shared sweep.
+     * The lower bounds depend on the time bound and are computed in separate sweeps, one per time bound that has not converged yet.
+     * With TBB, all these sweeps (including the one for the upper bounds) are performed concurrently, which also benefits a single time bound.
+     */
+    std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir,
+                                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                         std::vector<ValueType> const& upperTimeBounds,
+                                                                         boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
+        STORM_LOG_ASSERT(!upperTimeBounds.empty(), "No time bound given.");
         // Since there is no lower time bound, we can treat the psiStates as if they are absorbing.
 
         // Compute some important subsets of states
@@ -79,31 +96,38 @@ class UnifPlusHelper {
         storm::storage::BitVector probabilisticMaybeStates = ~markovianStates & maybeStates;
         storm::storage::BitVector markovianStatesModMaybeStates = markovianMaybeStates % maybeStates;
         storm::storage::BitVector probabilisticStatesModMaybeStates = probabilisticMaybeStates % maybeStates;
+
+        std::vector<std::vector<ValueType>> results(upperTimeBounds.size());
         // Catch the case where this query can be solved by solving the untimed variant instead.
         // This is the case if there is no Markovian maybe state (e.g. if the initial state is already a psi state) of if the time bound is infinity.
-        if (markovianMaybeStates.empty() || storm::utility::isInfinity(upperTimeBound)) {
-            return SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(env, dir, transitionMatrix, transitionMatrix.transpose(true), phiStates,
-                                                                                        psiStates, false, false)
-                .values;
+        std::vector<TimeBoundData> timeBounds;
+        boost::optional<std::vector<ValueType>> untimedResult;
+        for (uint64_t i = 0; i < upperTimeBounds.size(); ++i) {
+            if (markovianMaybeStates.empty() || storm::utility::isInfinity(upperTimeBounds[i])) {
+                if (!untimedResult) {
+                    untimedResult = SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(
+                                        env, dir, transitionMatrix, transitionMatrix.transpose(true), phiStates, psiStates, false, false)
+                                        .values;
+                }
+                results[i] = untimedResult.get();
+            } else {
+                timeBounds.emplace_back(i, upperTimeBounds[i]);
+            }
+        }
+        if (timeBounds.empty()) {
+            return results;
         }
 
         boost::optional<storm::storage::BitVector> relevantMaybeStates;
         if (relevantStates) {
             relevantMaybeStates = relevantStates.get() % maybeStates;
         }
-        // Store the best solution known so far (useful in cases where the computation gets aborted)
-        std::vector<ValueType> bestKnownSolution;
-        if (relevantMaybeStates) {
-            bestKnownSolution.resize(relevantStates->size());
-        }
 
         // Get the exit rates restricted to only markovian maybe states.
         std::vector<ValueType> markovianExitRates = storm::utility::vector::filterVector(exitRateVector, markovianMaybeStates);
 
         // Obtain parameters of the algorithm
         auto two = storm::utility::convertNumber<ValueType>(2.0);
-        // Truncation error
-        ValueType kappa = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
         // Precision to be achieved
         ValueType epsilon = two * storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision());
         bool relativePrecision = env.solver().timeBounded().getRelativeTerminationCriterion();
@@ -129,19 +153,33 @@ class UnifPlusHelper {
         // The probabilities to go from a probabilistic state to a psi state in one step
         std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
 
-        // Set up a solver for the transitions between probabilistic states (if there are some)
+        // Set up the solvers for the transitions between probabilistic states (if there are some).
+        // Each sweep gets its own solver so that sweeps can be performed concurrently.
+        // As the transitions between probabilistic states do not change, the solvers are reused throughout all iterations.
         Environment solverEnv = env;
         solverEnv.solver().setForceExact(true);  // Errors within the inner iterations can propagate significantly
-        auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+        auto upperSolver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+        for (auto& timeBound : timeBounds) {
+            timeBound.solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+            timeBound.kappa = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
+            timeBound.lower.assign(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
+            timeBound.upper.assign(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
+            timeBound.nextLower.resize(maybeStates.getNumberOfSetBits());
+            if (relevantMaybeStates) {
+                // Store the best solution known so far (useful in cases where the computation gets aborted)
+                timeBound.bestKnownSolution.resize(relevantStates->size());
+            }
+        }
 
-        // Allocate auxiliary memory that can be used during the iterations
-        std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
-        std::vector<ValueType> maybeStatesValuesUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> nextMarkovianStateValues = std::move(
-            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
-        std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
-        std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
+        // The data that is needed in every step of a sweep
+        SweepData sweepData{maybeStates.getNumberOfSetBits(),
+                            markovianToMaybeTransitions,
+                            markovianToPsiProbabilities,
+                            probabilisticToProbabilisticTransitions,
+                            probabilisticToMarkovianTransitions,
+                            probabilisticToPsiProbabilities,
+                            markovianStatesModMaybeStates,
+                            probabilisticStatesModMaybeStates};
 
         // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
         storm::utility::ProgressMeasurement progressIterations("iterations");
@@ -150,128 +188,97 @@ class UnifPlusHelper {
         bool converged = false;
         bool abortedInnerIterations = false;
         while (!converged) {
-            // Maximal step size
-            uint64_t N = storm::utility::ceil(lambda * upperTimeBound * std::exp(2) - storm::utility::log(kappa * epsilon));
-            // Compute poisson distribution.
-            // The division by 8 is similar to what is done for CTMCs (probably to reduce numerical impacts?)
-            auto foxGlynnResult = storm::utility::numerical::foxGlynn(lambda * upperTimeBound, epsilon * kappa / storm::utility::convertNumber<ValueType>(8.0));
-            // Scale the weights so they sum to one.
-            // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-
-            // Set up multiplier
-            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
-
-            // Perform inner iterations first for upper, then for lower bound
-            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-            for (bool computeLowerBound : {false, true}) {
-                auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
-                ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
-                storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
-                                                                  std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
-                progressSteps.setMaxCount(N);
-                progressSteps.startNewMeasurement(0);
-                bool firstIteration = true;  // The first iterations can be irrelevant, because they will only produce zeroes anyway.
-                int64_t k = N;
-                // Iteration k = N is always non-relevant
-                for (--k; k >= 0; --k) {
-                    // Check whether the iteration is relevant, that is, whether it will contribute non-zero values to the overall result
-                    if (computeLowerBound) {
-                        // Check whether the value for visiting a target state will be zero.
-                        if (static_cast<uint64_t>(k) > foxGlynnResult.right) {
-                            // Reaching this point means that we are in one of the earlier iterations where fox glynn told us to cut off
-                            continue;
-                        }
-                    } else {
-                        uint64_t i = N - 1 - k;
-                        if (i > foxGlynnResult.right) {
-                            // Reaching this point means that we are in a later iteration which will not contribute to the upper bound
-                            // Since i will only get larger in subsequent iterations, we can directly break here.
-                            break;
-                        }
-                    }
-
-                    // Compute the values at Markovian maybe states.
-                    if (firstIteration) {
-                        firstIteration = false;
-                        // Reaching this point means that this is the very first relevant iteration.
-                        // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
-                        // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
-                        std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
-                    } else {
-                        // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
-                        for (auto const& oneStepProb : markovianToPsiProbabilities) {
-                            nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
-                        }
-                    }
-
-                    // Update the value when reaching a psi state.
-                    // This has to be done after updating the Markovian state values since we needed the 'old' target value above.
-                    if (computeLowerBound && static_cast<uint64_t>(k) >= foxGlynnResult.left) {
-                        assert(static_cast<uint64_t>(k) <= foxGlynnResult.right);  // has to hold since this iteration is relevant
-                        targetValue += foxGlynnResult.weights[k - foxGlynnResult.left];
-                    }
+            std::vector<TimeBoundData*> activeTimeBounds;
+            for (auto& timeBound : timeBounds) {
+                if (!timeBound.converged) {
+                    // Maximal step size
+                    timeBound.maximalStep =
+                        storm::utility::ceil(lambda * timeBound.timeBound * std::exp(2) - storm::utility::log(timeBound.kappa * epsilon));
+                    // Compute poisson distribution.
+                    // The division by 8 is similar to what is done for CTMCs (probably to reduce numerical impacts?)
+                    timeBound.foxGlynnResult = storm::utility::numerical::foxGlynn(lambda * timeBound.timeBound,
+                                                                                   epsilon * timeBound.kappa / storm::utility::convertNumber<ValueType>(8.0));
+                    activeTimeBounds.push_back(&timeBound);
+                }
+            }
 
-                    // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
-                    for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
-                    }
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+#ifdef STORM_HAVE_INTELTBB
+            // The sweep for the upper bounds and the sweeps for the lower bounds of the different time bounds are independent of each other,
+            // so they are all performed concurrently. This also applies if there is only a single time bound.
+            // As the lower bounds of the previous iteration might already suffice for convergence, the new ones are computed separately.
+            std::vector<char> aborted(activeTimeBounds.size() + 1, false);
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, activeTimeBounds.size() + 1, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                    if (i == 0) {
+                        // The upper bounds are computed for all time bounds at once.
+                        aborted[i] = computeUpperBounds(env, solverEnv, dir, upperSolver.get(), sweepData, activeTimeBounds, iteration);
                     } else {
-                        storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
-                                                                     probabilisticToProbabilisticTransitions.getRowGroupIndices());
-                    }
-
-                    // Create the new values for the maybestates
-                    // Fuse the results together
-                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
-                    if (!computeLowerBound) {
-                        // Add the scaled values to the actual result vector
-                        uint64_t i = N - 1 - k;
-                        if (i >= foxGlynnResult.left) {
-                            assert(i <= foxGlynnResult.right);  // has to hold since this iteration is considered relevant.
-                            ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
-                            storm::utility::vector::addScaledVector(maybeStatesValuesUpper, maybeStatesValuesWeightedUpper, weight);
-                        }
-                    }
-
-                    progressSteps.updateProgress(N - k);
-                    if (storm::utility::resources::isTerminate()) {
-                        abortedInnerIterations = true;
-                        break;
+                        TimeBoundData& timeBound = *activeTimeBounds[i - 1];
+                        aborted[i] = computeLowerBound(env, solverEnv, dir, sweepData, timeBound, timeBound.nextLower, iteration);
                     }
                 }
+            });
+            abortedInnerIterations = std::find(aborted.begin(), aborted.end(), static_cast<char>(true)) != aborted.end();
+            if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                break;
+            }
 
-                if (computeLowerBound) {
-                    storm::utility::vector::scaleVectorInPlace(maybeStatesValuesLower, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-                } else {
-                    storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+            // Check if the lower and upper bound are sufficiently close to each other, first with the lower bounds from the previous iteration.
+            converged = true;
+            for (auto timeBound : activeTimeBounds) {
+                timeBound->converged =
+                    checkConvergence(timeBound->lower, timeBound->upper, relevantMaybeStates, epsilon, relativePrecision, timeBound->kappa);
+                if (!timeBound->converged) {
+                    storeBestKnownSolution(*timeBound, relevantMaybeStates, two);
+                    std::swap(timeBound->lower, timeBound->nextLower);
+                    timeBound->converged =
+                        checkConvergence(timeBound->lower, timeBound->upper, relevantMaybeStates, epsilon, relativePrecision, timeBound->kappa);
+                    if (!timeBound->converged) {
+                        storeBestKnownSolution(*timeBound, relevantMaybeStates, two);
+                        converged = false;
+                    }
                 }
+            }
+#else
+            // Perform inner iterations first for upper, then for lower bounds.
+            // The upper bounds are computed for all time bounds at once.
+            abortedInnerIterations = computeUpperBounds(env, solverEnv, dir, upperSolver.get(), sweepData, activeTimeBounds, iteration);
+            if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                break;
+            }
 
-                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                    break;
+            // Check if the lower and upper bound are sufficiently close to each other.
+            // Lower bounds from the previous iteration are still valid lower bounds.
+            std::vector<TimeBoundData*> lowerBoundsToCompute;
+            for (auto timeBound : activeTimeBounds) {
+                timeBound->converged =
+                    checkConvergence(timeBound->lower, timeBound->upper, relevantMaybeStates, epsilon, relativePrecision, timeBound->kappa);
+                if (!timeBound->converged) {
+                    storeBestKnownSolution(*timeBound, relevantMaybeStates, two);
+                    lowerBoundsToCompute.push_back(timeBound);
                 }
+            }
 
-                // Check if the lower and upper bound are sufficiently close to each other
-                converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
-                if (converged) {
+            for (auto timeBound : lowerBoundsToCompute) {
+                abortedInnerIterations = computeLowerBound(env, solverEnv, dir, sweepData, *timeBound, timeBound->lower, iteration);
+                if (abortedInnerIterations) {
                     break;
                 }
+            }
+            if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                break;
+            }
 
-                // Store the best solution we have found so far.
-                if (relevantMaybeStates) {
-                    auto currentSolIt = bestKnownSolution.begin();
-                    for (auto state : relevantMaybeStates.get()) {
-                        // We take the average of the lower and upper bounds
-                        *currentSolIt = (maybeStatesValuesLower[state] + maybeStatesValuesUpper[state]) / two;
-                        ++currentSolIt;
-                    }
+            converged = true;
+            for (auto timeBound : lowerBoundsToCompute) {
+                timeBound->converged =
+                    checkConvergence(timeBound->lower, timeBound->upper, relevantMaybeStates, epsilon, relativePrecision, timeBound->kappa);
+                if (!timeBound->converged) {
+                    storeBestKnownSolution(*timeBound, relevantMaybeStates, two);
+                    converged = false;
                 }
             }
+#endif
 
             if (!converged) {
                 // Increase the uniformization rate and prepare the next run
@@ -281,24 +288,28 @@ class UnifPlusHelper {
                 lambda *= two;
                 STORM_LOG_DEBUG("Increased lambda to " << lambda << ".");
 
-                if (relativePrecision) {
-                    // Reduce kappa a bit
-                    ValueType minValue;
-                    if (relevantMaybeStates) {
-                        minValue = storm::utility::vector::min_if(maybeStatesValuesUpper, relevantMaybeStates.get());
-                    } else {
-                        minValue = *std::min_element(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end());
+                for (auto& timeBound : timeBounds) {
+                    if (timeBound.converged) {
+                        continue;
                     }
-                    minValue *= storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
-                    kappa = std::min(kappa, minValue);
-                    STORM_LOG_DEBUG("Decreased kappa to " << kappa << ".");
+                    if (relativePrecision) {
+                        // Reduce kappa a bit
+                        ValueType minValue;
+                        if (relevantMaybeStates) {
+                            minValue = storm::utility::vector::min_if(timeBound.upper, relevantMaybeStates.get());
+                        } else {
+                            minValue = *std::min_element(timeBound.upper.begin(), timeBound.upper.end());
+                        }
+                        minValue *= storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
+                        timeBound.kappa = std::min(timeBound.kappa, minValue);
+                        STORM_LOG_DEBUG("Decreased kappa to " << timeBound.kappa << " for time bound " << timeBound.timeBound << ".");
+                    }
+                    // Reset the values of the maybe states to zero.
+                    std::fill(timeBound.upper.begin(), timeBound.upper.end(), storm::utility::zero<ValueType>());
                 }
 
                 // Apply uniformization with new rate
                 uniformize(markovianToMaybeTransitions, markovianToPsiProbabilities, oldLambda, lambda, markovianStatesModMaybeStates);
-
-                // Reset the values of the maybe states to zero.
-                std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
             }
             progressIterations.updateProgress(++iteration);
             if (storm::utility::resources::isTerminate()) {
@@ -307,25 +318,227 @@ class UnifPlusHelper {
             }
         }
 
-        // Prepare the result vector
-        std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-        storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+        // Prepare the result vectors
+        for (auto& timeBound : timeBounds) {
+            std::vector<ValueType>& result = results[timeBound.index];
+            result.assign(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
 
-        if (abortedInnerIterations && iteration > 1 && relevantMaybeStates && relevantStates) {
-            // We should take the stored solution instead of the current (probably more incorrect) lower/upper values
-            storm::utility::vector::setVectorValues(result, maybeStates & relevantStates.get(), bestKnownSolution);
-        } else {
-            // We take the average of the lower and upper bounds
-            storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
-                maybeStatesValuesLower, maybeStatesValuesUpper, maybeStatesValuesLower,
-                [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+            if (abortedInnerIterations && iteration > 1 && relevantMaybeStates && relevantStates) {
+                // We should take the stored solution instead of the current (probably more incorrect) lower/upper values
+                storm::utility::vector::setVectorValues(result, maybeStates & relevantStates.get(), timeBound.bestKnownSolution);
+            } else {
+                // We take the average of the lower and upper bounds
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+                    timeBound.lower, timeBound.upper, timeBound.lower, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
 
-            storm::utility::vector::setVectorValues(result, maybeStates, maybeStatesValuesLower);
+                storm::utility::vector::setVectorValues(result, maybeStates, timeBound.lower);
+            }
         }
-        return result;
+        return results;
     }
 
    private:
+    /*!
+     * Data for one of the time bounds that are handled simultaneously.
+     */
+    struct TimeBoundData {
+        TimeBoundData(uint64_t index, ValueType const& timeBound) : index(index), timeBound(timeBound) {
+            // Intentionally left empty
+        }
+
+        // The position of the time bound in the input (and output)
+        uint64_t index;
+        ValueType timeBound;
+        // Truncation error
+        ValueType kappa;
+        // Maximal step size for the current uniformization rate
+        uint64_t maximalStep;
+        storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult;
+        // Lower and upper bounds on the values of the maybe states
+        std::vector<ValueType> lower;
+        std::vector<ValueType> upper;
+        // Lower bounds of the current iteration that are computed while the ones of the previous iteration are still needed
+        std::vector<ValueType> nextLower;
+        std::vector<ValueType> bestKnownSolution;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+        bool converged = false;
+    };
+
+    /*!
+     * The (read-only) data used in each step of a sweep.
+     */
+    struct SweepData {
+        uint64_t numberOfMaybeStates;
+        storm::storage::SparseMatrix<ValueType> const& markovianToMaybeTransitions;
+        std::vector<std::pair<uint64_t, ValueType>> const& markovianToPsiProbabilities;
+        storm::storage::SparseMatrix<ValueType> const& probabilisticToProbabilisticTransitions;
+        storm::storage::SparseMatrix<ValueType> const& probabilisticToMarkovianTransitions;
+        std::vector<std::pair<uint64_t, ValueType>> const& probabilisticToPsiProbabilities;
+        storm::storage::BitVector const& markovianStatesModMaybeStates;
+        storm::storage::BitVector const& probabilisticStatesModMaybeStates;
+    };
+
+    /*!
+     * Performs a single step of a sweep: Computes the values at Markovian and probabilistic maybe states from the values of the previous step.
+     * If the previous values are not given, they are assumed to be zero.
+     */
+    void performStep(Environment const& env, Environment const& solverEnv, OptimizationDirection dir,
+                     storm::solver::MinMaxLinearEquationSolver<ValueType>* solver, SweepData const& data,
+                     storm::solver::Multiplier<ValueType> const& markovianToMaybeMultiplier,
+                     storm::solver::Multiplier<ValueType> const& probabilisticToMarkovianMultiplier, ValueType const& targetValue,
+                     ValueType const& nextTargetValue, bool firstStep, std::vector<ValueType>& maybeStatesValues,
+                     std::vector<ValueType>& nextMarkovianStateValues, std::vector<ValueType>& nextProbabilisticStateValues,
+                     std::vector<ValueType>& eqSysRhs) const {
+        // Compute the values at Markovian maybe states.
+        if (firstStep) {
+            // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
+            // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
+            std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+        } else {
+            markovianToMaybeMultiplier.multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+            for (auto const& oneStepProb : data.markovianToPsiProbabilities) {
+                nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
+            }
+        }
+
+        // Compute the values at probabilistic states.
+        // The value when reaching a psi state might have been updated after updating the Markovian state values.
+        probabilisticToMarkovianMultiplier.multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+        for (auto const& oneStepProb : data.probabilisticToPsiProbabilities) {
+            eqSysRhs[oneStepProb.first] += oneStepProb.second * nextTargetValue;
+        }
+        if (solver) {
+            solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+        } else {
+            storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
+                                                         data.probabilisticToProbabilisticTransitions.getRowGroupIndices());
+        }
+
+        // Create the new values for the maybestates
+        // Fuse the results together
+        storm::utility::vector::setVectorValues(maybeStatesValues, data.markovianStatesModMaybeStates, nextMarkovianStateValues);
+        storm::utility::vector::setVectorValues(maybeStatesValues, data.probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+    }
+
+    /*!
+     * Computes the upper bounds for all given time bounds in one sweep.
+     * The values of the i-th step are the (optimal) probabilities to reach a psi state within i uniformized steps.
+     * They do not depend on the time bound, only their Poisson weights do.
+     *
+     * @return true if the computation has been aborted.
+     */
+    bool computeUpperBounds(Environment const& env, Environment const& solverEnv, OptimizationDirection dir,
+                            storm::solver::MinMaxLinearEquationSolver<ValueType>* solver, SweepData const& data,
+                            std::vector<TimeBoundData*> const& timeBounds, uint64_t iteration) const {
+        // Only steps up to the right truncation point of some time bound are relevant
+        uint64_t numberOfSteps = 0;
+        for (auto timeBound : timeBounds) {
+            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(timeBound->upper), "Current values need to be initialized with zero.");
+            // Iteration k = N is always non-relevant
+            numberOfSteps = std::max(numberOfSteps, std::min(timeBound->foxGlynnResult.right + 1, timeBound->maximalStep));
+        }
+
+        auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, data.markovianToMaybeTransitions);
+        auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, data.probabilisticToMarkovianTransitions);
+        std::vector<ValueType> maybeStatesValues(data.numberOfMaybeStates, storm::utility::zero<ValueType>());
+        std::vector<ValueType> nextMarkovianStateValues(data.markovianToMaybeTransitions.getRowCount());
+        std::vector<ValueType> nextProbabilisticStateValues(data.probabilisticToProbabilisticTransitions.getRowGroupCount());
+        std::vector<ValueType> eqSysRhs(data.probabilisticToProbabilisticTransitions.getRowCount());
+        ValueType const one = storm::utility::one<ValueType>();
+
+        storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for upper bounds.");
+        progressSteps.setMaxCount(numberOfSteps);
+        progressSteps.startNewMeasurement(0);
+        for (uint64_t i = 0; i < numberOfSteps; ++i) {
+            performStep(env, solverEnv, dir, solver, data, *markovianToMaybeMultiplier, *probabilisticToMarkovianMultiplier, one, one, i == 0,
+                        maybeStatesValues, nextMarkovianStateValues, nextProbabilisticStateValues, eqSysRhs);
+
+            // Add the scaled values to the actual result vectors
+            for (auto timeBound : timeBounds) {
+                auto const& foxGlynnResult = timeBound->foxGlynnResult;
+                if (i >= foxGlynnResult.left && i <= foxGlynnResult.right && i < timeBound->maximalStep) {
+                    ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
+                    storm::utility::vector::addScaledVector(timeBound->upper, maybeStatesValues, weight);
+                }
+            }
+
+            progressSteps.updateProgress(i + 1);
+            if (storm::utility::resources::isTerminate()) {
+                return true;
+            }
+        }
+
+        for (auto timeBound : timeBounds) {
+            storm::utility::vector::scaleVectorInPlace(timeBound->upper, storm::utility::one<ValueType>() / timeBound->foxGlynnResult.totalWeight);
+        }
+        return false;
+    }
+
+    /*!
+     * Computes the lower bounds for the given time bound in one (backward) sweep.
+     *
+     * @param lower The vector in which the lower bounds are stored. Its initial content is irrelevant.
+     * @return true if the computation has been aborted.
+     */
+    bool computeLowerBound(Environment const& env, Environment const& solverEnv, OptimizationDirection dir, SweepData const& data, TimeBoundData& timeBound,
+                           std::vector<ValueType>& lower, uint64_t iteration) const {
+        auto const& foxGlynnResult = timeBound.foxGlynnResult;
+        uint64_t const N = timeBound.maximalStep;
+
+        auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, data.markovianToMaybeTransitions);
+        auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, data.probabilisticToMarkovianTransitions);
+        std::vector<ValueType> nextMarkovianStateValues(data.markovianToMaybeTransitions.getRowCount());
+        std::vector<ValueType> nextProbabilisticStateValues(data.probabilisticToProbabilisticTransitions.getRowGroupCount());
+        std::vector<ValueType> eqSysRhs(data.probabilisticToProbabilisticTransitions.getRowCount());
+        ValueType targetValue = storm::utility::zero<ValueType>();
+
+        storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for lower bounds (time bound " +
+                                                          std::to_string(storm::utility::convertNumber<double>(timeBound.timeBound)) + ").");
+        progressSteps.setMaxCount(N);
+        progressSteps.startNewMeasurement(0);
+        bool firstIteration = true;  // The first iterations can be irrelevant, because they will only produce zeroes anyway.
+        int64_t k = N;
+        // Iteration k = N is always non-relevant
+        for (--k; k >= 0; --k) {
+            // Check whether the value for visiting a target state will be zero.
+            if (static_cast<uint64_t>(k) > foxGlynnResult.right) {
+                // Reaching this point means that we are in one of the earlier iterations where fox glynn told us to cut off
+                continue;
+            }
+
+            // Update the value when reaching a psi state.
+            // This has to be done after updating the Markovian state values since we needed the 'old' target value there.
+            ValueType nextTargetValue = targetValue;
+            if (static_cast<uint64_t>(k) >= foxGlynnResult.left) {
+                nextTargetValue += foxGlynnResult.weights[k - foxGlynnResult.left];
+            }
+            performStep(env, solverEnv, dir, timeBound.solver.get(), data, *markovianToMaybeMultiplier, *probabilisticToMarkovianMultiplier, targetValue,
+                        nextTargetValue, firstIteration, lower, nextMarkovianStateValues, nextProbabilisticStateValues, eqSysRhs);
+            targetValue = std::move(nextTargetValue);
+            firstIteration = false;
+
+            progressSteps.updateProgress(N - k);
+            if (storm::utility::resources::isTerminate()) {
+                return true;
+            }
+        }
+
+        storm::utility::vector::scaleVectorInPlace(lower, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+        return false;
+    }
+
+    void storeBestKnownSolution(TimeBoundData& timeBound, boost::optional<storm::storage::BitVector> const& relevantMaybeStates, ValueType const& two) const {
+        if (relevantMaybeStates) {
+            auto currentSolIt = timeBound.bestKnownSolution.begin();
+            for (auto state : relevantMaybeStates.get()) {
+                // We take the average of the lower and upper bounds
+                *currentSolIt = (timeBound.lower[state] + timeBound.upper[state]) / two;
+                ++currentSolIt;
+            }
+        }
+    }
+
     bool checkConvergence(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper,
                           boost::optional<storm::storage::BitVector> const& relevantValues, ValueType const& epsilon, bool relative, ValueType& kappa) {
         STORM_LOG_ASSERT(!relevantValues.is_initialized() || relevantValues->size() == lower.size(), "Relevant values size mismatch.");
@@ -721,6 +934,44 @@ std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbab
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeMultipleBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperTimeBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+
+    if (env.solver().timeBounded().getMaMethod() == storm::solver::MaBoundedReachabilityMethod::Imca && phiStates.full()) {
+        // IMCA handles each time bound separately
+        std::vector<std::vector<ValueType>> result;
+        for (auto const& upperTimeBound : upperTimeBounds) {
+            result.push_back(computeBoundedUntilProbabilitiesImca(env, goal.direction(), transitionMatrix, exitRateVector, markovianStates, psiStates,
+                                                                  std::make_pair(0.0, upperTimeBound)));
+        }
+        return result;
+    }
+
+    UnifPlusHelper<ValueType> helper(transitionMatrix, exitRateVector, markovianStates);
+    boost::optional<storm::storage::BitVector> relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+    }
+    std::vector<ValueType> timeBounds;
+    for (auto const& upperTimeBound : upperTimeBounds) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperTimeBound));
+    }
+    return helper.computeBoundedUntilProbabilities(env, goal.direction(), phiStates, psiStates, timeBounds, relevantValues);
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeMultipleBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperTimeBounds) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -784,6 +1035,11 @@ template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntil
     std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeMultipleBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperTimeBounds);
+
 template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -810,6 +1066,11 @@ template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::comp
     std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<storm::RationalNumber>> SparseMarkovAutomatonCslHelper::computeMultipleBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperTimeBounds);
+
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
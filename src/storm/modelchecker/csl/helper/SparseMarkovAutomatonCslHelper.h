@@ -32,6 +32,24 @@ class SparseMarkovAutomatonCslHelper {
                                                                    storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
                                                                    storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+    /*!
+     * Computes the bounded until probabilities for several upper time bounds (with lower time bound zero) at once.
+     * With the Unif+ method, the uniformized steps that are relevant for all time bounds are shared.
+     *
+     * @return for each upper time bound the probabilities for all states.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeMultipleBoundedUntilProbabilities(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<double> const& upperTimeBounds);
+
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeMultipleBoundedUntilProbabilities(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<double> const& upperTimeBounds);
+
     template<typename ValueType>
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(Environment const& env, OptimizationDirection dir,
                                                                                        storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
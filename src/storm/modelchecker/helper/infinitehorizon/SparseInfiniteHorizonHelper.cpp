@@ -1,8 +1,11 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <mutex>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -23,6 +26,7 @@
 
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/exceptions/UnmetRequirementException.h"
 
@@ -169,18 +173,63 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.setMaxCount(_longRunComponentDecomposition->size());
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-    std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    std::vector<ValueType> componentLraValues(_longRunComponentDecomposition->size());
+#ifdef STORM_HAVE_INTELTBB
+    if (_longRunComponentDecomposition->size() > 1 && supportsConcurrentComponentComputations(underlyingSolverEnvironment)) {
+        // The components are independent of each other.
+        // Trivial components consisting of a single state are cheap, so we handle them right away instead of creating tasks for them.
+        std::vector<uint64_t> nonTrivialComponents;
+        uint64_t finishedComponents = 0;
+        for (uint64_t i = 0; i < _longRunComponentDecomposition->size(); ++i) {
+            auto const& c = (*_longRunComponentDecomposition)[i];
+            if (c.size() == 1) {
+                componentLraValues[i] = computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c);
+                progress.updateProgress(++finishedComponents);
+            } else {
+                nonTrivialComponents.push_back(i);
+            }
+        }
+        // Start with the largest components to balance the load.
+        std::sort(nonTrivialComponents.begin(), nonTrivialComponents.end(), [this](uint64_t a, uint64_t b) {
+            return (*_longRunComponentDecomposition)[a].size() > (*_longRunComponentDecomposition)[b].size();
+        });
+        // Large components can additionally use parallel matrix-vector multiplications.
+        auto largeComponentEnvironment = underlyingSolverEnvironment;
+        largeComponentEnvironment.solver().multiplier().setParallel(true);
+        uint64_t const largeComponentSize = 10000;
+
+        std::mutex progressMutex;
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, nonTrivialComponents.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                auto const& c = (*_longRunComponentDecomposition)[nonTrivialComponents[i]];
+                componentLraValues[nonTrivialComponents[i]] = computeLraForComponent(
+                    c.size() >= largeComponentSize ? largeComponentEnvironment : underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c);
+                std::lock_guard<std::mutex> lock(progressMutex);
+                progress.updateProgress(++finishedComponents);
+            }
+        });
+    } else {
+#endif
+        for (uint64_t i = 0; i < _longRunComponentDecomposition->size(); ++i) {
+            componentLraValues[i] =
+                computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[i]);
+            progress.updateProgress(i + 1);
+        }
+#ifdef STORM_HAVE_INTELTBB
     }
+#endif
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
     STORM_LOG_INFO("Solving stochastic shortest path problem.");
     return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
 }
 
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::supportsConcurrentComponentComputations(Environment const& env) const {
+    // Arithmetic on rational functions is not thread-safe.
+    return !std::is_same<ValueType, storm::RationalFunction>::value;
+}
+
 template<typename ValueType, bool Nondeterministic>
 bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isContinuousTime() const {
     STORM_LOG_ASSERT((_markovianStates == nullptr) || (_exitRates != nullptr), "Inconsistent information given: Have Markovian states but no exit rates.");
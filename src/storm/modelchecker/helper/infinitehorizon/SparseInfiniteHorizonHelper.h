@@ -123,6 +123,11 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     virtual void createDecomposition() = 0;
 
+    /*!
+     * @return true iff computeLraForComponent can be invoked concurrently for different components with the given environment.
+     */
+    virtual bool supportsConcurrentComponentComputations(Environment const& env) const;
+
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
      * optimal values w.r.t. the individual components.
@@ -65,6 +65,16 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
    protected:
     virtual void createDecomposition() override;
 
+    /*!
+     * Components can be handled concurrently unless linear programming is used (LP solvers are not necessarily thread-safe).
+     */
+    virtual bool supportsConcurrentComponentComputations(Environment const& env) const override;
+
+    /*!
+     * @return the method used to compute the LRA value of a nontrivial MEC, taking exactness and soundness requirements into account.
+     */
+    storm::solver::LraMethod getComponentLraMethod(Environment const& env) const;
+
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
 
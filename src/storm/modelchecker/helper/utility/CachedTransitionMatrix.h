@@ -0,0 +1,27 @@
+#pragma once
+
+#include "storm/models/symbolic/Model.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/storage/dd/Add.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Determines whether the explicit representation of the given transition matrix can be derived from the one cached by the model.
+ * Using the cache keeps the explicit matrix in memory for the lifetime of the model, so it can be disabled via --no-explicit-matrix-cache.
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+bool usesCachedTransitionMatrix(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix) {
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isNoExplicitMatrixCacheSet()) {
+        return false;
+    }
+    // Comparing DDs only compares their root nodes, so this check is cheap.
+    return transitionMatrix == model.getTransitionMatrix();
+}
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
@@ -64,37 +67,54 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env);) {
+        std::vector<WeightVector> directions;
+        uint64_t numberOfDirections = this->getNumberOfConcurrentRefinementSteps(env);
+        for (; directions.size() < numberOfDirections && objIndex < this->objectives.size(); ++objIndex) {
+            directions.emplace_back(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            directions.back()[objIndex] = storm::utility::one<GeometryValueType>();
+        }
+        this->performRefinementSteps(env, std::move(directions));
         if (storm::utility::resources::isTerminate()) {
             break;
         }
     }
 
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get for each halfspace of the underApproximation the maximal distance to a vertex of the overApproximation
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        std::vector<GeometryValueType> halfspaceDistances(underApproxHalfspaces.size(), storm::utility::zero<GeometryValueType>());
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
             for (auto const& vertex : overApproxVertices) {
                 GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
+                if (distance > halfspaceDistances[halfspaceIndex]) {
+                    halfspaceDistances[halfspaceIndex] = distance;
                 }
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        // Consider the halfspaces with the largest distances first. The sorting is stable so that a single direction is chosen as before.
+        std::vector<uint_fast64_t> halfspaceIndices(underApproxHalfspaces.size());
+        std::iota(halfspaceIndices.begin(), halfspaceIndices.end(), 0);
+        std::stable_sort(halfspaceIndices.begin(), halfspaceIndices.end(),
+                         [&halfspaceDistances](uint_fast64_t lhs, uint_fast64_t rhs) { return halfspaceDistances[lhs] > halfspaceDistances[rhs]; });
+        GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
+        if (halfspaceIndices.empty() || halfspaceDistances[halfspaceIndices.front()] < precision) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~"
+                       << storm::utility::convertNumber<double>(halfspaceDistances[halfspaceIndices.front()]));
+
+        // Refine in the directions of (up to) as many halfspaces as there are concurrent refinement steps.
+        std::vector<WeightVector> directions;
+        uint64_t numberOfDirections = this->getNumberOfConcurrentRefinementSteps(env);
+        for (auto halfspaceIndexIt = halfspaceIndices.begin();
+             directions.size() < numberOfDirections && halfspaceIndexIt != halfspaceIndices.end() && !(halfspaceDistances[*halfspaceIndexIt] < precision);
+             ++halfspaceIndexIt) {
+            directions.push_back(underApproxHalfspaces[*halfspaceIndexIt].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
@@ -1,5 +1,6 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
@@ -29,7 +30,10 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : preprocessorResult(preprocessorResult),
+      originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
@@ -88,17 +92,18 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::computeRefinementStep(
+    Environment const& env, PcaaWeightVectorChecker<SparseModelType>& checker, WeightVector&& direction) const {
     // Normalize the direction vector so that the entries sum up to one
     storm::utility::vector::scaleVectorInPlace(
         direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+    checker.check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
     STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                        storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
     RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+    step.weightVector = std::move(direction);
+    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
     // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -106,30 +111,100 @@ void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(
             step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
         }
     }
-    refinementSteps.push_back(std::move(step));
+    return step;
+}
+
+template<class SparseModelType, typename GeometryValueType>
+PcaaWeightVectorChecker<SparseModelType>& SparsePcaaQuery<SparseModelType, GeometryValueType>::getWeightVectorChecker(uint64_t index) {
+    if (index == 0) {
+        return *weightVectorChecker;
+    }
+    while (additionalWeightVectorCheckers.size() < index) {
+        additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+    }
+    auto& checker = *additionalWeightVectorCheckers[index - 1];
+    // The precision of the main checker might have been changed in the meantime
+    checker.setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+    return checker;
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+    refinementSteps.push_back(computeRefinementStep(env, *weightVectorChecker, std::move(direction)));
 
     updateOverApproximation();
     updateUnderApproximation();
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
-    storm::storage::geometry::Halfspace<GeometryValueType> h(
-        refinementSteps.back().weightVector, storm::utility::vector::dotProduct(refinementSteps.back().weightVector, refinementSteps.back().upperBoundPoint));
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    if (directions.empty()) {
+        return;
+    }
+    std::vector<RefinementStep> newSteps(directions.size());
+#ifdef STORM_HAVE_INTELTBB
+    if (std::is_same<typename SparseModelType::ValueType, double>::value && directions.size() > 1) {
+        // Each direction is checked by its own weight vector checker. All checkers are created before they are used concurrently.
+        std::vector<PcaaWeightVectorChecker<SparseModelType>*> checkers;
+        checkers.reserve(directions.size());
+        for (uint64_t index = 0; index < directions.size(); ++index) {
+            checkers.push_back(&getWeightVectorChecker(index));
+        }
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, directions.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                newSteps[index] = computeRefinementStep(env, *checkers[index], std::move(directions[index]));
+            }
+        });
+    } else {
+        for (uint64_t index = 0; index < directions.size(); ++index) {
+            newSteps[index] = computeRefinementStep(env, *weightVectorChecker, std::move(directions[index]));
+        }
+    }
+#else
+    for (uint64_t index = 0; index < directions.size(); ++index) {
+        newSteps[index] = computeRefinementStep(env, *weightVectorChecker, std::move(directions[index]));
+    }
+#endif
+    for (auto& step : newSteps) {
+        refinementSteps.push_back(std::move(step));
+    }
 
-    // Due to numerical issues, it might be the case that the updated overapproximation does not contain the underapproximation,
-    // e.g., when the new point is strictly contained in the underapproximation. Check if this is the case.
-    GeometryValueType maximumOffset = h.offset();
-    for (auto const& step : refinementSteps) {
-        maximumOffset = std::max(maximumOffset, storm::utility::vector::dotProduct(h.normalVector(), step.lowerBoundPoint));
+    updateOverApproximation(newSteps.size());
+    updateUnderApproximation();
+}
+
+template<class SparseModelType, typename GeometryValueType>
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getNumberOfConcurrentRefinementSteps(Environment const& env) const {
+    uint64_t result = env.modelchecker().multi().getBatchSize();
+    if (env.modelchecker().multi().isMaxStepsSet()) {
+        uint64_t maxSteps = env.modelchecker().multi().getMaxSteps();
+        result = std::min<uint64_t>(result, maxSteps > this->refinementSteps.size() ? maxSteps - this->refinementSteps.size() : 0);
     }
-    if (maximumOffset > h.offset()) {
-        // We correct the issue by shifting the halfspace such that it contains the underapproximation
-        h.offset() = maximumOffset;
-        STORM_LOG_WARN("Numerical issues: The overapproximation would not contain the underapproximation. Hence, a halfspace is shifted by "
-                       << storm::utility::convertNumber<double>(h.invert().euclideanDistance(refinementSteps.back().upperBoundPoint)) << ".");
+    return result;
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation(uint64_t numberOfNewSteps) {
+    STORM_LOG_ASSERT(numberOfNewSteps <= refinementSteps.size(), "Invalid number of new refinement steps.");
+    for (uint64_t stepIndex = refinementSteps.size() - numberOfNewSteps; stepIndex < refinementSteps.size(); ++stepIndex) {
+        auto const& newStep = refinementSteps[stepIndex];
+        storm::storage::geometry::Halfspace<GeometryValueType> h(newStep.weightVector,
+                                                                 storm::utility::vector::dotProduct(newStep.weightVector, newStep.upperBoundPoint));
+
+        // Due to numerical issues, it might be the case that the updated overapproximation does not contain the underapproximation,
+        // e.g., when the new point is strictly contained in the underapproximation. Check if this is the case.
+        GeometryValueType maximumOffset = h.offset();
+        for (auto const& step : refinementSteps) {
+            maximumOffset = std::max(maximumOffset, storm::utility::vector::dotProduct(h.normalVector(), step.lowerBoundPoint));
+        }
+        if (maximumOffset > h.offset()) {
+            // We correct the issue by shifting the halfspace such that it contains the underapproximation
+            h.offset() = maximumOffset;
+            STORM_LOG_WARN("Numerical issues: The overapproximation would not contain the underapproximation. Hence, a halfspace is shifted by "
+                           << storm::utility::convertNumber<double>(h.invert().euclideanDistance(newStep.upperBoundPoint)) << ".");
+        }
+        overApproximation = overApproximation->intersection(h);
     }
-    overApproximation = overApproximation->intersection(h);
     STORM_LOG_DEBUG("Updated OverApproximation to " << overApproximation->toString(true));
 }
 
@@ -69,11 +69,25 @@ class SparsePcaaQuery {
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
     /*
-     * Updates the overapproximation after a refinement step has been performed
+     * Refines the current result w.r.t. each of the given direction vectors.
+     * If possible, the directions are checked concurrently using one weight vector checker for each direction.
+     * The obtained refinement steps are added in the order of the given directions.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the number of directions that should be passed to a single call of performRefinementSteps.
+     * This considers the batch size as well as the maximum number of refinement steps (as possibly specified in the settings).
+     */
+    uint64_t getNumberOfConcurrentRefinementSteps(Environment const& env) const;
+
+    /*
+     * Updates the overapproximation after refinement steps have been performed
      *
-     * @note The last entry of this->refinementSteps should be the newest step whose information is not yet included in the approximation.
+     * @param numberOfNewSteps the number of refinement steps whose information is not yet included in the approximation.
+     * @note The last numberOfNewSteps entries of this->refinementSteps should be the newest steps.
      */
-    void updateOverApproximation();
+    void updateOverApproximation(uint64_t numberOfNewSteps = 1);
 
     /*
      * Updates the underapproximation after a refinement step has been performed
@@ -87,6 +101,19 @@ class SparsePcaaQuery {
      */
     bool maxStepsPerformed(Environment const& env) const;
 
+    /*
+     * Checks the given direction with the given weight vector checker and returns the obtained refinement step.
+     * The direction is normalized so that its entries sum up to one.
+     */
+    RefinementStep computeRefinementStep(Environment const& env, PcaaWeightVectorChecker<SparseModelType>& checker, WeightVector&& direction) const;
+
+    /*
+     * Returns the weight vector checker with the given index. Index zero refers to this->weightVectorChecker.
+     * Further checkers are created on demand and use the same weighted precision as this->weightVectorChecker.
+     */
+    PcaaWeightVectorChecker<SparseModelType>& getWeightVectorChecker(uint64_t index);
+
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult;
     SparseModelType const& originalModel;
     storm::logic::MultiObjectiveFormula const& originalFormula;
 
@@ -94,6 +121,8 @@ class SparsePcaaQuery {
 
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+    // Further weight vector checkers that allow to check multiple directions concurrently
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
 
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
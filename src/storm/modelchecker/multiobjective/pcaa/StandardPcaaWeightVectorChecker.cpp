@@ -3,7 +3,9 @@
 #include <map>
 #include <set>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/multiobjective/preprocessing/SparseMultiObjectiveRewardAnalysis.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
@@ -478,8 +480,6 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
     } else {
         storm::storage::SparseMatrix<ValueType> deterministicMatrix = transitionMatrix.selectRowsFromRowGroups(this->optimalChoices, false);
         storm::storage::SparseMatrix<ValueType> deterministicBackwardTransitions = deterministicMatrix.transpose();
-        std::vector<ValueType> deterministicStateRewards(deterministicMatrix.getRowCount());  // allocate here
-        storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
 
         auto infiniteHorizonHelper = createDetInfiniteHorizonHelper(deterministicMatrix);
         infiniteHorizonHelper.provideBackwardTransitions(deterministicBackwardTransitions);
@@ -489,8 +489,9 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
         std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
         ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
 
+        // The long run average objectives share the infinite horizon helper and are therefore handled first.
+        std::vector<uint64_t> totalRewardObjectives;
         for (uint_fast64_t const& objIndex : storm::utility::vector::getSortedIndices(weightVector)) {
-            auto const& obj = this->objectives[objIndex];
             if (objectivesWithNoUpperTimeBound.get(objIndex)) {
                 offsetsToUnderApproximation[objIndex] = storm::utility::zero<ValueType>();
                 offsetsToOverApproximation[objIndex] = storm::utility::zero<ValueType>();
@@ -505,73 +506,104 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                         stateValueGetter = [&](uint64_t const& s) { return stateRewards[objIndex][s]; };
                     }
                     objectiveResults[objIndex] = infiniteHorizonHelper.computeLongRunAverageValues(env, stateValueGetter, actionValueGetter);
-                } else {  // i.e. a total reward objective
-                    storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(),
-                                                               actionRewards[objIndex]);
-                    storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
-                    // As maybestates we pick the states from which a state with reward is reachable
-                    storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(
-                        deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
-
-                    // Compute the estimate for this objective
+                    // Update the estimate for the next objectives.
                     if (!storm::utility::isZero(weightVector[objIndex])) {
-                        objectiveResults[objIndex] = weightedSumOfUncheckedObjectives;
-                        ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsOfUncheckedObjectives;
-                        if (storm::solver::minimize(obj.formula->getOptimalityType())) {
-                            scalingFactor *= -storm::utility::one<ValueType>();
-                        }
-                        storm::utility::vector::scaleVectorInPlace(objectiveResults[objIndex], scalingFactor);
-                        storm::utility::vector::clip(objectiveResults[objIndex], obj.lowerResultBound, obj.upperResultBound);
-                    }
-                    // Make sure that the objectiveResult is initialized correctly
-                    objectiveResults[objIndex].resize(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-
-                    if (!maybeStates.empty()) {
-                        bool needEquationSystem =
-                            linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
-                        storm::storage::SparseMatrix<ValueType> submatrix =
-                            deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, needEquationSystem);
-                        if (needEquationSystem) {
-                            // Converting the matrix from the fixpoint notation to the form needed for the equation
-                            // system. That is, we go from x = A*x + b to (I-A)x = b.
-                            submatrix.convertToEquationSystem();
-                        }
-
-                        // Prepare solution vector and rhs of the equation system.
-                        std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], maybeStates);
-                        std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards, maybeStates);
-
-                        // Now solve the resulting equation system.
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, submatrix);
-                        auto req = solver->getRequirements(env);
-                        solver->clearBounds();
-                        storm::storage::BitVector submatrixRowsWithSumLessOne = deterministicMatrix.getRowFilter(maybeStates, maybeStates) % maybeStates;
-                        submatrixRowsWithSumLessOne.complement();
-                        this->setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), objIndex, submatrix, submatrixRowsWithSumLessOne, b);
-                        if (solver->hasLowerBound()) {
-                            req.clearLowerBounds();
-                        }
-                        if (solver->hasUpperBound()) {
-                            req.clearUpperBounds();
-                        }
-                        STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
-                                        "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-                        solver->solveEquations(env, x, b);
-                        // Set the result for this objective accordingly
-                        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, x);
+                        storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[objIndex], -weightVector[objIndex]);
+                        sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
                     }
-                    storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
-                }
-                // Update the estimate for the next objectives.
-                if (!storm::utility::isZero(weightVector[objIndex])) {
-                    storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[objIndex], -weightVector[objIndex]);
-                    sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
+                } else {
+                    totalRewardObjectives.push_back(objIndex);
                 }
             } else {
                 objectiveResults[objIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
             }
         }
+
+#ifdef STORM_HAVE_INTELTBB
+        if (std::is_same<ValueType, double>::value && totalRewardObjectives.size() > 1 && env.modelchecker().multi().getBatchSize() > 1) {
+            // The total reward objectives are independent of each other, so we solve them concurrently if concurrent refinement steps are requested.
+            // All of them start from the estimate obtained from the results computed so far.
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, totalRewardObjectives.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    computeTotalRewardObjectiveResult(env, totalRewardObjectives[index], deterministicMatrix, deterministicBackwardTransitions,
+                                                      weightedSumOfUncheckedObjectives, sumOfWeightsOfUncheckedObjectives, weightVector);
+                }
+            });
+            return;
+        }
+#endif
+        for (auto const& objIndex : totalRewardObjectives) {
+            computeTotalRewardObjectiveResult(env, objIndex, deterministicMatrix, deterministicBackwardTransitions, weightedSumOfUncheckedObjectives,
+                                              sumOfWeightsOfUncheckedObjectives, weightVector);
+            // Update the estimate for the next objectives.
+            if (!storm::utility::isZero(weightVector[objIndex])) {
+                storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[objIndex], -weightVector[objIndex]);
+                sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
+            }
+        }
+    }
+}
+
+template<class SparseModelType>
+void StandardPcaaWeightVectorChecker<SparseModelType>::computeTotalRewardObjectiveResult(
+    Environment const& env, uint64_t objIndex, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+    storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions, std::vector<ValueType> const& weightedSumEstimate,
+    ValueType const& sumOfWeightsEstimate, std::vector<ValueType> const& weightVector) {
+    auto const& obj = this->objectives[objIndex];
+    std::vector<ValueType> deterministicStateRewards(deterministicMatrix.getRowCount());
+    storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(), actionRewards[objIndex]);
+    storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
+    // As maybestates we pick the states from which a state with reward is reachable
+    storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(
+        deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
+
+    // Compute the estimate for this objective
+    if (!storm::utility::isZero(weightVector[objIndex])) {
+        objectiveResults[objIndex] = weightedSumEstimate;
+        ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsEstimate;
+        if (storm::solver::minimize(obj.formula->getOptimalityType())) {
+            scalingFactor *= -storm::utility::one<ValueType>();
+        }
+        storm::utility::vector::scaleVectorInPlace(objectiveResults[objIndex], scalingFactor);
+        storm::utility::vector::clip(objectiveResults[objIndex], obj.lowerResultBound, obj.upperResultBound);
+    }
+    // Make sure that the objectiveResult is initialized correctly
+    objectiveResults[objIndex].resize(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+
+    if (!maybeStates.empty()) {
+        storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+        bool needEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+        storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, needEquationSystem);
+        if (needEquationSystem) {
+            // Converting the matrix from the fixpoint notation to the form needed for the equation
+            // system. That is, we go from x = A*x + b to (I-A)x = b.
+            submatrix.convertToEquationSystem();
+        }
+
+        // Prepare solution vector and rhs of the equation system.
+        std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], maybeStates);
+        std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards, maybeStates);
+
+        // Now solve the resulting equation system.
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, submatrix);
+        auto req = solver->getRequirements(env);
+        solver->clearBounds();
+        storm::storage::BitVector submatrixRowsWithSumLessOne = deterministicMatrix.getRowFilter(maybeStates, maybeStates) % maybeStates;
+        submatrixRowsWithSumLessOne.complement();
+        this->setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), objIndex, submatrix, submatrixRowsWithSumLessOne, b);
+        if (solver->hasLowerBound()) {
+            req.clearLowerBounds();
+        }
+        if (solver->hasUpperBound()) {
+            req.clearUpperBounds();
+        }
+        STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                        "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
+        solver->solveEquations(env, x, b);
+        // Set the result for this objective accordingly
+        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, x);
     }
+    storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
 }
 
 template<class SparseModelType>
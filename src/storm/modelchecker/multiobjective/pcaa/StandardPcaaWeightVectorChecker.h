@@ -90,6 +90,20 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
      */
     void unboundedIndividualPhase(Environment const& env, std::vector<ValueType> const& weightVector);
 
+    /*!
+     * Computes the value of the given total reward objective w.r.t. the scheduler computed in the unboundedWeightedPhase
+     *
+     * @param deterministicMatrix the transition matrix induced by the scheduler
+     * @param deterministicBackwardTransitions the transposed deterministicMatrix
+     * @param weightedSumEstimate the weighted sum of the results of a set of objectives that includes the given one
+     * @param sumOfWeightsEstimate the sum of the weights of this set of objectives. If the objective has a non-zero weight, the weighted sum scaled by this
+     * value serves as initial guess for the result
+     */
+    void computeTotalRewardObjectiveResult(Environment const& env, uint64_t objIndex, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+                                           storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions,
+                                           std::vector<ValueType> const& weightedSumEstimate, ValueType const& sumOfWeightsEstimate,
+                                           std::vector<ValueType> const& weightVector);
+
     /*!
      * For each time epoch (starting with the maximal stepBound occurring in the objectives), this method
      * - determines the objectives that are relevant in the current time epoch
@@ -1,10 +1,12 @@
 #include "storm/modelchecker/prctl/helper/HybridDtmcPrctlHelper.h"
 
+#include "storm/modelchecker/helper/utility/CachedTransitionMatrix.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -30,6 +32,22 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+/*!
+ * Derives the explicit submatrix of the model's transition matrix whose rows and columns are given by the given states from the cached explicit
+ * transition matrix of the model. If required, the submatrix is converted to the equation system format, i.e. I-A is returned.
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+storm::storage::SparseMatrix<ValueType> getCachedSubmatrix(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& states,
+                                                           bool convertToEquationSystem) {
+    storm::storage::BitVector explicitStates = states.toVector(model.getReachableStatesOdd());
+    storm::storage::SparseMatrix<ValueType> submatrix =
+        model.getExplicitTransitionMatrix().getSubmatrix(false, explicitStates, explicitStates, convertToEquationSystem);
+    if (convertToEquationSystem) {
+        submatrix.convertToEquationSystem();
+    }
+    return submatrix;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env,
                                                                                                  storm::models::symbolic::Model<DdType, ValueType> const& model,
@@ -89,19 +107,23 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
 
-            // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-            // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-            if (convertToEquationSystem) {
-                submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
-            }
-
             // Create the solution vector.
             std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::convertNumber<ValueType>(0.5));
 
             // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
             conversionWatch.start();
-            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            storm::storage::SparseMatrix<ValueType> explicitSubmatrix;
+            if (usesCachedTransitionMatrix(model, transitionMatrix)) {
+                explicitSubmatrix = getCachedSubmatrix(model, maybeStates, convertToEquationSystem);
+            } else {
+                // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
+                // into the matrix needed for solving the equation system (i.e. compute (I-A)).
+                submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                if (convertToEquationSystem) {
+                    submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
+                }
+                explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            }
             std::vector<ValueType> b = subvector.toVector(odd);
             conversionWatch.stop();
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -174,15 +196,19 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeBo
         storm::dd::Add<DdType, ValueType> prob1StatesAsColumn = psiStates.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
         storm::dd::Add<DdType, ValueType> subvector = (submatrix * prob1StatesAsColumn).sumAbstract(model.getColumnVariables());
 
-        // Finally cut away all columns targeting non-maybe states.
-        submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-
         // Create the solution vector.
         std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
 
         // Translate the symbolic matrix/vector to their explicit representations.
         conversionWatch.start();
-        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+        storm::storage::SparseMatrix<ValueType> explicitSubmatrix;
+        if (usesCachedTransitionMatrix(model, transitionMatrix)) {
+            explicitSubmatrix = getCachedSubmatrix(model, maybeStates, false);
+        } else {
+            // Finally cut away all columns targeting non-maybe states.
+            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+            explicitSubmatrix = submatrix.toMatrix(odd, odd);
+        }
         std::vector<ValueType> b = subvector.toVector(odd);
         conversionWatch.stop();
         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -209,14 +235,18 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeIn
 
     storm::utility::Stopwatch conversionWatch(true);
 
-    // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    // Retrieve the ODD for the translation between symbolic and explicit storage.
+    storm::dd::Odd const& odd = model.getReachableStatesOdd();
 
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
 
-    // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+    // Translate the symbolic matrix to its explicit representations (unless it is cached by the model).
+    boost::optional<storm::storage::SparseMatrix<ValueType>> convertedMatrix;
+    if (!usesCachedTransitionMatrix(model, transitionMatrix)) {
+        convertedMatrix = transitionMatrix.toMatrix(odd, odd);
+    }
+    storm::storage::SparseMatrix<ValueType> const& explicitMatrix = convertedMatrix ? convertedMatrix.get() : model.getExplicitTransitionMatrix();
     conversionWatch.stop();
     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
@@ -245,11 +275,15 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeCu
 
     storm::utility::Stopwatch conversionWatch(true);
 
-    // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    // Retrieve the ODD for the translation between symbolic and explicit storage.
+    storm::dd::Odd const& odd = model.getReachableStatesOdd();
 
-    // Translate the symbolic matrix/vector to their explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+    // Translate the symbolic matrix/vector to their explicit representations (unless the matrix is cached by the model).
+    boost::optional<storm::storage::SparseMatrix<ValueType>> convertedMatrix;
+    if (!usesCachedTransitionMatrix(model, transitionMatrix)) {
+        convertedMatrix = transitionMatrix.toMatrix(odd, odd);
+    }
+    storm::storage::SparseMatrix<ValueType> const& explicitMatrix = convertedMatrix ? convertedMatrix.get() : model.getExplicitTransitionMatrix();
     std::vector<ValueType> b = totalRewardVector.toVector(odd);
     conversionWatch.stop();
     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -342,19 +376,23 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
 
-            // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-            // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-            if (convertToEquationSystem) {
-                submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
-            }
-
             // Create the solution vector.
             std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::convertNumber<ValueType>(0.5));
 
             // Translate the symbolic matrix/vector to their explicit representations.
             conversionWatch.start();
-            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            storm::storage::SparseMatrix<ValueType> explicitSubmatrix;
+            if (usesCachedTransitionMatrix(model, transitionMatrix)) {
+                explicitSubmatrix = getCachedSubmatrix(model, maybeStates, convertToEquationSystem);
+            } else {
+                // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
+                // into the matrix needed for solving the equation system (i.e. compute (I-A)).
+                submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                if (convertToEquationSystem) {
+                    submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
+                }
+                explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            }
             std::vector<ValueType> b = subvector.toVector(odd);
             conversionWatch.stop();
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/helper/HybridMdpPrctlHelper.h"
 
+#include "storm/modelchecker/helper/utility/CachedTransitionMatrix.h"
 #include "storm/modelchecker/prctl/helper/SymbolicMdpPrctlHelper.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
@@ -386,11 +387,15 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeIns
 
     storm::utility::Stopwatch conversionWatch;
 
-    // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    // Retrieve the ODD for the translation between symbolic and explicit storage.
+    storm::dd::Odd const& odd = model.getReachableStatesOdd();
 
-    // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+    // Translate the symbolic matrix to its explicit representations (unless it is cached by the model).
+    boost::optional<storm::storage::SparseMatrix<ValueType>> convertedMatrix;
+    if (!usesCachedTransitionMatrix(model, transitionMatrix)) {
+        convertedMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+    }
+    storm::storage::SparseMatrix<ValueType> const& explicitMatrix = convertedMatrix ? convertedMatrix.get() : model.getExplicitTransitionMatrix();
 
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
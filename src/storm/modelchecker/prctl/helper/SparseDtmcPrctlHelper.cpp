@@ -68,10 +68,6 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
 
-    // initialize data that will be needed for each epoch
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
-
     Environment preciseEnv = env;
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
@@ -88,13 +84,17 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    typedef storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true> RewardUnfoldingType;
+    auto createAnalyzer = [&preciseEnv, &lowerBound, &upperBound]() -> typename RewardUnfoldingType::EpochModelAnalyzer {
+        // initialize data that will be needed for each epoch
+        auto x = std::make_shared<std::vector<ValueType>>();
+        auto b = std::make_shared<std::vector<ValueType>>();
+        auto linEqSolver = std::make_shared<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>>();
+        return [&preciseEnv, &lowerBound, &upperBound, x, b, linEqSolver](storm::modelchecker::helper::rewardbounded::EpochModel<ValueType, true>& epochModel) {
+            return epochModel.analyzeSingleObjective(preciseEnv, *x, *b, *linEqSolver, lowerBound, upperBound);
+        };
+    };
+    auto epochAnalyzed = [&](typename RewardUnfoldingType::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -108,10 +108,9 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
-    }
+        return !storm::utility::resources::isTerminate();
+    };
+    rewardUnfolding.analyzeEpochs(epochOrder, createAnalyzer, epochAnalyzed, swBuild, swCheck);
 
     std::map<storm::storage::sparse::state_type, ValueType> result;
     for (auto initState : model.getInitialStates()) {
@@ -71,10 +71,6 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         auto initEpoch = rewardUnfolding.getStartEpoch();
         auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
 
-        // initialize data that will be needed for each epoch
-        std::vector<ValueType> x, b;
-        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
-
         ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
             initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
         Environment preciseEnv = env;
@@ -87,13 +83,17 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         progress.setMaxCount(epochOrder.size());
         progress.startNewMeasurement(0);
         uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
-            swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-            swCheck.stop();
+        typedef rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true> RewardUnfoldingType;
+        auto createAnalyzer = [&preciseEnv, &dir, &lowerBound, &upperBound]() -> typename RewardUnfoldingType::EpochModelAnalyzer {
+            // initialize data that will be needed for each epoch
+            auto x = std::make_shared<std::vector<ValueType>>();
+            auto b = std::make_shared<std::vector<ValueType>>();
+            auto minMaxSolver = std::make_shared<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>>();
+            return [&preciseEnv, &dir, &lowerBound, &upperBound, x, b, minMaxSolver](rewardbounded::EpochModel<ValueType, true>& epochModel) {
+                return epochModel.analyzeSingleObjective(preciseEnv, dir, *x, *b, *minMaxSolver, lowerBound, upperBound);
+            };
+        };
+        auto epochAnalyzed = [&](typename RewardUnfoldingType::Epoch const& epoch) {
             if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
                 !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                 std::vector<ValueType> cdfEntry;
@@ -107,10 +107,9 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
             }
             ++numCheckedEpochs;
             progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
-            }
-        }
+            return !storm::utility::resources::isTerminate();
+        };
+        rewardUnfolding.analyzeEpochs(epochOrder, createAnalyzer, epochAnalyzed, swBuild, swCheck);
 
         std::map<storm::storage::sparse::state_type, ValueType> result;
         for (auto initState : initialStates) {
@@ -1,9 +1,11 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
 #include <functional>
 #include <set>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
 
@@ -14,6 +16,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/storage/expressions/Expressions.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
@@ -401,6 +404,15 @@ template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
 
+    updateCurrentEpochClass(epoch);
+    setEpochSpecificData(epoch, epochModel);
+
+    currentEpoch = epoch;
+    return epochModel;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::updateCurrentEpochClass(Epoch const& epoch) {
     // Check if we need to update the current epoch class
     if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
         setCurrentEpochClass(epoch);
@@ -413,7 +425,11 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     } else {
         epochModel.epochMatrixChanged = false;
     }
+}
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEpochSpecificData(Epoch const& epoch,
+                                                                                           EpochModel<ValueType, SingleObjectiveMode>& targetEpochModel) {
     bool containsLowerBoundedObjective = false;
     for (auto const& dimension : dimensions) {
         if (dimension.boundType == DimensionBoundType::LowerBound) {
@@ -421,18 +437,23 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
             break;
         }
     }
+    // The solutions of the successor epochs are only released after the solution for this epoch has been stored.
+    // It is therefore safe to access them without holding the lock.
     std::map<Epoch, EpochSolution const*> subSolutions;
-    for (auto const& step : possibleEpochSteps) {
-        Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
-        if (successorEpoch != epoch) {
-            auto successorSolIt = epochSolutions.find(successorEpoch);
-            STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-            subSolutions.emplace(successorEpoch, &successorSolIt->second);
+    {
+        std::lock_guard<std::mutex> lock(epochSolutionsMutex);
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch) {
+                auto successorSolIt = epochSolutions.find(successorEpoch);
+                STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
+                subSolutions.emplace(successorEpoch, &successorSolIt->second);
+            }
         }
     }
-    epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
-    auto stepSolIt = epochModel.stepSolutions.begin();
-    for (auto reducedChoice : epochModel.stepChoices) {
+    targetEpochModel.stepSolutions.resize(targetEpochModel.stepChoices.getNumberOfSetBits());
+    auto stepSolIt = targetEpochModel.stepSolutions.begin();
+    for (auto reducedChoice : targetEpochModel.stepChoices) {
         uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
         auto const& memoryState = productModel->getMemoryState(productState);
@@ -443,7 +464,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         // a) there is an upper bounded subObjective that is __still_relevant__ but the corresponding reward bound is passed after taking the choice
         // b) there is a lower bounded subObjective and the corresponding reward bound is not passed yet.
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-            bool rewardEarned = !storm::utility::isZero(epochModel.objectiveRewards[objIndex][reducedChoice]);
+            bool rewardEarned = !storm::utility::isZero(targetEpochModel.objectiveRewards[objIndex][reducedChoice]);
             if (rewardEarned) {
                 for (auto dim : objectiveDimensions[objIndex]) {
                     if ((dimensions[dim].boundType == DimensionBoundType::UpperBound) == epochManager.isBottomDimension(successorEpoch, dim) &&
@@ -453,7 +474,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
                     }
                 }
             }
-            epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
+            targetEpochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
         }
         // compute the solution for the stepChoices
         // For optimization purposes, we distinguish the case where the memory state does not have to be transformed
@@ -486,28 +507,134 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         ++stepSolIt;
     }
 
-    assert(epochModel.objectiveRewards.size() == objectives.size());
-    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+    assert(targetEpochModel.objectiveRewards.size() == objectives.size());
+    assert(targetEpochModel.objectiveRewardFilter.size() == objectives.size());
+    assert(targetEpochModel.epochMatrix.getRowCount() == targetEpochModel.stepChoices.size());
+    assert(targetEpochModel.stepChoices.size() == targetEpochModel.objectiveRewards.front().size());
+    assert(targetEpochModel.objectiveRewards.front().size() == targetEpochModel.objectiveRewards.back().size());
+    assert(targetEpochModel.objectiveRewards.front().size() == targetEpochModel.objectiveRewardFilter.front().size());
+    assert(targetEpochModel.objectiveRewards.back().size() == targetEpochModel.objectiveRewardFilter.back().size());
+    assert(targetEpochModel.stepChoices.getNumberOfSetBits() == targetEpochModel.stepSolutions.size());
+}
 
-    currentEpoch = epoch;
-    /*
-    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
-    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
-    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
-    std::cout << "steps: " << epochModel.stepChoices << '\n';
-    std::cout << "step solutions: ";
-    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
-    }
-    std::cout << '\n';
-    */
-    return epochModel;
+template<typename ValueType, bool SingleObjectiveMode>
+bool MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(std::vector<Epoch> const& epochOrder,
+                                                                                    std::function<EpochModelAnalyzer()> const& createAnalyzer,
+                                                                                    std::function<bool(Epoch const&)> const& epochAnalyzed,
+                                                                                    storm::utility::Stopwatch& swBuild, storm::utility::Stopwatch& swCheck) {
+#ifdef STORM_HAVE_INTELTBB
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isParallelEpochsSet()) {
+        // The data used by a single thread for the analysis of the epochs of one epoch class.
+        struct ThreadData {
+            EpochModel<ValueType, SingleObjectiveMode> epochModel;
+            EpochModelAnalyzer analyzer;
+            storm::utility::Stopwatch swBuild;
+            storm::utility::Stopwatch swCheck;
+        };
+        std::unique_ptr<tbb::enumerable_thread_specific<ThreadData>> threadData;
+        auto collectStopwatches = [&threadData, &swBuild, &swCheck]() {
+            if (threadData) {
+                for (auto const& data : *threadData) {
+                    swBuild.add(data.swBuild);
+                    swCheck.add(data.swCheck);
+                }
+            }
+        };
+
+        for (auto const& batch : getEpochComputationBatches(epochOrder)) {
+            STORM_LOG_DEBUG("Analyzing " << batch.size() << " epochs concurrently, starting with epoch " << epochManager.toString(batch.front()) << ".");
+            if (!threadData || !epochManager.compareEpochClass(batch.front(), currentEpoch.get())) {
+                collectStopwatches();
+                swBuild.start();
+                updateCurrentEpochClass(batch.front());
+                swBuild.stop();
+                // The threads get a copy of the epoch model of the new epoch class (and a new analyzer) once they start working on it.
+                threadData = std::make_unique<tbb::enumerable_thread_specific<ThreadData>>([this, &createAnalyzer]() {
+                    ThreadData data{epochModel, createAnalyzer(), storm::utility::Stopwatch(), storm::utility::Stopwatch()};
+                    // The new analyzer has not seen the matrix of this epoch class yet.
+                    data.epochModel.epochMatrixChanged = true;
+                    return data;
+                });
+            }
+            currentEpoch = batch.back();
+
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batch.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                ThreadData& data = threadData->local();
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    data.swBuild.start();
+                    setEpochSpecificData(batch[index], data.epochModel);
+                    data.swBuild.stop();
+                    data.swCheck.start();
+                    std::vector<SolutionType> solution = data.analyzer(data.epochModel);
+                    data.epochModel.epochMatrixChanged = false;
+                    setSolutionForEpoch(batch[index], std::move(solution));
+                    data.swCheck.stop();
+                }
+            });
+
+            for (auto const& epoch : batch) {
+                if (!epochAnalyzed(epoch)) {
+                    collectStopwatches();
+                    return false;
+                }
+            }
+        }
+        collectStopwatches();
+        return true;
+    }
+#else
+    STORM_LOG_WARN_COND(!storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isParallelEpochsSet(),
+                        "Epochs are analyzed sequentially since Storm was built without TBB.");
+#endif
+    EpochModelAnalyzer analyzer = createAnalyzer();
+    bool firstEpoch = true;
+    for (auto const& epoch : epochOrder) {
+        swBuild.start();
+        auto& currentEpochModel = setCurrentEpoch(epoch);
+        // The new analyzer has not seen the matrix of the current epoch class yet.
+        currentEpochModel.epochMatrixChanged |= firstEpoch;
+        firstEpoch = false;
+        swBuild.stop();
+        swCheck.start();
+        setSolutionForCurrentEpoch(analyzer(currentEpochModel));
+        swCheck.stop();
+        if (!epochAnalyzed(epoch)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationBatches(std::vector<Epoch> const& epochOrder) const {
+    std::vector<std::vector<Epoch>> result;
+    // The epochs of one epoch class are consecutive in the computation order. Within such a block, we assign each epoch to the batch
+    // after the last batch that contains one of its successor epochs. Successors in other blocks have been analyzed before anyway.
+    std::map<Epoch, uint64_t> batchOfEpoch;
+    uint64_t firstBatchOfBlock = 0;
+    for (auto const& epoch : epochOrder) {
+        if (!batchOfEpoch.empty() && !epochManager.compareEpochClass(epoch, result.back().front())) {
+            batchOfEpoch.clear();
+            firstBatchOfBlock = result.size();
+        }
+        uint64_t batch = firstBatchOfBlock;
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch) {
+                auto successorIt = batchOfEpoch.find(successorEpoch);
+                if (successorIt != batchOfEpoch.end()) {
+                    batch = std::max(batch, successorIt->second + 1);
+                }
+            }
+        }
+        batchOfEpoch.emplace(epoch, batch);
+        if (batch == result.size()) {
+            result.emplace_back();
+        }
+        result[batch].push_back(epoch);
+    }
+    return result;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -860,16 +987,22 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    setSolutionForEpoch(currentEpoch.get(), std::move(inStateSolutions));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
+    std::lock_guard<std::mutex> lock(epochSolutionsMutex);
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
         auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
@@ -885,7 +1018,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     solution.count = predecessorEpochs.size();
     solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
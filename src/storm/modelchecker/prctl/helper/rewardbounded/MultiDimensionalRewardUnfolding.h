@@ -1,6 +1,8 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
+#include <mutex>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -64,6 +66,27 @@ class MultiDimensionalRewardUnfolding {
 
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
+    /*!
+     * A function that analyzes the given epoch model and returns the solutions for the in-states of the epoch.
+     */
+    typedef std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&)> EpochModelAnalyzer;
+
+    /*!
+     * Analyzes the given epochs and stores their solutions.
+     * If the concurrent analysis of epochs is enabled, epochs of the same epoch class that do not depend on each other are analyzed concurrently.
+     * Each thread then uses its own copy of the epoch model and its own analyzer.
+     *
+     * @param epochOrder The epochs to analyze in the order given by getEpochComputationOrder.
+     * @param createAnalyzer Creates a new analyzer. Each analyzer is only invoked by one thread at a time.
+     * @param epochAnalyzed Invoked sequentially (following the given order) for each epoch whose solution has been stored. If false is returned, the
+     * analysis stops.
+     * @param swBuild A stopwatch that is used to measure the time spent to build the epoch models.
+     * @param swCheck A stopwatch that is used to measure the time spent to analyze the epoch models.
+     * @return True iff the analysis was not stopped early.
+     */
+    bool analyzeEpochs(std::vector<Epoch> const& epochOrder, std::function<EpochModelAnalyzer()> const& createAnalyzer,
+                       std::function<bool(Epoch const&)> const& epochAnalyzed, storm::utility::Stopwatch& swBuild, storm::utility::Stopwatch& swCheck);
+
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
 
     /*!
@@ -86,6 +109,30 @@ class MultiDimensionalRewardUnfolding {
 
    private:
     void setCurrentEpochClass(Epoch const& epoch);
+
+    /*!
+     * Sets the epoch class of the given epoch if it differs from the one of the current epoch.
+     */
+    void updateCurrentEpochClass(Epoch const& epoch);
+
+    /*!
+     * Sets the data of the given epoch model that depends on the epoch (rather than on the epoch class).
+     * The given model has to be (a copy of) the epoch model of the epoch class of the given epoch.
+     * The solutions of all successor epochs have to be available.
+     */
+    void setEpochSpecificData(Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& targetEpochModel);
+
+    /*!
+     * Stores the solution of the given epoch (whose epoch class needs to be the current one) and releases
+     * the solutions that are not needed anymore.
+     */
+    void setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions);
+
+    /*!
+     * Splits the given epochs (given in computation order) into batches such that the epochs in one batch have the same epoch class and do
+     * not depend on each other, and each epoch only depends on epochs of previous batches.
+     */
+    std::vector<std::vector<Epoch>> getEpochComputationBatches(std::vector<Epoch> const& epochOrder) const;
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -121,6 +168,8 @@ class MultiDimensionalRewardUnfolding {
         std::vector<SolutionType> solutions;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
+    // Protects the structure of epochSolutions when epochs are analyzed concurrently.
+    std::mutex epochSolutionsMutex;
     EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
     SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
 
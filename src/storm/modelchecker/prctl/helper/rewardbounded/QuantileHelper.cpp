@@ -395,9 +395,22 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                                                 CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding) {
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
     auto upperBound = rewardUnfolding.getUpperObjectiveBound();
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;  // Needed for MDP
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;         // Needed for DTMC
+    bool const isNondeterministicModel = model.isNondeterministicModel();
+    auto createAnalyzer = [&env, &boundedUntilOperator, &lowerBound, &upperBound,
+                           &isNondeterministicModel]() -> typename MultiDimensionalRewardUnfolding<ValueType, true>::EpochModelAnalyzer {
+        auto x = std::make_shared<std::vector<ValueType>>();
+        auto b = std::make_shared<std::vector<ValueType>>();
+        auto minMaxSolver = std::make_shared<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>>();  // Needed for MDP
+        auto linEqSolver = std::make_shared<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>>();         // Needed for DTMC
+        return [&env, &boundedUntilOperator, &lowerBound, &upperBound, &isNondeterministicModel, x, b, minMaxSolver,
+                linEqSolver](EpochModel<ValueType, true>& epochModel) {
+            if (isNondeterministicModel) {
+                return epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), *x, *b, *minMaxSolver, lowerBound, upperBound);
+            } else {
+                return epochModel.analyzeSingleObjective(env, *x, *b, *linEqSolver, lowerBound, upperBound);
+            }
+        };
+    };
     if (!model.isNondeterministicModel()) {
         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
     }
@@ -432,18 +445,9 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                 }
                 STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
                 auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
+                bool insufficientPrecision = false;
+                auto epochAnalyzed = [&](typename MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
                     ++numCheckedEpochs;
-                    swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
-                    }
-                    swEpochAnalysis.stop();
-
                     CostLimits epochAsCostLimits;
                     if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
                                                    epochAsCostLimits)) {
@@ -456,7 +460,7 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                             propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
                             if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
                                 // unclear result due to insufficient precision.
-                                swExploration.stop();
+                                insufficientPrecision = true;
                                 return false;
                             }
                         } else {
@@ -468,6 +472,12 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                             unsatCostLimits.insert(epochAsCostLimits);
                         }
                     }
+                    return true;
+                };
+                rewardUnfolding.analyzeEpochs(epochSequence, createAnalyzer, epochAnalyzed, swEpochAnalysis, swEpochAnalysis);
+                if (insufficientPrecision) {
+                    swExploration.stop();
+                    return false;
                 }
             }
         } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
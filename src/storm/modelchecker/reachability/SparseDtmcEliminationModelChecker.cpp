@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <type_traits>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -28,6 +30,7 @@
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -876,6 +879,23 @@ void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedS
     std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
     storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates,
     bool computeResultsForInitialStatesOnly) {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (!std::is_same_v<ValueType, storm::RationalFunction>) {
+        if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isParallelEliminationSet() &&
+            transitionMatrix.hasTrivialRowGrouping()) {
+            performParallelPrioritizedStateElimination(priorityQueue, transitionMatrix, backwardTransitions, values, initialStates,
+                                                       computeResultsForInitialStatesOnly);
+            return;
+        }
+    } else {
+        // Arithmetic on rational functions shares caches that are not thread-safe.
+        STORM_LOG_WARN_COND(!storm::settings::getModule<storm::settings::modules::EliminationSettings>().isParallelEliminationSet(),
+                            "Parallel state elimination is not supported for parametric models. Falling back to sequential elimination.");
+    }
+#else
+    STORM_LOG_WARN_COND(!storm::settings::getModule<storm::settings::modules::EliminationSettings>().isParallelEliminationSet(),
+                        "Parallel state elimination requires TBB support. Falling back to sequential elimination.");
+#endif
     storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
 
     while (priorityQueue->hasNext()) {
@@ -891,6 +911,106 @@ void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedS
     }
 }
 
+template<typename SparseDtmcModelType>
+void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performParallelPrioritizedStateElimination(
+    std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates,
+    bool computeResultsForInitialStatesOnly) {
+#ifdef STORM_HAVE_INTELTBB
+    // Each task uses its own eliminator. As the priority queue must not be updated concurrently, the eliminators get an empty queue
+    // and the priorities are updated after each round instead.
+    std::shared_ptr<StatePriorityQueue> noPriorities = std::make_shared<StaticStatePriorityQueue>(std::vector<storm::storage::sparse::state_type>());
+
+    // The number of states that are considered for elimination in one round.
+    uint64_t const numberOfCandidatesPerRound = 32 * std::max<uint64_t>(1, storm::utility::getNumberOfThreads());
+
+    // States whose rows are modified by the elimination of a selected state.
+    storm::storage::BitVector touchedStates(transitionMatrix.getRowCount(), false);
+    std::vector<storm::storage::sparse::state_type> touchedStatesList;
+    std::vector<storm::storage::sparse::state_type> candidates;
+    std::vector<storm::storage::sparse::state_type> deferredCandidates;
+    std::vector<storm::storage::sparse::state_type> selectedStates;
+    std::vector<storm::storage::sparse::state_type> statesToUpdate;
+    uint64_t numberOfRounds = 0;
+    while (priorityQueue->hasNext()) {
+        // The candidates are the states with lowest penalty. The first candidate is always selected, so every round makes progress.
+        candidates.clear();
+        deferredCandidates.clear();
+        while (candidates.size() < numberOfCandidatesPerRound && priorityQueue->hasNext()) {
+            candidates.push_back(priorityQueue->pop());
+        }
+
+        // Greedily select states such that their eliminations modify disjoint sets of rows.
+        // Eliminating a state modifies its own rows, the forward rows of its predecessors and the backward rows of its successors.
+        selectedStates.clear();
+        statesToUpdate.clear();
+        for (auto const& state : candidates) {
+            bool independent = !touchedStates.get(state);
+            for (auto const& entry : transitionMatrix.getRow(state)) {
+                independent &= !touchedStates.get(entry.getColumn());
+            }
+            for (auto const& entry : backwardTransitions.getRow(state)) {
+                independent &= !touchedStates.get(entry.getColumn());
+            }
+            if (!independent) {
+                deferredCandidates.push_back(state);
+                continue;
+            }
+            selectedStates.push_back(state);
+            touchedStates.set(state);
+            touchedStatesList.push_back(state);
+            for (auto const& entry : transitionMatrix.getRow(state)) {
+                if (!touchedStates.get(entry.getColumn())) {
+                    touchedStates.set(entry.getColumn());
+                    touchedStatesList.push_back(entry.getColumn());
+                }
+            }
+            for (auto const& entry : backwardTransitions.getRow(state)) {
+                if (entry.getColumn() != state) {
+                    statesToUpdate.push_back(entry.getColumn());
+                }
+                if (!touchedStates.get(entry.getColumn())) {
+                    touchedStates.set(entry.getColumn());
+                    touchedStatesList.push_back(entry.getColumn());
+                }
+            }
+        }
+
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, selectedStates.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, noPriorities, values);
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                storm::storage::sparse::state_type state = selectedStates[index];
+                bool removeForwardTransitions = computeResultsForInitialStatesOnly && !initialStates.get(state);
+                stateEliminator.eliminateState(state, removeForwardTransitions);
+                if (removeForwardTransitions) {
+                    values[state] = storm::utility::zero<ValueType>();
+                }
+            }
+        });
+
+        for (auto const& state : touchedStatesList) {
+            touchedStates.set(state, false);
+        }
+        touchedStatesList.clear();
+        for (auto const& state : statesToUpdate) {
+            priorityQueue->update(state);
+        }
+        // The states that could not be selected are re-queued with their updated priorities. Pushing them in reverse order retains their order
+        // for static priorities.
+        for (auto stateIt = deferredCandidates.rbegin(); stateIt != deferredCandidates.rend(); ++stateIt) {
+            priorityQueue->push(*stateIt);
+        }
+        ++numberOfRounds;
+#ifdef STORM_DEV
+        STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
+#endif
+    }
+    STORM_LOG_DEBUG("Eliminated states in " << numberOfRounds << " rounds.");
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Parallel state elimination requires TBB.");
+#endif
+}
+
 template<typename SparseDtmcModelType>
 void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performOrdinaryStateElimination(
     storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
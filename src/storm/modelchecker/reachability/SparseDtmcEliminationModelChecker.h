@@ -89,6 +89,15 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
                                                    storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values,
                                                    storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly);
 
+    /*!
+     * Eliminates the states of the given queue in rounds. In each round, states with low penalty are selected such that no two of them are adjacent or
+     * have a common neighbor. The selected states are then eliminated concurrently.
+     */
+    static void performParallelPrioritizedStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue,
+                                                           storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
+                                                           storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values,
+                                                           storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly);
+
     static void performOrdinaryStateElimination(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                 storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
                                                 storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates,
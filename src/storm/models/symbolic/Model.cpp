@@ -15,6 +15,9 @@
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/dd/Odd.h"
+
 #include "storm/utility/constants.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
@@ -179,9 +182,32 @@ storm::dd::Add<Type, ValueType> const& Model<Type, ValueType>::getTransitionMatr
 
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Add<Type, ValueType>& Model<Type, ValueType>::getTransitionMatrix() {
+    explicitTransitionMatrix.reset();
     return transitionMatrix;
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Odd const& Model<Type, ValueType>::getReachableStatesOdd() const {
+    if (!reachableStatesOdd) {
+        reachableStatesOdd = std::make_shared<storm::dd::Odd const>(this->getReachableStates().createOdd());
+    }
+    return *reachableStatesOdd;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& Model<Type, ValueType>::getExplicitTransitionMatrix() const {
+    if (!explicitTransitionMatrix) {
+        storm::dd::Odd const& odd = this->getReachableStatesOdd();
+        if (this->getNondeterminismVariables().empty()) {
+            explicitTransitionMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(this->getTransitionMatrix().toMatrix(odd, odd));
+        } else {
+            explicitTransitionMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(
+                this->getTransitionMatrix().toMatrix(this->getNondeterminismVariables(), odd, odd));
+        }
+    }
+    return *explicitTransitionMatrix;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> Model<Type, ValueType>::getQualitativeTransitionMatrix(bool) const {
     return this->getTransitionMatrix().notZero();
@@ -226,6 +252,7 @@ std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable
 template<storm::dd::DdType Type, typename ValueType>
 void Model<Type, ValueType>::setTransitionMatrix(storm::dd::Add<Type, ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    explicitTransitionMatrix.reset();
 }
 
 template<storm::dd::DdType Type, typename ValueType>
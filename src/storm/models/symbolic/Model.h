@@ -26,8 +26,15 @@ class Dd;
 template<storm::dd::DdType Type>
 class DdManager;
 
+class Odd;
+
 }  // namespace dd
 
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
 namespace adapters {
 template<storm::dd::DdType Type, typename ValueType>
 class AddExpressionAdapter;
@@ -187,12 +194,32 @@ class Model : public storm::models::Model<CValueType> {
     storm::dd::Add<Type, ValueType> const& getTransitionMatrix() const;
 
     /*!
-     * Retrieves the matrix representing the transitions of the model.
+     * Retrieves the matrix representing the transitions of the model. As the matrix may be modified via the
+     * returned reference, this invalidates the cached explicit representation of the transition matrix.
      *
      * @return A matrix representing the transitions of the model.
      */
     storm::dd::Add<Type, ValueType>& getTransitionMatrix();
 
+    /*!
+     * Retrieves the ODD of the reachable states of the model. The ODD is only built upon the first request and
+     * then cached.
+     *
+     * @return The ODD of the reachable states.
+     */
+    storm::dd::Odd const& getReachableStatesOdd() const;
+
+    /*!
+     * Retrieves an explicit representation of the transition matrix of the model whose rows (row groups for
+     * nondeterministic models) and columns are given by the ODD of the reachable states. The matrix is only
+     * built upon the first request and then cached, so that repeated (hybrid) analyses of the same model can
+     * derive their equation systems from it instead of converting the symbolic matrix again. The cached matrix is kept
+     * as long as the model exists and its transition matrix is not modified.
+     *
+     * @return The explicit transition matrix.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getExplicitTransitionMatrix() const;
+
     /*!
      * Retrieves the matrix qualitatively (i.e. without probabilities) representing the transitions of the
      * model.
@@ -436,6 +463,14 @@ class Model : public storm::models::Model<CValueType> {
 
     // An empty variable set that can be used when references to non-existing sets need to be returned.
     std::set<storm::expressions::Variable> emptyVariableSet;
+
+    // The (lazily built) ODD of the reachable states.
+    mutable std::shared_ptr<storm::dd::Odd const> reachableStatesOdd;
+
+    // The (lazily built) explicit representation of the transition matrix w.r.t. the ODD of the reachable states. Once built, it takes as much
+    // memory as the transition matrix of the corresponding sparse model (about 16 bytes per transition) until the model is destroyed or its
+    // transition matrix is modified. The hybrid engine only builds it if --no-explicit-matrix-cache is not set.
+    mutable std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitTransitionMatrix;
 };
 
 }  // namespace symbolic
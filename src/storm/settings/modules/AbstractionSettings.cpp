@@ -34,6 +34,7 @@ const std::string AbstractionSettings::injectRefinementPredicatesOptionName = "i
 const std::string AbstractionSettings::fixPlayer1StrategyOptionName = "fixpl1strat";
 const std::string AbstractionSettings::fixPlayer2StrategyOptionName = "fixpl2strat";
 const std::string AbstractionSettings::validBlockModeOptionName = "validmode";
+const std::string AbstractionSettings::parallelAbstractionOptionName = "parallel";
 
 AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"games", "bisimulation", "bisim"};
@@ -214,6 +215,15 @@ AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("morepreds")
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelAbstractionOptionName, true,
+                                                   "Sets whether the abstractions of commands (or edges) are computed concurrently (requires TBB).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("value", "The value of the flag.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(onOff))
+                                         .setDefaultValueString("off")
+                                         .build())
+                        .build());
 }
 
 AbstractionSettings::Method AbstractionSettings::getAbstractionRefinementMethod() const {
@@ -266,6 +276,10 @@ void AbstractionSettings::setAddAllInitialExpressions(bool value) {
     this->getOption(addInitialExpressionsOptionName).getArgumentByName("value").setFromStringValue(value ? "on" : "off");
 }
 
+void AbstractionSettings::setParallelAbstraction(bool value) {
+    this->getOption(parallelAbstractionOptionName).getArgumentByName("value").setFromStringValue(value ? "on" : "off");
+}
+
 bool AbstractionSettings::isUseInterpolationSet() const {
     return this->getOption(useInterpolationOptionName).getArgumentByName("value").getValueAsString() == "on";
 }
@@ -332,6 +346,10 @@ bool AbstractionSettings::isDebugSet() const {
     return this->getOption(debugOptionName).getArgumentByName("value").getValueAsString() == "on";
 }
 
+bool AbstractionSettings::isParallelAbstractionSet() const {
+    return this->getOption(parallelAbstractionOptionName).getArgumentByName("value").getValueAsString() == "on";
+}
+
 bool AbstractionSettings::isInjectRefinementPredicatesSet() const {
     return this->getOption(injectRefinementPredicatesOptionName).getHasOptionBeenSet();
 }
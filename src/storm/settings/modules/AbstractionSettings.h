@@ -183,6 +183,18 @@ class AbstractionSettings : public ModuleSettings {
      */
     ValidBlockMode getValidBlockMode() const;
 
+    /*!
+     * Retrieves whether the abstractions of different commands (or edges) are to be computed concurrently.
+     */
+    bool isParallelAbstractionSet() const;
+
+    /*!
+     * Sets the option to compute the abstractions of different commands (or edges) concurrently to the specified value.
+     *
+     * @param value The new value.
+     */
+    void setParallelAbstraction(bool value);
+
     const static std::string moduleName;
 
    private:
@@ -207,6 +219,7 @@ class AbstractionSettings : public ModuleSettings {
     const static std::string fixPlayer1StrategyOptionName;
     const static std::string fixPlayer2StrategyOptionName;
     const static std::string validBlockModeOptionName;
+    const static std::string parallelAbstractionOptionName;
 };
 
 }  // namespace modules
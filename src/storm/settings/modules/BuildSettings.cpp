@@ -37,8 +37,10 @@ const std::string buildAllLabelsOptionName = "build-all-labels";
 const std::string buildOutOfBoundsStateOptionName = "build-out-of-bounds-state";
 const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
 const std::string noSimplifyOptionName = "no-simplify";
+const std::string expressionHashConsingOptionName = "expression-hash-consing";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
+const std::string ddVariableOrderingOptionName = "ddvarorder";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -93,6 +95,10 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                         .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, expressionHashConsingOptionName, false,
+                                                   "If set, structurally equal expressions of the symbolic input share their representation.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false,
                                                    "Sets the number of bits that is used for unbounded integer variables.")
                         .setIsAdvanced()
@@ -115,6 +121,18 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .makeOptional()
                                          .build())
                         .build());
+    std::vector<std::string> ddVariableOrderings = {"declaration", "force"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false,
+                                                   "Sets the heuristic that determines the order of the DD variables when building symbolic models.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name",
+                                         "The name of the heuristic. 'declaration' uses the order of declaration in the model, 'force' places interacting "
+                                         "variables close to each other.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderings))
+                                         .setDefaultValueString("declaration")
+                                         .build())
+                        .build());
 }
 
 bool BuildSettings::isExplorationOrderSet() const {
@@ -191,6 +209,10 @@ bool BuildSettings::isNoSimplifySet() const {
     return this->getOption(noSimplifyOptionName).getHasOptionBeenSet();
 }
 
+bool BuildSettings::isExpressionHashConsingSet() const {
+    return this->getOption(expressionHashConsingOptionName).getHasOptionBeenSet();
+}
+
 uint64_t BuildSettings::getBitsForUnboundedVariables() const {
     return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
@@ -206,6 +228,16 @@ uint64_t BuildSettings::getLocationEliminationLocationHeuristic() const {
 uint64_t BuildSettings::getLocationEliminationEdgesHeuristic() const {
     return this->getOption(performLocationElimination).getArgumentByName("edges-heuristic").getValueAsUnsignedInteger();
 }
+
+storm::builder::DdVariableOrdering BuildSettings::getDdVariableOrdering() const {
+    std::string orderingAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+    if (orderingAsString == "declaration") {
+        return storm::builder::DdVariableOrdering::Declaration;
+    } else if (orderingAsString == "force") {
+        return storm::builder::DdVariableOrdering::Force;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown DD variable ordering '" << orderingAsString << "'.");
+}
 }  // namespace modules
 
 }  // namespace settings
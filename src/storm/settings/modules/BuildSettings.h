@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-config.h"
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
@@ -124,6 +125,11 @@ class BuildSettings : public ModuleSettings {
      */
     bool isNoSimplifySet() const;
 
+    /*!
+     * Retrieves whether the expressions of symbolic inputs shall be hash-consed
+     */
+    bool isExpressionHashConsingSet() const;
+
     /*!
      * Retrieves whether location elimination is enabled
      */
@@ -139,6 +145,13 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getLocationEliminationEdgesHeuristic() const;
 
+    /*!
+     * Retrieves the heuristic that determines the order of DD variables when building symbolic models.
+     *
+     * @return The chosen heuristic.
+     */
+    storm::builder::DdVariableOrdering getDdVariableOrdering() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
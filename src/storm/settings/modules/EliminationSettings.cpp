@@ -4,6 +4,7 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingMemento.h"
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/utility/macros.h"
@@ -18,6 +19,7 @@ const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+const std::string EliminationSettings::parallelEliminationOptionName = "parallel";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
@@ -54,6 +56,11 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelEliminationOptionName, true,
+                                                   "Sets whether states without common neighbors are eliminated concurrently (only non-parametric DTMCs, "
+                                                   "requires TBB).")
+                        .setIsAdvanced()
+                        .build());
 }
 
 EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -101,6 +108,14 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
+
+bool EliminationSettings::isParallelEliminationSet() const {
+    return this->getOption(parallelEliminationOptionName).getHasOptionBeenSet();
+}
+
+std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideParallelEliminationSet(bool stateToSet) {
+    return this->overrideOption(parallelEliminationOptionName, stateToSet);
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -62,6 +62,22 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves whether independent states are to be eliminated concurrently.
+     *
+     * @return True iff the option was set.
+     */
+    bool isParallelEliminationSet() const;
+
+    /*!
+     * Overrides the option to eliminate independent states concurrently by setting it to the specified value. As soon as the
+     * returned memento goes out of scope, the original value is restored.
+     *
+     * @param stateToSet The value that is to be set for the option.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overrideParallelEliminationSet(bool stateToSet);
+
     const static std::string moduleName;
 
    private:
@@ -70,6 +86,7 @@ class EliminationSettings : public ModuleSettings {
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string parallelEliminationOptionName;
 };
 
 }  // namespace modules
@@ -14,6 +14,8 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::parallelEpochsOptionName = "parallel-epochs";
+const std::string ModelCheckerSettings::noExplicitMatrixCacheOptionName = "no-explicit-matrix-cache";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +29,15 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelEpochsOptionName, false,
+                                                   "If set, independent epochs of reward-bounded properties are analyzed concurrently (requires TBB).")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, noExplicitMatrixCacheOptionName, false,
+                                                   "If set, the hybrid engine converts the transition matrix of the model for each analysis instead of caching "
+                                                   "it. This saves the memory of the cached matrix, which is about as large as the matrix of the sparse model.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +52,22 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isParallelEpochsSet() const {
+    return this->getOption(parallelEpochsOptionName).getHasOptionBeenSet();
+}
+
+std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideParallelEpochsSet(bool stateToSet) {
+    return this->overrideOption(parallelEpochsOptionName, stateToSet);
+}
+
+bool ModelCheckerSettings::isNoExplicitMatrixCacheSet() const {
+    return this->getOption(noExplicitMatrixCacheOptionName).getHasOptionBeenSet();
+}
+
+std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideNoExplicitMatrixCacheSet(bool stateToSet) {
+    return this->overrideOption(noExplicitMatrixCacheOptionName, stateToSet);
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
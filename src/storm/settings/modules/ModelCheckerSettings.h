@@ -35,6 +35,38 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether independent epochs of reward-bounded properties are to be analyzed concurrently.
+     *
+     * @return True iff the option was set.
+     */
+    bool isParallelEpochsSet() const;
+
+    /*!
+     * Overrides the option to analyze independent epochs concurrently by setting it to the specified value. As soon as the returned memento goes out of
+     * scope, the original value is restored.
+     *
+     * @param stateToSet The value that is to be set for the option.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overrideParallelEpochsSet(bool stateToSet);
+
+    /*!
+     * Retrieves whether the explicit transition matrix of symbolic models is to be converted for each hybrid analysis instead of being cached.
+     *
+     * @return True iff the option was set.
+     */
+    bool isNoExplicitMatrixCacheSet() const;
+
+    /*!
+     * Overrides the option to not cache the explicit transition matrix of symbolic models by setting it to the specified value. As soon as the
+     * returned memento goes out of scope, the original value is restored.
+     *
+     * @param stateToSet The value that is to be set for the option.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overrideNoExplicitMatrixCacheSet(bool stateToSet);
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +74,8 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string parallelEpochsOptionName;
+    static const std::string noExplicitMatrixCacheOptionName;
 };
 
 }  // namespace modules
@@ -15,6 +15,7 @@ const std::string MultiObjectiveSettings::methodOptionName = "method";
 const std::string MultiObjectiveSettings::exportPlotOptionName = "exportplot";
 const std::string MultiObjectiveSettings::precisionOptionName = "precision";
 const std::string MultiObjectiveSettings::maxStepsOptionName = "maxsteps";
+const std::string MultiObjectiveSettings::batchSizeOptionName = "batchsize";
 const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "purescheds";
 const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
 const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
@@ -56,6 +57,15 @@ MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
                                          "value", "the threshold for the number of refinement steps to be performed.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true,
+                                                   "Sets the number of refinement steps that are performed concurrently when approximating pareto curves. "
+                                                   "Values greater than one also solve the total reward objectives of a refinement step concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "the number of concurrent refinement steps.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
     std::vector<std::string> memoryPatterns = {"positional", "goalmemory", "arbitrary", "counter"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, schedulerRestrictionOptionName, false,
@@ -145,6 +155,10 @@ uint_fast64_t MultiObjectiveSettings::getMaxSteps() const {
     return this->getOption(maxStepsOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
 
+uint64_t MultiObjectiveSettings::getBatchSize() const {
+    return this->getOption(batchSizeOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
 bool MultiObjectiveSettings::hasSchedulerRestriction() const {
     return this->getOption(schedulerRestrictionOptionName).getHasOptionBeenSet();
 }
@@ -66,6 +66,11 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     uint_fast64_t getMaxSteps() const;
 
+    /*!
+     * Retrieves the number of refinement steps that are performed concurrently when approximating pareto curves.
+     */
+    uint64_t getBatchSize() const;
+
     /*!
      * Retrieves whether a scheduler restriction has been set.
      */
@@ -140,6 +145,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string exportPlotOptionName;
     const static std::string precisionOptionName;
     const static std::string maxStepsOptionName;
+    const static std::string batchSizeOptionName;
     const static std::string schedulerRestrictionOptionName;
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
@@ -16,6 +16,7 @@ const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::profileJsonOptionName = "profile-json";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -35,6 +36,12 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, profileJsonOptionName, false,
+                                                   "Writes the time, the resident set size at entry and exit and the peak resident set size of the individual "
+                                                   "phases (parsing, building, ...) to a json file.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to write to.").build())
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -53,6 +60,14 @@ uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isProfileJsonSet() const {
+    return this->getOption(profileJsonOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getProfileJsonFilename() const {
+    return this->getOption(profileJsonOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
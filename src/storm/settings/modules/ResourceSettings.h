@@ -47,6 +47,20 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether the profiling data of the individual phases shall be written to a json file.
+     *
+     * @return True iff the option was set.
+     */
+    bool isProfileJsonSet() const;
+
+    /*!
+     * Retrieves the name of the file to which the profiling data is written.
+     *
+     * @return The name of the file.
+     */
+    std::string getProfileJsonFilename() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -57,6 +71,7 @@ class ResourceSettings : public ModuleSettings {
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string profileJsonOptionName;
 };
 }  // namespace modules
 }  // namespace settings
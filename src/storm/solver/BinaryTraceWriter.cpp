@@ -0,0 +1,116 @@
+#include "storm/solver/BinaryTraceWriter.h"
+
+#include <cstring>
+#include <memory>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+char const traceFileHeader[] = "STORMIT1";
+uint64_t const traceFileHeaderSize = 8;
+uint64_t const bufferSize = 4096 * BinaryTraceWriter::recordSize;
+
+template<typename T>
+char* store(char* position, T const& value) {
+    std::memcpy(position, &value, sizeof(T));
+    return position + sizeof(T);
+}
+
+template<typename T>
+char const* load(char const* position, T& value) {
+    std::memcpy(&value, position, sizeof(T));
+    return position + sizeof(T);
+}
+}  // namespace
+
+BinaryTraceWriter::BinaryTraceWriter(std::string const& filename) {
+    stream.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    stream.write(traceFileHeader, traceFileHeaderSize);
+    buffer.reserve(bufferSize);
+}
+
+BinaryTraceWriter::~BinaryTraceWriter() {
+    flush();
+}
+
+void BinaryTraceWriter::write(IterationRecord const& record) {
+    char data[recordSize];
+    uint8_t mask = (record.residual ? 1 : 0) | (record.boundGap ? 2 : 0) | (record.changedChoices ? 4 : 0);
+    char* position = store(data, static_cast<uint8_t>(record.method));
+    position = store(position, mask);
+    position = store(position, record.iteration);
+    position = store(position, record.residual.value_or(0.0));
+    position = store(position, record.boundGap.value_or(0.0));
+    position = store(position, record.changedChoices.value_or(0ull));
+    position = store(position, record.sweepTimeInNanoseconds);
+    STORM_LOG_ASSERT(position == data + recordSize, "Unexpected size of record.");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    buffer.insert(buffer.end(), data, data + recordSize);
+    if (buffer.size() >= bufferSize) {
+        flushBuffer();
+    }
+}
+
+void BinaryTraceWriter::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    flushBuffer();
+    stream.flush();
+}
+
+void BinaryTraceWriter::flushBuffer() {
+    stream.write(buffer.data(), buffer.size());
+    buffer.clear();
+}
+
+IterationTelemetryCallback BinaryTraceWriter::createCallback(std::string const& filename) {
+    auto writer = std::make_shared<BinaryTraceWriter>(filename);
+    return [writer](IterationRecord const& record) { writer->write(record); };
+}
+
+std::vector<IterationRecord> BinaryTraceWriter::read(std::string const& filename) {
+    std::ifstream input(filename, std::ios::in | std::ios::binary);
+    STORM_LOG_THROW(input, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    char header[traceFileHeaderSize];
+    input.read(header, traceFileHeaderSize);
+    STORM_LOG_THROW(input && std::memcmp(header, traceFileHeader, traceFileHeaderSize) == 0, storm::exceptions::WrongFormatException,
+                    "File " << filename << " is not an iteration trace.");
+
+    std::vector<IterationRecord> result;
+    char data[recordSize];
+    while (input.read(data, recordSize)) {
+        IterationRecord record;
+        uint8_t method, mask;
+        double residual, boundGap;
+        uint64_t changedChoices;
+        char const* position = load(data, method);
+        position = load(position, mask);
+        position = load(position, record.iteration);
+        position = load(position, residual);
+        position = load(position, boundGap);
+        position = load(position, changedChoices);
+        load(position, record.sweepTimeInNanoseconds);
+        record.method = static_cast<IterationMethod>(method);
+        if (mask & 1) {
+            record.residual = residual;
+        }
+        if (mask & 2) {
+            record.boundGap = boundGap;
+        }
+        if (mask & 4) {
+            record.changedChoices = changedChoices;
+        }
+        result.push_back(std::move(record));
+    }
+    STORM_LOG_THROW(input.gcount() == 0, storm::exceptions::WrongFormatException, "Trace file " << filename << " ends with an incomplete record.");
+    return result;
+}
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "storm/solver/IterationTelemetry.h"
+
+namespace storm {
+namespace solver {
+
+/*!
+ * Writes iteration records to a file in a compact binary format.
+ *
+ * The file starts with the eight characters "STORMIT1". Each record then consists of
+ * - the method (1 byte),
+ * - a bit mask indicating which of residual (1), bound gap (2) and changed choices (4) are set (1 byte),
+ * - the iteration (8 bytes), the residual (8 bytes), the bound gap (8 bytes), the changed choices (8 bytes) and the time in nanoseconds (8 bytes),
+ * where numbers are stored in the byte order of the machine.
+ * Records are buffered and written in blocks. Writing is thread-safe, so the same writer can be used by concurrently running solvers.
+ */
+class BinaryTraceWriter {
+   public:
+    static constexpr uint64_t recordSize = 42;
+
+    explicit BinaryTraceWriter(std::string const& filename);
+    ~BinaryTraceWriter();
+
+    BinaryTraceWriter(BinaryTraceWriter const&) = delete;
+    BinaryTraceWriter& operator=(BinaryTraceWriter const&) = delete;
+
+    /*!
+     * Appends the given record to the trace.
+     */
+    void write(IterationRecord const& record);
+
+    /*!
+     * Writes all buffered records to the file.
+     */
+    void flush();
+
+    /*!
+     * Creates a callback that writes all records to the given file.
+     * The file is closed once all copies of the callback are destroyed.
+     */
+    static IterationTelemetryCallback createCallback(std::string const& filename);
+
+    /*!
+     * Reads all records from the given trace file.
+     */
+    static std::vector<IterationRecord> read(std::string const& filename);
+
+   private:
+    void flushBuffer();
+
+    std::ofstream stream;
+    std::vector<char> buffer;
+    std::mutex mutex;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace storm {
+namespace solver {
+
+/*!
+ * The iterative methods that report telemetry data.
+ */
+enum class IterationMethod : uint8_t { ValueIteration = 0, IntervalIteration = 1, SoundValueIteration = 2, OptimisticValueIteration = 3 };
+
+/*!
+ * Data about a single iteration (sweep over all states) of an iterative solution method.
+ * Quantities that the method does not compute are not set.
+ */
+struct IterationRecord {
+    IterationMethod method;
+    // The number of the iteration (counting from one).
+    uint64_t iteration;
+    // The maximal absolute difference between the values before and after the iteration.
+    std::optional<double> residual;
+    // The maximal difference between the upper and the lower bound after the iteration.
+    std::optional<double> boundGap;
+    // The number of states whose currently optimal choice changed during the iteration.
+    std::optional<uint64_t> changedChoices;
+    // The time spent in the iteration.
+    uint64_t sweepTimeInNanoseconds;
+};
+
+/*!
+ * A callback that is invoked after each iteration of an iterative method.
+ */
+using IterationTelemetryCallback = std::function<void(IterationRecord const&)>;
+
+/*!
+ * Collects the data of the iterations of one invocation of an iterative method and passes it to the callback.
+ * All operations are no-ops if there is no callback.
+ */
+class IterationTelemetry {
+   public:
+    IterationTelemetry(IterationTelemetryCallback const& callback, IterationMethod method) : callback(callback), method(method) {
+        // Intentionally left empty.
+    }
+
+    bool isEnabled() const {
+        return static_cast<bool>(callback);
+    }
+
+    void startSweep() {
+        if (isEnabled()) {
+            sweepStart = std::chrono::steady_clock::now();
+        }
+    }
+
+    void endSweep(uint64_t iteration, std::optional<double> residual = {}, std::optional<double> boundGap = {},
+                  std::optional<uint64_t> changedChoices = {}) const {
+        if (isEnabled()) {
+            auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sweepStart).count();
+            callback(IterationRecord{method, iteration, residual, boundGap, changedChoices, static_cast<uint64_t>(time)});
+        }
+    }
+
+   private:
+    IterationTelemetryCallback const& callback;
+    IterationMethod method;
+    std::chrono::steady_clock::time_point sweepStart;
+};
+
+}  // namespace solver
+}  // namespace storm
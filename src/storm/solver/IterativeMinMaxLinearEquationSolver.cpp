@@ -436,6 +436,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         setUpViOperator();
 
         helper::OptimisticValueIterationHelper<ValueType, false> oviHelper(viOperator);
+        oviHelper.setIterationTelemetryCallback(env.solver().getIterationTelemetryCallback());
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
         std::optional<ValueType> lowerBound, upperBound;
         if (this->hasLowerBound()) {
@@ -530,6 +531,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
     }
 
     storm::solver::helper::ValueIterationHelper<ValueType, false, SolutionType> viHelper(viOperator);
+    viHelper.setIterationTelemetryCallback(env.solver().getIterationTelemetryCallback());
     uint64_t numIterations{0};
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
@@ -574,6 +576,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
     } else {
         setUpViOperator();
         helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
+        iiHelper.setIterationTelemetryCallback(env.solver().getIterationTelemetryCallback());
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
         auto lowerBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createLowerBoundsVector(vector); };
         auto upperBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createUpperBoundsVector(vector); };
@@ -638,6 +641,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         };
         this->startMeasureProgress();
         helper::SoundValueIterationHelper<ValueType, false> sviHelper(viOperator);
+        sviHelper.setIterationTelemetryCallback(env.solver().getIterationTelemetryCallback());
         std::optional<storm::storage::BitVector> optionalRelevantValues;
         if (this->hasRelevantValues()) {
             optionalRelevantValues = this->getRelevantValues();
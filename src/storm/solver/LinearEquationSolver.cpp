@@ -11,6 +11,7 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include "storm/utility/Profiler.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -29,6 +30,7 @@ LinearEquationSolver<ValueType>::LinearEquationSolver() : cachingEnabled(false)
 
 template<typename ValueType>
 bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    storm::utility::ProfilingScope profilingScope("equation solving");
     return this->internalSolveEquations(env, x, b);
 }
 
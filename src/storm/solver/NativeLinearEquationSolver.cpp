@@ -374,6 +374,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     }
 
     storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
+    viHelper.setIterationTelemetryCallback(env.solver().getIterationTelemetryCallback());
     uint64_t numIterations{0};
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
@@ -426,6 +427,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (IntervalIteration)");
     setUpViOperator();
     helper::IntervalIterationHelper<ValueType, true> iiHelper(viOperator);
+    iiHelper.setIterationTelemetryCallback(env.solver().getIterationTelemetryCallback());
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
     auto upperBoundsCallback = [&](std::vector<ValueType>& vector) { this->createUpperBoundsVector(vector); };
@@ -483,6 +485,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
     }
     this->startMeasureProgress();
     helper::SoundValueIterationHelper<ValueType, true> sviHelper(viOperator);
+    sviHelper.setIterationTelemetryCallback(env.solver().getIterationTelemetryCallback());
     auto status = sviHelper.SVI(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(), precision, {}, lowerBound, upperBound,
                                 sviCallback, optionalRelevantValues);
 
@@ -507,6 +510,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
     setUpViOperator();
 
     helper::OptimisticValueIterationHelper<ValueType, true> oviHelper(viOperator);
+    oviHelper.setIterationTelemetryCallback(env.solver().getIterationTelemetryCallback());
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     std::optional<ValueType> lowerBound, upperBound;
     if (this->hasLowerBound()) {
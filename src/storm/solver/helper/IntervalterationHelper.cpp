@@ -103,9 +103,18 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pai
     } else {
         getNextConvergenceCheckState = [&convergenceCheckState]() { ++convergenceCheckState; };
     }
+    storm::solver::IterationTelemetry telemetry(telemetryCallback, storm::solver::IterationMethod::IntervalIteration);
     while (status == SolverStatus::InProgress) {
         ++numIterations;
+        telemetry.startSweep();
         viOperator->template applyInPlace(xy, offsets, backend);
+        if (telemetry.isEnabled()) {
+            ValueType gap = storm::utility::zero<ValueType>();
+            for (uint64_t state = 0; state < xy.first.size(); ++state) {
+                gap = std::max<ValueType>(gap, xy.second[state] - xy.first[state]);
+            }
+            telemetry.endSweep(numIterations, {}, storm::utility::convertNumber<double>(gap));
+        }
         if (checkConvergence(xy, convergenceCheckState, getNextConvergenceCheckState, relative, precision)) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
@@ -151,6 +160,11 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
     return status;
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void IntervalIterationHelper<ValueType, TrivialRowGrouping>::setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback) {
+    telemetryCallback = callback;
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, bool relative,
                                                                         ValueType const& precision,
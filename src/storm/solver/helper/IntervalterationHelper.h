@@ -3,6 +3,7 @@
 #include <optional>
 #include <vector>
 
+#include "storm/solver/IterationTelemetry.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
@@ -43,8 +44,14 @@ class IntervalIterationHelper {
                     std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
                     std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
 
+    /*!
+     * Sets a callback that is invoked after each iteration with the gap between the lower and upper bounds and the time of the iteration.
+     */
+    void setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback);
+
    private:
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
+    storm::solver::IterationTelemetryCallback telemetryCallback;
 };
 
 }  // namespace storm::solver::helper
@@ -23,12 +23,15 @@ static ValueType diff(ValueType const& oldValue, ValueType const& newValue) {
 template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
 class GSVIBackend {
    public:
-    GSVIBackend(ValueType const& precision) : precision{precision} {
+    GSVIBackend(ValueType const& precision, bool trackResidual = false) : precision{precision}, trackResidual{trackResidual} {
         // intentionally empty
     }
 
     void startNewIteration() {
         isConverged = true;
+        if (trackResidual) {
+            residual = storm::utility::zero<ValueType>();
+        }
     }
 
     void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
@@ -40,6 +43,9 @@ class GSVIBackend {
     }
 
     void applyUpdate(ValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        if (trackResidual) {
+            residual = std::max(residual, storm::utility::abs<ValueType>(currValue - *best));
+        }
         if (isConverged) {
             isConverged = storm::utility::isZero(*best) || diff<Relative>(currValue, *best) <= precision;
         }
@@ -58,10 +64,16 @@ class GSVIBackend {
         return false;
     }
 
+    ValueType const& getResidual() const {
+        return residual;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
     bool isConverged{true};
+    bool const trackResidual;
+    ValueType residual;
 };
 
 template<typename ValueType, bool TrivialRowGrouping>
@@ -69,11 +81,17 @@ template<storm::OptimizationDirection Dir, bool Relative>
 SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::GSVI(
     std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
     std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
-    GSVIBackend<ValueType, Dir, Relative> backend{precision};
+    storm::solver::IterationTelemetry telemetry(telemetryCallback, storm::solver::IterationMethod::OptimisticValueIteration);
+    GSVIBackend<ValueType, Dir, Relative> backend{precision, telemetry.isEnabled()};
     SolverStatus status{SolverStatus::InProgress};
     while (status == SolverStatus::InProgress) {
         ++numIterations;
-        if (viOperator->template applyInPlace(operand, offsets, backend)) {
+        telemetry.startSweep();
+        bool converged = viOperator->template applyInPlace(operand, offsets, backend);
+        if (telemetry.isEnabled()) {
+            telemetry.endSweep(numIterations, storm::utility::convertNumber<double>(backend.getResidual()));
+        }
+        if (converged) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
             status = iterationCallback(status, operand);
@@ -193,6 +211,7 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
     ValueType const& guessValue, std::optional<ValueType> const& lowerBound, std::optional<ValueType> const& upperBound,
     std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
+    storm::solver::IterationTelemetry telemetry(telemetryCallback, storm::solver::IterationMethod::OptimisticValueIteration);
     ValueType currentGuessValue = guessValue;
     for (uint64_t numTries = 1; true; ++numTries) {
         if (SolverStatus status = GSVI<Dir, Relative>(vu.first, offsets, numIterations, currentGuessValue, iterationCallback);
@@ -210,7 +229,16 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
         }
         while (numIterations < maxIters) {
             ++numIterations;
-            if (viOperator->template applyInPlace(vu, offsets, backend)) {
+            telemetry.startSweep();
+            bool converged = viOperator->template applyInPlace(vu, offsets, backend);
+            if (telemetry.isEnabled()) {
+                ValueType gap = storm::utility::zero<ValueType>();
+                for (uint64_t state = 0; state < vu.first.size(); ++state) {
+                    gap = std::max<ValueType>(gap, vu.second[state] - vu.first[state]);
+                }
+                telemetry.endSweep(numIterations, {}, storm::utility::convertNumber<double>(gap));
+            }
+            if (converged) {
                 if (backend.allDown()) {
                     return SolverStatus::Converged;
                 } else {
@@ -292,6 +320,11 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     return status;
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback) {
+    telemetryCallback = callback;
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, bool relative, ValueType const& precision,
@@ -5,6 +5,7 @@
 #include <optional>
 #include <vector>
 
+#include "storm/solver/IterationTelemetry.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/solver/SolverStatus.h"
 
@@ -42,12 +43,19 @@ class OptimisticValueIterationHelper {
                      std::optional<ValueType> const& lowerBound = {}, std::optional<ValueType> const& upperBound = {},
                      std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback = {}) const;
 
+    /*!
+     * Sets a callback that is invoked after each iteration with the time of the iteration and
+     * the residual (during value iteration) or the gap between the lower bound and the guessed upper bound (during verification).
+     */
+    void setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback);
+
    private:
     template<storm::OptimizationDirection Dir, bool Relative>
     SolverStatus GSVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
                       std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback = {}) const;
 
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
+    storm::solver::IterationTelemetryCallback telemetryCallback;
 };
 
 }  // namespace storm::solver::helper
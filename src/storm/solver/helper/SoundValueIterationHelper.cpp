@@ -329,9 +329,23 @@ typename SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVIData Sound
         getNextConvergenceCheckState = [&convergenceCheckState]() { ++convergenceCheckState; };
     }
 
+    storm::solver::IterationTelemetry telemetry(telemetryCallback, storm::solver::IterationMethod::SoundValueIteration);
     while (true) {
         ++numIterations;
+        telemetry.startSweep();
         viOperator->template applyInPlace(xy, offsets, backend);
+        if (telemetry.isEnabled()) {
+            std::optional<double> gap;
+            if (auto a = backend.a(), b = backend.b(); a.has_value() && b.has_value()) {
+                // The bounds of each state are x + min(a,b) * y and x + max(a,b) * y.
+                ValueType maxY = storm::utility::zero<ValueType>();
+                for (auto const& y : xy.second) {
+                    maxY = std::max<ValueType>(maxY, y);
+                }
+                gap = storm::utility::convertNumber<double>(ValueType(maxY * storm::utility::abs<ValueType>(*b - *a)));
+            }
+            telemetry.endSweep(numIterations, {}, gap);
+        }
         SVIData data{SolverStatus::InProgress, xy, backend.a(), backend.b()};
         if (data.checkConvergence(convergenceCheckState, getNextConvergenceCheckState, relative, precision)) {
             return SVIData{SolverStatus::Converged, xy, backend.a(), backend.b()};
@@ -412,6 +426,11 @@ SolverStatus SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVI(
     return res.status;
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void SoundValueIterationHelper<ValueType, TrivialRowGrouping>::setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback) {
+    telemetryCallback = callback;
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 SolverStatus SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVI(
     std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, bool relative, ValueType const& precision,
@@ -5,6 +5,7 @@
 #include <optional>
 #include <vector>
 
+#include "storm/solver/IterationTelemetry.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/TerminationCondition.h"
@@ -61,9 +62,15 @@ class SoundValueIterationHelper {
                      std::optional<ValueType> const& upperBound = {}, std::function<SolverStatus(SVIData const&)> const& iterationCallback = {},
                      std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
 
+    /*!
+     * Sets a callback that is invoked after each iteration with the gap between the lower and upper bounds (if already known) and the time of the iteration.
+     */
+    void setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback);
+
    private:
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
     uint64_t sizeOfLargestRowGroup;
+    storm::solver::IterationTelemetryCallback telemetryCallback;
 };
 
 }  // namespace storm::solver::helper
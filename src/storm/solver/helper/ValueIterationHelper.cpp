@@ -1,31 +1,51 @@
 #include "storm/solver/helper/ValueIterationHelper.h"
 
+#include <limits>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/utility/Extremum.h"
+#include "storm/utility/constants.h"
 
 namespace storm::solver::helper {
 
 template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
 class VIOperatorBackend {
    public:
-    VIOperatorBackend(ValueType const& precision) : precision{precision} {
-        // intentionally empty
+    VIOperatorBackend(ValueType const& precision, bool trackTelemetry = false, uint64_t numberOfRowGroups = 0)
+        : precision{precision}, trackTelemetry{trackTelemetry} {
+        if (trackTelemetry) {
+            bestChoices.assign(numberOfRowGroups, std::numeric_limits<uint64_t>::max());
+        }
     }
 
     void startNewIteration() {
         isConverged = true;
+        if (trackTelemetry) {
+            residual = storm::utility::zero<ValueType>();
+            changedChoices = 0;
+        }
     }
 
     void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
         best = std::move(value);
+        bestRow = row;
     }
 
     void nextRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
-        best &= value;
+        if ((best &= value) && trackTelemetry) {
+            bestRow = row;
+        }
     }
 
     void applyUpdate(ValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        if (trackTelemetry) {
+            residual = std::max(residual, storm::utility::abs<ValueType>(currValue - *best));
+            if (bestChoices[rowGroup] != bestRow) {
+                bestChoices[rowGroup] = bestRow;
+                ++changedChoices;
+            }
+        }
         if (isConverged) {
             if constexpr (Relative) {
                 isConverged = storm::utility::abs<ValueType>(currValue - *best) <= storm::utility::abs<ValueType>(precision * currValue);
@@ -48,10 +68,25 @@ class VIOperatorBackend {
         return false;
     }
 
+    ValueType const& getResidual() const {
+        return residual;
+    }
+
+    uint64_t getNumberOfChangedChoices() const {
+        return changedChoices;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
     bool isConverged{true};
+
+    // Data that is only collected if telemetry is tracked.
+    bool const trackTelemetry;
+    uint64_t bestRow{0};
+    std::vector<uint64_t> bestChoices;
+    ValueType residual;
+    uint64_t changedChoices{0};
 };
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
@@ -67,7 +102,8 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
                                                                                    uint64_t& numIterations, SolutionType const& precision,
                                                                                    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
                                                                                    MultiplicationStyle mult) const {
-    VIOperatorBackend<SolutionType, Dir, Relative> backend{precision};
+    storm::solver::IterationTelemetry telemetry(telemetryCallback, storm::solver::IterationMethod::ValueIteration);
+    VIOperatorBackend<SolutionType, Dir, Relative> backend{precision, telemetry.isEnabled(), operand.size()};
     std::vector<SolutionType>* operand1{&operand};
     std::vector<SolutionType>* operand2{&operand};
     if (mult == MultiplicationStyle::Regular) {
@@ -77,7 +113,16 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
     SolverStatus status{SolverStatus::InProgress};
     while (status == SolverStatus::InProgress) {
         ++numIterations;
+        telemetry.startSweep();
         bool applyResult = viOperator->template applyRobust<RobustDir>(*operand1, *operand2, offsets, backend);
+        if (telemetry.isEnabled()) {
+            std::optional<uint64_t> changedChoices;
+            if constexpr (!TrivialRowGrouping) {
+                // In the first iteration, the choices of all states count as changed.
+                changedChoices = backend.getNumberOfChangedChoices();
+            }
+            telemetry.endSweep(numIterations, storm::utility::convertNumber<double>(backend.getResidual()), {}, changedChoices);
+        }
         if (applyResult) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
@@ -133,6 +178,12 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
     }
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::setIterationTelemetryCallback(
+    storm::solver::IterationTelemetryCallback const& callback) {
+    telemetryCallback = callback;
+}
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::VI(std::vector<SolutionType>& operand, std::vector<ValueType> const& offsets,
                                                                                    bool relative, SolutionType const& precision,
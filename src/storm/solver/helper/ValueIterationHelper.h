@@ -5,6 +5,7 @@
 #include <optional>
 #include <vector>
 
+#include "storm/solver/IterationTelemetry.h"
 #include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/solver/SolverStatus.h"
@@ -36,8 +37,14 @@ class ValueIterationHelper {
                     std::optional<storm::OptimizationDirection> const& dir = {}, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
                     MultiplicationStyle mult = MultiplicationStyle::GaussSeidel, bool robust = true) const;
 
+    /*!
+     * Sets a callback that is invoked after each iteration with the residual, the number of changed choices and the time of the iteration.
+     */
+    void setIterationTelemetryCallback(storm::solver::IterationTelemetryCallback const& callback);
+
    private:
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator;
+    storm::solver::IterationTelemetryCallback telemetryCallback;
 };
 
 }  // namespace storm::solver::helper
@@ -3,6 +3,8 @@
 #include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -33,7 +35,12 @@ void GmmxxMultiplier<ValueType>::clearCache() const {
 
 template<typename ValueType>
 bool GmmxxMultiplier<ValueType>::parallelize(Environment const& env) const {
+#ifdef STORM_HAVE_INTELTBB
+    // Arithmetic on rational functions is not thread-safe.
+    return !std::is_same<ValueType, storm::RationalFunction>::value && env.solver().multiplier().isParallel();
+#else
     return false;
+#endif
 }
 
 template<typename ValueType>
@@ -2,6 +2,7 @@
 
 #include "storm-config.h"
 
+#include "storm/environment/Environment.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/storage/SparseMatrix.h"
@@ -22,7 +23,12 @@ NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<Value
 
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
+#ifdef STORM_HAVE_INTELTBB
+    // Arithmetic on rational functions is not thread-safe.
+    return !std::is_same<ValueType, storm::RationalFunction>::value && env.solver().multiplier().isParallel();
+#else
     return false;
+#endif
 }
 
 template<typename ValueType>
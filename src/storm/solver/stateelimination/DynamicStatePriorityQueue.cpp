@@ -1,5 +1,7 @@
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/constants.h"
@@ -18,57 +20,119 @@ DynamicStatePriorityQueue<ValueType>::DynamicStatePriorityQueue(
       transitionMatrix(transitionMatrix),
       backwardTransitions(backwardTransitions),
       oneStepProbabilities(oneStepProbabilities),
-      priorityQueue(),
-      stateToPriorityQueueEntry(),
+      heap(sortedStatePenaltyPairs),
+      stateToHeapPosition(),
+      comparator(),
       penaltyFunction(penaltyFunction) {
-    // Insert all state-penalty pairs into our priority queue.
-    for (auto const& statePenalty : sortedStatePenaltyPairs) {
-        auto it = priorityQueue.insert(priorityQueue.end(), statePenalty);
-        stateToPriorityQueueEntry.emplace(statePenalty.first, it);
+    // A sorted sequence satisfies the heap property. Sorting (again) makes sure that ties are broken by the state index.
+    std::sort(heap.begin(), heap.end(), comparator);
+    storm::storage::sparse::state_type maximalState = 0;
+    for (auto const& statePenalty : heap) {
+        maximalState = std::max(maximalState, statePenalty.first);
+    }
+    stateToHeapPosition.resize(heap.empty() ? 0 : maximalState + 1, noPosition);
+    for (uint_fast64_t position = 0; position < heap.size(); ++position) {
+        stateToHeapPosition[heap[position].first] = position;
     }
 }
 
 template<typename ValueType>
 bool DynamicStatePriorityQueue<ValueType>::hasNext() const {
-    return !priorityQueue.empty();
+    return !heap.empty();
 }
 
 template<typename ValueType>
 storm::storage::sparse::state_type DynamicStatePriorityQueue<ValueType>::pop() {
-    auto it = priorityQueue.begin();
-    STORM_LOG_TRACE("Popping state " << it->first << " with priority " << it->second << ".");
-    storm::storage::sparse::state_type result = it->first;
-    priorityQueue.erase(priorityQueue.begin());
-    stateToPriorityQueueEntry.erase(result);
+    STORM_LOG_TRACE("Popping state " << heap.front().first << " with priority " << heap.front().second << ".");
+    storm::storage::sparse::state_type result = heap.front().first;
+    stateToHeapPosition[result] = noPosition;
+    if (heap.size() > 1) {
+        setEntry(0, std::move(heap.back()));
+        heap.pop_back();
+        siftDown(0);
+    } else {
+        heap.pop_back();
+    }
     return result;
 }
 
 template<typename ValueType>
 void DynamicStatePriorityQueue<ValueType>::update(storm::storage::sparse::state_type state) {
-    // First, we need to find the old priority queue entry for the state.
-    auto priorityQueueEntryIt = stateToPriorityQueueEntry.find(state);
-
     // If the priority queue does not store the priority of the given state, we must not update it.
-    if (priorityQueueEntryIt == stateToPriorityQueueEntry.end()) {
+    if (state >= stateToHeapPosition.size() || stateToHeapPosition[state] == noPosition) {
         return;
     }
+    uint_fast64_t position = stateToHeapPosition[state];
 
     // Compute the new priority.
     uint_fast64_t newPriority = penaltyFunction(state, transitionMatrix, backwardTransitions, oneStepProbabilities);
 
-    if (priorityQueueEntryIt->second->second != newPriority) {
-        // Erase and re-insert the entry into priority queue (with the new priority).
-        priorityQueue.erase(priorityQueueEntryIt->second);
-        stateToPriorityQueueEntry.erase(priorityQueueEntryIt);
-
-        auto newElementIt = priorityQueue.emplace(state, newPriority);
-        stateToPriorityQueueEntry.emplace(state, newElementIt.first);
+    uint_fast64_t oldPriority = heap[position].second;
+    if (newPriority < oldPriority) {
+        heap[position].second = newPriority;
+        siftUp(position);
+    } else if (newPriority > oldPriority) {
+        heap[position].second = newPriority;
+        siftDown(position);
     }
 }
 
+template<typename ValueType>
+void DynamicStatePriorityQueue<ValueType>::push(storm::storage::sparse::state_type state) {
+    STORM_LOG_ASSERT(state < stateToHeapPosition.size(), "Cannot push state " << state << " that was not stored in the priority queue.");
+    STORM_LOG_ASSERT(stateToHeapPosition[state] == noPosition, "State " << state << " is already stored in the priority queue.");
+    heap.emplace_back(state, penaltyFunction(state, transitionMatrix, backwardTransitions, oneStepProbabilities));
+    siftUp(heap.size() - 1);
+}
+
 template<typename ValueType>
 std::size_t DynamicStatePriorityQueue<ValueType>::size() const {
-    return priorityQueue.size();
+    return heap.size();
+}
+
+template<typename ValueType>
+void DynamicStatePriorityQueue<ValueType>::siftUp(uint_fast64_t position) {
+    auto entry = std::move(heap[position]);
+    while (position > 0) {
+        uint_fast64_t parent = (position - 1) / arity;
+        if (!comparator(entry, heap[parent])) {
+            break;
+        }
+        setEntry(position, std::move(heap[parent]));
+        position = parent;
+    }
+    setEntry(position, std::move(entry));
+}
+
+template<typename ValueType>
+void DynamicStatePriorityQueue<ValueType>::siftDown(uint_fast64_t position) {
+    auto entry = std::move(heap[position]);
+    while (true) {
+        uint_fast64_t firstChild = arity * position + 1;
+        if (firstChild >= heap.size()) {
+            break;
+        }
+        // Find the child with the highest priority.
+        uint_fast64_t bestChild = firstChild;
+        uint_fast64_t lastChild = std::min<uint_fast64_t>(firstChild + arity, heap.size());
+        for (uint_fast64_t child = firstChild + 1; child < lastChild; ++child) {
+            if (comparator(heap[child], heap[bestChild])) {
+                bestChild = child;
+            }
+        }
+        if (!comparator(heap[bestChild], entry)) {
+            break;
+        }
+        setEntry(position, std::move(heap[bestChild]));
+        position = bestChild;
+    }
+    setEntry(position, std::move(entry));
+}
+
+template<typename ValueType>
+void DynamicStatePriorityQueue<ValueType>::setEntry(uint_fast64_t position, std::pair<storm::storage::sparse::state_type, uint_fast64_t>&& entry) {
+    stateToHeapPosition[entry.first] = position;
+    heap[position] = std::move(entry);
 }
 
 template class DynamicStatePriorityQueue<double>;
@@ -1,8 +1,7 @@
 #pragma once
 
 #include <functional>
-#include <set>
-#include <unordered_map>
+#include <limits>
 #include <vector>
 
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
@@ -23,6 +22,11 @@ struct PriorityComparator {
     }
 };
 
+/*!
+ * A priority queue of states whose penalties are updated during the elimination.
+ * States with lower penalty (and, among those, with lower index) are popped first.
+ * The queue is implemented as an indexed d-ary heap, i.e., the position of each state in the heap is stored in a vector indexed by the state.
+ */
 template<typename ValueType>
 class DynamicStatePriorityQueue : public StatePriorityQueue {
    public:
@@ -39,17 +43,38 @@ class DynamicStatePriorityQueue : public StatePriorityQueue {
     virtual bool hasNext() const override;
     virtual storm::storage::sparse::state_type pop() override;
     virtual void update(storm::storage::sparse::state_type state) override;
+    virtual void push(storm::storage::sparse::state_type state) override;
     virtual std::size_t size() const override;
 
    private:
-    typedef std::set<std::pair<storm::storage::sparse::state_type, uint_fast64_t>, PriorityComparator> PriorityQueue;
-    typedef std::unordered_map<storm::storage::sparse::state_type, PriorityQueue::const_iterator> StatePriorityQueueEntryMap;
+    // The number of children of each node of the heap.
+    static constexpr uint_fast64_t arity = 4;
+    // Marks states that are not (or no longer) contained in the heap.
+    static constexpr uint_fast64_t noPosition = std::numeric_limits<uint_fast64_t>::max();
+
+    /*!
+     * Moves the entry at the given position towards the root of the heap until the heap property is restored.
+     */
+    void siftUp(uint_fast64_t position);
+
+    /*!
+     * Moves the entry at the given position towards the leaves of the heap until the heap property is restored.
+     */
+    void siftDown(uint_fast64_t position);
+
+    /*!
+     * Puts the given entry to the given position of the heap and updates the position of the corresponding state.
+     */
+    void setEntry(uint_fast64_t position, std::pair<storm::storage::sparse::state_type, uint_fast64_t>&& entry);
 
     storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix;
     storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions;
     std::vector<ValueType> const& oneStepProbabilities;
-    PriorityQueue priorityQueue;
-    StatePriorityQueueEntryMap stateToPriorityQueueEntry;
+    // The heap of state-penalty pairs.
+    std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> heap;
+    // The position of each state in the heap (or noPosition if the state is not contained).
+    std::vector<uint_fast64_t> stateToHeapPosition;
+    PriorityComparator comparator;
     PenaltyFunctionType penaltyFunction;
 };
 
@@ -1,5 +1,8 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -79,9 +82,13 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
 
     // For each entry in the row d, we need to build a list of other rows that will contain an element in the
     // column d.
-    std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-    for (auto& backwardEntry : newBackwardEntries) {
-        backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+    if (newBackwardEntriesBuffer.size() < entriesInRow.size()) {
+        newBackwardEntriesBuffer.resize(entriesInRow.size());
+    }
+    std::vector<FlexibleRowType>& newBackwardEntries = newBackwardEntriesBuffer;
+    for (uint_fast64_t successorOffset = 0; successorOffset < entriesInRow.size(); ++successorOffset) {
+        newBackwardEntries[successorOffset].clear();
+        newBackwardEntries[successorOffset].reserve(elementsWithEntryInColumnEqualRow.size());
     }
 
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -107,12 +114,13 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         // First, find the probability with which the predecessor can move to the current state, because
         // the forward probabilities of the state to be eliminated need to be scaled with this factor.
         FlexibleRowType& predecessorForwardTransitions = matrix.getRow(predecessor);
-        FlexibleRowIterator multiplyElement = std::find_if(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(),
-                                                           [&](MatrixEntry const& a) { return a.getColumn() == column; });
+        // As the entries of each row are sorted by column, we can use a binary search.
+        FlexibleRowIterator multiplyElement = std::lower_bound(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), column,
+                                                               [](MatrixEntry const& a, uint64_t const& c) { return a.getColumn() < c; });
 
         // Make sure we have found the probability and set it to zero.
-        STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end(), storm::exceptions::InvalidStateException,
-                        "No probability for successor found.");
+        STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end() && multiplyElement->getColumn() == column,
+                        storm::exceptions::InvalidStateException, "No probability for successor found.");
         ValueType multiplyFactor = multiplyElement->getValue();
         multiplyElement->setValue(storm::utility::zero<ValueType>());
 
@@ -122,13 +130,14 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
+        // The merged row is assembled in the buffer which then swaps its memory with the row of the predecessor.
+        FlexibleRowType& newSuccessors = rowBuffer;
+        newSuccessors.clear();
         newSuccessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
 
         uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
         // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
-        for (; first1 != last1; ++result) {
+        while (first1 != last1) {
             // Skip the transitions to the state that is currently being eliminated.
             if (first1->getColumn() == column || (first2 != last2 && first2->getColumn() == column)) {
                 if (first1->getColumn() == column) {
@@ -141,24 +150,28 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
             }
 
             if (first2 == last2) {
-                std::copy_if(first1, last1, result, [&](MatrixEntry const& a) { return a.getColumn() != column; });
+                for (; first1 != last1; ++first1) {
+                    if (first1->getColumn() != column) {
+                        newSuccessors.push_back(std::move(*first1));
+                    }
+                }
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
                 ValueType successorValue = storm::utility::simplify<ValueType>((first2->getValue() * multiplyFactor));
-                *result = MatrixEntry(first2->getColumn(), successorValue);
-                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorValue);
+                newSuccessors.emplace_back(first2->getColumn(), successorValue);
+                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, std::move(successorValue));
                 ++first2;
                 ++successorOffsetInNewBackwardTransitions;
             } else if (first1->getColumn() < first2->getColumn()) {
-                *result = *first1;
+                newSuccessors.push_back(std::move(*first1));
                 ++first1;
             } else {
                 ValueType sprod = multiplyFactor * first2->getValue();
                 ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
                 auto probability = storm::utility::simplify(sum);
-                *result = MatrixEntry(first1->getColumn(), probability);
-                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
+                newSuccessors.emplace_back(first1->getColumn(), probability);
+                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, std::move(probability));
                 ++first1;
                 ++first2;
                 ++successorOffsetInNewBackwardTransitions;
@@ -167,14 +180,15 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
                 ValueType probability = storm::utility::simplify<ValueType>(first2->getValue() * multiplyFactor);
-                *result = MatrixEntry(first2->getColumn(), probability);
-                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
+                newSuccessors.emplace_back(first2->getColumn(), probability);
+                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, std::move(probability));
                 ++successorOffsetInNewBackwardTransitions;
             }
         }
 
         // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        predecessorForwardTransitions.swap(newSuccessors);
+        newSuccessors.clear();
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -207,40 +221,41 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
+        FlexibleRowType& newPredecessors = rowBuffer;
+        newPredecessors.clear();
         newPredecessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
 
-        for (; first1 != last1; ++result) {
+        while (first1 != last1) {
             if (first2 == last2) {
-                std::copy(first1, last1, result);
+                std::move(first1, last1, std::back_inserter(newPredecessors));
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
                 if (first2->getColumn() != row) {
-                    *result = *first2;
+                    newPredecessors.push_back(std::move(*first2));
                 }
                 ++first2;
             } else if (first1->getColumn() == first2->getColumn()) {
                 if (estimateComplexity(first1->getValue()) > estimateComplexity(first2->getValue())) {
-                    *result = *first1;
+                    newPredecessors.push_back(std::move(*first1));
                 } else {
-                    *result = *first2;
+                    newPredecessors.push_back(std::move(*first2));
                 }
                 ++first1;
                 ++first2;
             } else {
-                *result = *first1;
+                newPredecessors.push_back(std::move(*first1));
                 ++first1;
             }
         }
-        if (isFilterPredecessor()) {
-            std::copy_if(first2, last2, result, [&](MatrixEntry const& a) { return a.getColumn() != row && filterPredecessor(a.getColumn()); });
-        } else {
-            std::copy_if(first2, last2, result, [&](MatrixEntry const& a) { return a.getColumn() != row; });
+        for (; first2 != last2; ++first2) {
+            if (first2->getColumn() != row && (!isFilterPredecessor() || filterPredecessor(first2->getColumn()))) {
+                newPredecessors.push_back(std::move(*first2));
+            }
         }
         // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        successorBackwardTransitions.swap(newPredecessors);
+        newPredecessors.clear();
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
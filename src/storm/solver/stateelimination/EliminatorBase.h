@@ -34,6 +34,11 @@ class EliminatorBase {
    protected:
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+   private:
+    // Buffers that are reused across eliminations so that merging rows does not need to allocate new memory every time.
+    FlexibleRowType rowBuffer;
+    std::vector<FlexibleRowType> newBackwardEntriesBuffer;
 };
 
 }  // namespace stateelimination
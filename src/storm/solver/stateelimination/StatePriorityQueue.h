@@ -15,6 +15,11 @@ class StatePriorityQueue {
     virtual bool hasNext() const = 0;
     virtual storm::storage::sparse::state_type pop() = 0;
     virtual void update(storm::storage::sparse::state_type state);
+
+    /*!
+     * Re-inserts a state that was popped from the queue before and has not been eliminated.
+     */
+    virtual void push(storm::storage::sparse::state_type state) = 0;
     virtual std::size_t size() const = 0;
 };
 
@@ -20,6 +20,15 @@ storm::storage::sparse::state_type StaticStatePriorityQueue::pop() {
     return sortedStates[currentPosition - 1];
 }
 
+void StaticStatePriorityQueue::push(storm::storage::sparse::state_type state) {
+    if (currentPosition > 0) {
+        --currentPosition;
+        sortedStates[currentPosition] = state;
+    } else {
+        sortedStates.insert(sortedStates.begin(), state);
+    }
+}
+
 std::size_t StaticStatePriorityQueue::size() const {
     return sortedStates.size() - currentPosition;
 }
@@ -14,6 +14,12 @@ class StaticStatePriorityQueue : public StatePriorityQueue {
 
     virtual bool hasNext() const override;
     virtual storm::storage::sparse::state_type pop() override;
+
+    /*!
+     * As the priorities are static, the state is placed in front of all remaining states. Hence, pushing popped states in reverse order
+     * restores their original order.
+     */
+    virtual void push(storm::storage::sparse::state_type state) override;
     virtual std::size_t size() const override;
 
    private:
@@ -34,6 +34,11 @@ class Distribution {
      */
     void reserve(uint64_t size);
 
+    /*!
+     * Removes all entries from the distribution. The allocated storage is kept, so the distribution can be refilled cheaply.
+     */
+    void clear();
+
     /*!
      * Adds the given distribution to the current one.
      */
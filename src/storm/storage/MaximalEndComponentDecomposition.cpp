@@ -1,13 +1,19 @@
+#include <algorithm>
+#include <limits>
 #include <list>
 #include <numeric>
+#include <optional>
 #include <queue>
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace storage {
@@ -73,17 +79,158 @@ MaximalEndComponentDecomposition<ValueType>& MaximalEndComponentDecomposition<Va
     return *this;
 }
 
+namespace {
+uint64_t const noBlock = std::numeric_limits<uint64_t>::max();
+
+/*!
+ * A set of states that is strongly connected under the current choices, but may still contain choices that leave it.
+ */
+using Block = std::vector<uint64_t>;
+
+/*!
+ * The outcome of refining a single block.
+ */
+struct BlockRefinement {
+    // The choices that leave the block.
+    std::vector<uint64_t> removedChoices;
+    // If no choice leaves the block, this is the corresponding MEC.
+    std::optional<MaximalEndComponent> mec;
+    // Otherwise, these are the non-trivial SCCs of the block under the remaining choices.
+    std::vector<Block> subBlocks;
+};
+
+/*!
+ * Memory that is reused for refining multiple blocks.
+ */
+struct BlockRefinementMemory {
+    std::vector<uint64_t> keptChoiceStarts, keptChoices, preorderNumbers, localSccs, recursionStack, s, p;
+    std::vector<bool> nonTrivial;
+};
+
+/*!
+ * Refines the given block, i.e., determines the choices of the block that leave it. If there are none, the block is an MEC. Otherwise, the block
+ * is decomposed into its SCCs under the remaining choices (using the path-based algorithm by Gabow/Cheriyan/Mehlhorn). Only the states and choices
+ * of the given block are touched, so independent blocks can be refined concurrently.
+ *
+ * @param stateToBlock Maps each state to the index of its current block (or to noBlock).
+ * @param localIndices Maps each state to its position within its current block.
+ * @param ecChoices The choices that have not been removed so far.
+ */
+template<typename ValueType>
+void refineBlock(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, Block const& block, uint64_t blockIndex,
+                 std::vector<uint64_t> const& stateToBlock, std::vector<uint64_t> const& localIndices, storm::storage::BitVector const& ecChoices,
+                 BlockRefinement& result, BlockRefinementMemory& memory) {
+    auto const& groups = transitionMatrix.getRowGroupIndices();
+
+    // Find the choices that do not stay in the block.
+    memory.keptChoiceStarts.clear();
+    memory.keptChoices.clear();
+    for (auto state : block) {
+        memory.keptChoiceStarts.push_back(memory.keptChoices.size());
+        for (auto choiceIt = ecChoices.begin(groups[state]); *choiceIt < groups[state + 1]; ++choiceIt) {
+            auto row = transitionMatrix.getRow(*choiceIt);
+            if (std::any_of(row.begin(), row.end(), [&blockIndex, &stateToBlock](auto const& entry) {
+                    return stateToBlock[entry.getColumn()] != blockIndex && !storm::utility::isZero(entry.getValue());
+                })) {
+                result.removedChoices.push_back(*choiceIt);
+            } else {
+                memory.keptChoices.push_back(*choiceIt);
+            }
+        }
+    }
+    memory.keptChoiceStarts.push_back(memory.keptChoices.size());
+
+    if (result.removedChoices.empty()) {
+        // The block is strongly connected and every state can stay in it, so we found an MEC.
+        MaximalEndComponent mec;
+        for (uint64_t localState = 0; localState < block.size(); ++localState) {
+            MaximalEndComponent::set_type containedChoices(memory.keptChoices.begin() + memory.keptChoiceStarts[localState],
+                                                           memory.keptChoices.begin() + memory.keptChoiceStarts[localState + 1]);
+            STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
+            mec.addState(block[localState], std::move(containedChoices));
+        }
+        result.mec = std::move(mec);
+        return;
+    }
+
+    // Decompose the block into SCCs w.r.t. the remaining choices. These only lead to states of the block.
+    memory.preorderNumbers.assign(block.size(), noBlock);
+    memory.localSccs.assign(block.size(), noBlock);
+    memory.nonTrivial.assign(block.size(), false);
+    uint64_t currentIndex = 0;
+    uint64_t sccCount = 0;
+    for (uint64_t startState = 0; startState < block.size(); ++startState) {
+        if (memory.preorderNumbers[startState] != noBlock) {
+            continue;
+        }
+        memory.recursionStack.push_back(startState);
+        while (!memory.recursionStack.empty()) {
+            uint64_t currentState = memory.recursionStack.back();
+            if (memory.preorderNumbers[currentState] == noBlock) {
+                memory.preorderNumbers[currentState] = currentIndex++;
+                memory.s.push_back(currentState);
+                memory.p.push_back(currentState);
+                for (uint64_t keptChoice = memory.keptChoiceStarts[currentState]; keptChoice < memory.keptChoiceStarts[currentState + 1]; ++keptChoice) {
+                    for (auto const& entry : transitionMatrix.getRow(memory.keptChoices[keptChoice])) {
+                        if (storm::utility::isZero(entry.getValue())) {
+                            continue;
+                        }
+                        uint64_t successor = localIndices[entry.getColumn()];
+                        if (successor == currentState) {
+                            memory.nonTrivial[currentState] = true;
+                        }
+                        if (memory.preorderNumbers[successor] == noBlock) {
+                            memory.recursionStack.push_back(successor);
+                        } else if (memory.localSccs[successor] == noBlock) {
+                            while (memory.preorderNumbers[memory.p.back()] > memory.preorderNumbers[successor]) {
+                                memory.p.pop_back();
+                            }
+                        }
+                    }
+                }
+            } else {
+                if (currentState == memory.p.back()) {
+                    memory.p.pop_back();
+                    bool nonSingletonScc = memory.s.back() != currentState;
+                    uint64_t poppedState = 0;
+                    do {
+                        poppedState = memory.s.back();
+                        memory.s.pop_back();
+                        memory.localSccs[poppedState] = sccCount;
+                        if (nonSingletonScc) {
+                            memory.nonTrivial[poppedState] = true;
+                        }
+                    } while (poppedState != currentState);
+                    ++sccCount;
+                }
+                memory.recursionStack.pop_back();
+            }
+        }
+    }
+
+    // Only the non-trivial SCCs may contain MECs.
+    std::vector<uint64_t> sccToSubBlock(sccCount, noBlock);
+    for (uint64_t localState = 0; localState < block.size(); ++localState) {
+        if (memory.nonTrivial[localState]) {
+            uint64_t& subBlock = sccToSubBlock[memory.localSccs[localState]];
+            if (subBlock == noBlock) {
+                subBlock = result.subBlocks.size();
+                result.subBlocks.emplace_back();
+            }
+            result.subBlocks[subBlock].push_back(block[localState]);
+        }
+    }
+}
+}  // namespace
+
 template<typename ValueType>
-void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                          storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-                                                                                          storm::OptionalRef<storm::storage::BitVector const> states,
-                                                                                          storm::OptionalRef<storm::storage::BitVector const> choices) {
-    // Get some data for convenient access.
-    auto const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
-
-    storm::storage::BitVector remainingEcCandidates, ecChoices;
+void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& /*backwardTransitions*/,
+    storm::OptionalRef<storm::storage::BitVector const> states, storm::OptionalRef<storm::storage::BitVector const> choices) {
+    storm::utility::ProfilingScope profilingScope("mec decomposition");
+
+    storm::storage::BitVector ecChoices;
     SccDecompositionResult sccDecRes;
-    SccDecompositionMemoryCache sccDecCache;
     StronglyConnectedComponentDecompositionOptions sccDecOptions;
     sccDecOptions.dropNaiveSccs();
     if (states) {
@@ -96,71 +243,86 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
         ecChoices.resize(transitionMatrix.getRowCount(), true);
     }
 
-    while (true) {
-        performSccDecomposition(transitionMatrix, sccDecOptions, sccDecRes, sccDecCache);
-
-        remainingEcCandidates = sccDecRes.nonTrivialStates;
-        storm::storage::BitVector ecSccIndices(sccDecRes.sccCount, true);
-        storm::storage::BitVector nonTrivSccIndices(sccDecRes.sccCount, false);
-        // find the choices that do not stay in their SCC
-        for (auto state : remainingEcCandidates) {
-            auto const sccIndex = sccDecRes.stateToSccMapping[state];
-            nonTrivSccIndices.set(sccIndex, true);
-            bool stateCanStayInScc = false;
-            for (auto const choice : transitionMatrix.getRowGroupIndices(state)) {
-                if (!ecChoices.get(choice)) {
-                    continue;
-                }
-                auto row = transitionMatrix.getRow(choice);
-                if (std::any_of(row.begin(), row.end(), [&sccIndex, &sccDecRes](auto const& entry) {
-                        return sccIndex != sccDecRes.stateToSccMapping[entry.getColumn()] && !storm::utility::isZero(entry.getValue());
-                    })) {
-                    ecChoices.set(choice, false);       // The choice leaves the SCC
-                    ecSccIndices.set(sccIndex, false);  // This SCC is not 'stable' yet
-                } else {
-                    stateCanStayInScc = true;  // The choice stays in the SCC
-                }
-            }
-            if (!stateCanStayInScc) {
-                remainingEcCandidates.set(state, false);  // This state is not in an EC
+    // Only the initial SCC decomposition considers the whole subsystem. Afterwards, we repeatedly remove the choices that leave their SCC and
+    // decompose the affected SCCs again. As SCCs only get split by this, SCCs that did not lose a choice are MECs and need not be considered again.
+    performSccDecomposition(transitionMatrix, sccDecOptions, sccDecRes);
+    std::vector<uint64_t> stateToBlock(transitionMatrix.getRowGroupCount(), noBlock);
+    std::vector<uint64_t> localIndices(transitionMatrix.getRowGroupCount(), noBlock);
+    std::vector<Block> blocks;
+    {
+        // The initial blocks are ordered like the SCCs. The sub-blocks of a refined block are ordered by their first (local) state, so the
+        // resulting order of the MECs only depends on the input and not on the number of threads.
+        std::vector<uint64_t> sccToBlock(sccDecRes.sccCount, noBlock);
+        for (auto state : sccDecRes.nonTrivialStates) {
+            sccToBlock[sccDecRes.stateToSccMapping[state]] = 0;
+        }
+        for (auto& blockIndex : sccToBlock) {
+            if (blockIndex != noBlock) {
+                blockIndex = blocks.size();
+                blocks.emplace_back();
             }
         }
+        for (auto state : sccDecRes.nonTrivialStates) {
+            uint64_t blockIndex = sccToBlock[sccDecRes.stateToSccMapping[state]];
+            stateToBlock[state] = blockIndex;
+            localIndices[state] = blocks[blockIndex].size();
+            blocks[blockIndex].push_back(state);
+        }
+    }
 
-        // process the MECs that we've found, i.e. SCCs where every state can stay inside the SCC
-        ecSccIndices &= nonTrivSccIndices;
-        for (auto sccIndex : ecSccIndices) {
-            MaximalEndComponent newMec;
-            for (auto state : remainingEcCandidates) {
-                // skip states from different SCCs
-                if (sccDecRes.stateToSccMapping[state] != sccIndex) {
-                    continue;
-                }
-                // This is no longer a candidate
-                remainingEcCandidates.set(state, false);
-                // Add choices to the MEC
-                MaximalEndComponent::set_type containedChoices;
-                for (auto ecChoiceIt = ecChoices.begin(nondeterministicChoiceIndices[state]); *ecChoiceIt < nondeterministicChoiceIndices[state + 1];
-                     ++ecChoiceIt) {
-                    containedChoices.insert(*ecChoiceIt);
+    std::vector<BlockRefinement> refinements;
+    BlockRefinementMemory memory;
+#ifdef STORM_HAVE_INTELTBB
+    tbb::enumerable_thread_specific<BlockRefinementMemory> threadMemory;
+#endif
+    while (!blocks.empty()) {
+        STORM_LOG_TRACE("Refining " << blocks.size() << " MEC candidate(s).");
+        refinements.clear();
+        refinements.resize(blocks.size());
+        bool refineConcurrently = false;
+#ifdef STORM_HAVE_INTELTBB
+        // Operations on rational functions are not guaranteed to be thread-safe.
+        if constexpr (!std::is_same_v<ValueType, storm::RationalFunction>) {
+            refineConcurrently = blocks.size() > 1 && storm::utility::getNumberOfThreads() > 1;
+        }
+        if (refineConcurrently) {
+            // The blocks are disjoint and all shared data is only read, so the blocks can be refined independently.
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, blocks.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                auto& localMemory = threadMemory.local();
+                for (uint64_t blockIndex = range.begin(); blockIndex < range.end(); ++blockIndex) {
+                    refineBlock(transitionMatrix, blocks[blockIndex], blockIndex, stateToBlock, localIndices, ecChoices, refinements[blockIndex], localMemory);
                 }
-                STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
-                newMec.addState(state, std::move(containedChoices));
+            });
+        }
+#endif
+        if (!refineConcurrently) {
+            for (uint64_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex) {
+                refineBlock(transitionMatrix, blocks[blockIndex], blockIndex, stateToBlock, localIndices, ecChoices, refinements[blockIndex], memory);
             }
-            this->blocks.emplace_back(std::move(newMec));
         }
 
-        if (nonTrivSccIndices == ecSccIndices) {
-            // All non trivial SCCs are MECs, nothing left to do!
-            break;
+        // Apply the refinements and collect the blocks for the next round.
+        std::vector<Block> newBlocks;
+        for (uint64_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex) {
+            auto& refinement = refinements[blockIndex];
+            for (auto choice : refinement.removedChoices) {
+                ecChoices.set(choice, false);
+            }
+            for (auto state : blocks[blockIndex]) {
+                stateToBlock[state] = noBlock;
+            }
+            if (refinement.mec) {
+                this->blocks.emplace_back(std::move(*refinement.mec));
+            }
+            for (auto& subBlock : refinement.subBlocks) {
+                for (uint64_t localIndex = 0; localIndex < subBlock.size(); ++localIndex) {
+                    stateToBlock[subBlock[localIndex]] = newBlocks.size();
+                    localIndices[subBlock[localIndex]] = localIndex;
+                }
+                newBlocks.push_back(std::move(subBlock));
+            }
         }
-
-        // prepare next iteration.
-        // It suffices to keep the candidates that have the possibility to always stay in the candidate set
-        remainingEcCandidates = storm::utility::graph::performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions,
-                                                                            remainingEcCandidates, ~remainingEcCandidates, false, 0, ecChoices);
-        remainingEcCandidates.complement();
-        sccDecOptions.subsystem(remainingEcCandidates);
-        sccDecOptions.choices(ecChoices);
+        blocks = std::move(newBlocks);
     }
 
     STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
@@ -2,6 +2,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -278,6 +279,7 @@ void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& tran
 template<typename ValueType>
 void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options,
                              SccDecompositionResult& result, SccDecompositionMemoryCache& cache) {
+    storm::utility::ProfilingScope profilingScope("scc decomposition");
     STORM_LOG_ASSERT(!options.optChoices || options.optSubsystem, "Expecting subsystem if choices are given.");
 
     uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
@@ -1,5 +1,8 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
+#include <algorithm>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
@@ -12,6 +15,7 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace dd {
@@ -724,14 +728,120 @@ void InternalAdd<DdType::CUDD, ValueType>::splitIntoGroupsRec(std::vector<DdNode
     }
 }
 
+#ifdef STORM_HAVE_INTELTBB
+namespace {
+// The minimal number of rows for which the matrix components are computed concurrently.
+uint_fast64_t const minimalNumberOfRowsForConcurrentTranslation = 1ull << 14;
+
+/*!
+ * Determines how many row levels of the DD are traversed before the remaining subproblems of the matrix translation are distributed over
+ * the threads. A value of zero indicates that the translation is to be done sequentially.
+ */
+uint_fast64_t getMatrixComponentsSplitLevel(Odd const& rowOdd, uint_fast64_t numberOfRowLevels) {
+    uint_fast64_t numberOfThreads = storm::utility::getNumberOfThreads();
+    if (numberOfThreads <= 1 || rowOdd.getTotalOffset() < minimalNumberOfRowsForConcurrentTranslation) {
+        return 0;
+    }
+    // Aim for (considerably) more buckets than threads to compensate for the irregular structure of the DD.
+    uint_fast64_t splitLevel = 0;
+    while ((1ull << splitLevel) < 16 * numberOfThreads && splitLevel < 10) {
+        ++splitLevel;
+    }
+    return std::min(splitLevel, numberOfRowLevels);
+}
+}  // namespace
+#endif
+
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                               Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+#ifdef STORM_HAVE_INTELTBB
+    // Subproblems that refer to different rows write to disjoint parts of the given vectors and the traversal of the DD does not modify it.
+    // Hence, the buckets of subproblems can be processed concurrently as long as the subproblems of each bucket are processed in order.
+    uint_fast64_t splitLevel = getMatrixComponentsSplitLevel(rowOdd, ddRowVariableIndices.size());
+    if (splitLevel > 0) {
+        std::vector<std::vector<MatrixComponentsTask>> tasks(1ull << splitLevel);
+        collectMatrixComponentsTasksRec(this->getCuddDdNode(), tasks, rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices);
+        tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, tasks.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+            for (uint_fast64_t bucket = range.begin(); bucket < range.end(); ++bucket) {
+                for (auto const& task : tasks[bucket]) {
+                    toMatrixComponentsRec(task.dd, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, splitLevel, splitLevel,
+                                          maxLevel, task.rowOffset, task.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                }
+            }
+        });
+        return;
+    }
+#endif
     return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
-                                 ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
-                                 writeValues);
+                                 maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::CUDD, ValueType>::collectMatrixComponentsTasksRec(DdNode const* dd, std::vector<std::vector<MatrixComponentsTask>>& tasks,
+                                                                           Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel,
+                                                                           uint_fast64_t splitLevel, uint_fast64_t currentBucket,
+                                                                           uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                           std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                           std::vector<uint_fast64_t> const& ddColumnVariableIndices) const {
+    // For the empty DD, there is nothing to translate.
+    if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
+        return;
+    }
+
+    if (currentLevel == splitLevel) {
+        tasks[currentBucket].push_back({dd, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+    } else {
+        DdNode const* elseElse;
+        DdNode const* elseThen;
+        DdNode const* thenElse;
+        DdNode const* thenThen;
+        getMatrixCofactors(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], elseElse, elseThen, thenElse, thenThen);
+
+        // The successors are visited in the same order as in toMatrixComponentsRec, such that the tasks of each bucket are sorted by column.
+        collectMatrixComponentsTasksRec(elseElse, tasks, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel,
+                                        currentBucket << 1, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices);
+        collectMatrixComponentsTasksRec(elseThen, tasks, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel,
+                                        currentBucket << 1, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
+                                        ddColumnVariableIndices);
+        collectMatrixComponentsTasksRec(thenElse, tasks, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel,
+                                        (currentBucket << 1) | 1, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices,
+                                        ddColumnVariableIndices);
+        collectMatrixComponentsTasksRec(thenThen, tasks, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel,
+                                        (currentBucket << 1) | 1, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(),
+                                        ddRowVariableIndices, ddColumnVariableIndices);
+    }
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::CUDD, ValueType>::getMatrixCofactors(DdNode const* dd, uint_fast64_t rowVariableIndex, uint_fast64_t columnVariableIndex,
+                                                              DdNode const*& elseElse, DdNode const*& elseThen, DdNode const*& thenElse,
+                                                              DdNode const*& thenThen) {
+    if (columnVariableIndex < Cudd_NodeReadIndex(dd)) {
+        elseElse = elseThen = thenElse = thenThen = dd;
+    } else if (rowVariableIndex < Cudd_NodeReadIndex(dd)) {
+        elseElse = thenElse = Cudd_E_const(dd);
+        elseThen = thenThen = Cudd_T_const(dd);
+    } else {
+        DdNode const* elseNode = Cudd_E_const(dd);
+        if (columnVariableIndex < Cudd_NodeReadIndex(elseNode)) {
+            elseElse = elseThen = elseNode;
+        } else {
+            elseElse = Cudd_E_const(elseNode);
+            elseThen = Cudd_T_const(elseNode);
+        }
+
+        DdNode const* thenNode = Cudd_T_const(dd);
+        if (columnVariableIndex < Cudd_NodeReadIndex(thenNode)) {
+            thenElse = thenThen = thenNode;
+        } else {
+            thenElse = Cudd_E_const(thenNode);
+            thenThen = Cudd_T_const(thenNode);
+        }
+    }
 }
 
 template<typename ValueType>
@@ -759,29 +869,7 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
         DdNode const* elseThen;
         DdNode const* thenElse;
         DdNode const* thenThen;
-
-        if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-            elseElse = elseThen = thenElse = thenThen = dd;
-        } else if (ddRowVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-            elseElse = thenElse = Cudd_E_const(dd);
-            elseThen = thenThen = Cudd_T_const(dd);
-        } else {
-            DdNode const* elseNode = Cudd_E_const(dd);
-            if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(elseNode)) {
-                elseElse = elseThen = elseNode;
-            } else {
-                elseElse = Cudd_E_const(elseNode);
-                elseThen = Cudd_T_const(elseNode);
-            }
-
-            DdNode const* thenNode = Cudd_T_const(dd);
-            if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(thenNode)) {
-                thenElse = thenThen = thenNode;
-            } else {
-                thenElse = Cudd_E_const(thenNode);
-                thenThen = Cudd_T_const(thenNode);
-            }
-        }
+        getMatrixCofactors(dd, ddRowVariableIndices[currentColumnLevel], ddColumnVariableIndices[currentColumnLevel], elseElse, elseThen, thenElse, thenThen);
 
         // Visit else-else.
         toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
@@ -793,6 +793,45 @@ class InternalAdd<DdType::CUDD, ValueType> {
                                uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
 
+    /*!
+     * A subproblem of the translation of the DD into a (sparse) matrix that is rooted at the split level.
+     */
+    struct MatrixComponentsTask {
+        DdNode const* dd;
+        Odd const* rowOdd;
+        Odd const* columnOdd;
+        uint_fast64_t rowOffset;
+        uint_fast64_t columnOffset;
+    };
+
+    /*!
+     * Helper function that traverses the DD up to the given split level and collects the subproblems of the translation into a (sparse)
+     * matrix that are rooted at this level. Each bucket holds the subproblems of one range of rows in the order in which they are visited
+     * by toMatrixComponentsRec. Different buckets can therefore be processed concurrently.
+     *
+     * @param dd The DD to traverse.
+     * @param tasks The buckets (one for each combination of values of the row variables above the split level) the subproblems are added to.
+     * @param rowOdd The ODD used for the row translation.
+     * @param columnOdd The ODD used for the column translation.
+     * @param currentLevel The currently considered (row and column) level in the DD.
+     * @param splitLevel The level at which the subproblems are rooted.
+     * @param currentBucket The bucket of the current range of rows.
+     * @param currentRowOffset The current row offset.
+     * @param currentColumnOffset The current column offset.
+     * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+     * @param ddColumnVariableIndices The (sorted) indices of all DD column variables that need to be considered.
+     */
+    void collectMatrixComponentsTasksRec(DdNode const* dd, std::vector<std::vector<MatrixComponentsTask>>& tasks, Odd const& rowOdd, Odd const& columnOdd,
+                                         uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentBucket, uint_fast64_t currentRowOffset,
+                                         uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                         std::vector<uint_fast64_t> const& ddColumnVariableIndices) const;
+
+    /*!
+     * Retrieves the cofactors of the given DD with respect to the given row and column variable (in this order).
+     */
+    static void getMatrixCofactors(DdNode const* dd, uint_fast64_t rowVariableIndex, uint_fast64_t columnVariableIndex, DdNode const*& elseElse,
+                                   DdNode const*& elseThen, DdNode const*& thenElse, DdNode const*& thenThen);
+
     /*!
      * Builds an ADD representing the given vector.
      *
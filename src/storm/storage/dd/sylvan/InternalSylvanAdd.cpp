@@ -1,5 +1,8 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include <algorithm>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
@@ -12,6 +15,7 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 #include "storm-config.h"
 
@@ -1226,14 +1230,133 @@ void InternalAdd<DdType::Sylvan, ValueType>::splitIntoGroupsRec(std::vector<MTBD
     }
 }
 
+#ifdef STORM_HAVE_INTELTBB
+namespace {
+// The minimal number of rows for which the matrix components are computed concurrently.
+uint_fast64_t const minimalNumberOfRowsForConcurrentTranslation = 1ull << 14;
+
+/*!
+ * Determines how many row levels of the DD are traversed before the remaining subproblems of the matrix translation are distributed over
+ * the threads. A value of zero indicates that the translation is to be done sequentially.
+ */
+template<typename ValueType>
+uint_fast64_t getMatrixComponentsSplitLevel(Odd const& rowOdd, uint_fast64_t numberOfRowLevels) {
+    uint_fast64_t numberOfThreads = storm::utility::getNumberOfThreads();
+    if (numberOfThreads <= 1 || rowOdd.getTotalOffset() < minimalNumberOfRowsForConcurrentTranslation) {
+        return 0;
+    }
+    // Aim for (considerably) more buckets than threads to compensate for the irregular structure of the DD.
+    uint_fast64_t splitLevel = 0;
+    while ((1ull << splitLevel) < 16 * numberOfThreads && splitLevel < 10) {
+        ++splitLevel;
+    }
+    return std::min(splitLevel, numberOfRowLevels);
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+uint_fast64_t getMatrixComponentsSplitLevel<storm::RationalFunction>(Odd const&, uint_fast64_t) {
+    // Copying rational functions out of the leaves is not safe to do concurrently.
+    return 0;
+}
+#endif
+}  // namespace
+#endif
+
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+#ifdef STORM_HAVE_INTELTBB
+    // Subproblems that refer to different rows write to disjoint parts of the given vectors and the traversal of the DD does not modify it.
+    // Hence, the buckets of subproblems can be processed concurrently as long as the subproblems of each bucket are processed in order.
+    uint_fast64_t splitLevel = getMatrixComponentsSplitLevel<ValueType>(rowOdd, ddRowVariableIndices.size());
+    if (splitLevel > 0) {
+        std::vector<std::vector<MatrixComponentsTask>> tasks(1ull << splitLevel);
+        collectMatrixComponentsTasksRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), tasks, rowOdd,
+                                        columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices);
+        tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, tasks.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+            for (uint_fast64_t bucket = range.begin(); bucket < range.end(); ++bucket) {
+                for (auto const& task : tasks[bucket]) {
+                    toMatrixComponentsRec(task.dd, task.negated, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, splitLevel,
+                                          splitLevel, maxLevel, task.rowOffset, task.columnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                                          writeValues);
+                }
+            }
+        });
+        return;
+    }
+#endif
     return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
+                                 writeValues);
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::collectMatrixComponentsTasksRec(MTBDD dd, bool negated, std::vector<std::vector<MatrixComponentsTask>>& tasks,
+                                                                             Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel,
+                                                                             uint_fast64_t splitLevel, uint_fast64_t currentBucket,
+                                                                             uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                             std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                             std::vector<uint_fast64_t> const& ddColumnVariableIndices) const {
+    // For the empty DD, there is nothing to translate.
+    if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+        return;
+    }
+
+    if (currentLevel == splitLevel) {
+        tasks[currentBucket].push_back({dd, negated, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+    } else {
+        MTBDD elseElse;
+        MTBDD elseThen;
+        MTBDD thenElse;
+        MTBDD thenThen;
+        getMatrixCofactors(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], elseElse, elseThen, thenElse, thenThen);
+
+        // The successors are visited in the same order as in toMatrixComponentsRec, such that the tasks of each bucket are sorted by column.
+        collectMatrixComponentsTasksRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, tasks, rowOdd.getElseSuccessor(),
+                                        columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentBucket << 1, currentRowOffset, currentColumnOffset,
+                                        ddRowVariableIndices, ddColumnVariableIndices);
+        collectMatrixComponentsTasksRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, tasks, rowOdd.getElseSuccessor(),
+                                        columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentBucket << 1, currentRowOffset,
+                                        currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices);
+        collectMatrixComponentsTasksRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, tasks, rowOdd.getThenSuccessor(),
+                                        columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, (currentBucket << 1) | 1,
+                                        currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices);
+        collectMatrixComponentsTasksRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, tasks, rowOdd.getThenSuccessor(),
+                                        columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, (currentBucket << 1) | 1,
+                                        currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
+                                        ddColumnVariableIndices);
+    }
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::getMatrixCofactors(MTBDD dd, uint_fast64_t rowVariableIndex, uint_fast64_t columnVariableIndex, MTBDD& elseElse,
+                                                                MTBDD& elseThen, MTBDD& thenElse, MTBDD& thenThen) {
+    if (mtbdd_isleaf(dd) || columnVariableIndex < mtbdd_getvar(dd)) {
+        elseElse = elseThen = thenElse = thenThen = dd;
+    } else if (rowVariableIndex < mtbdd_getvar(dd)) {
+        elseElse = thenElse = mtbdd_getlow(dd);
+        elseThen = thenThen = mtbdd_gethigh(dd);
+    } else {
+        MTBDD elseNode = mtbdd_getlow(dd);
+        if (mtbdd_isleaf(elseNode) || columnVariableIndex < mtbdd_getvar(elseNode)) {
+            elseElse = elseThen = elseNode;
+        } else {
+            elseElse = mtbdd_getlow(elseNode);
+            elseThen = mtbdd_gethigh(elseNode);
+        }
+
+        MTBDD thenNode = mtbdd_gethigh(dd);
+        if (mtbdd_isleaf(thenNode) || columnVariableIndex < mtbdd_getvar(thenNode)) {
+            thenElse = thenThen = thenNode;
+        } else {
+            thenElse = mtbdd_getlow(thenNode);
+            thenThen = mtbdd_gethigh(thenNode);
+        }
+    }
 }
 
 template<typename ValueType>
@@ -1261,29 +1384,7 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
         MTBDD elseThen;
         MTBDD thenElse;
         MTBDD thenThen;
-
-        if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = elseThen = thenElse = thenThen = dd;
-        } else if (ddRowVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = thenElse = mtbdd_getlow(dd);
-            elseThen = thenThen = mtbdd_gethigh(dd);
-        } else {
-            MTBDD elseNode = mtbdd_getlow(dd);
-            if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(elseNode)) {
-                elseElse = elseThen = elseNode;
-            } else {
-                elseElse = mtbdd_getlow(elseNode);
-                elseThen = mtbdd_gethigh(elseNode);
-            }
-
-            MTBDD thenNode = mtbdd_gethigh(dd);
-            if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(thenNode)) {
-                thenElse = thenThen = thenNode;
-            } else {
-                thenElse = mtbdd_getlow(thenNode);
-                thenThen = mtbdd_gethigh(thenNode);
-            }
-        }
+        getMatrixCofactors(dd, ddRowVariableIndices[currentColumnLevel], ddColumnVariableIndices[currentColumnLevel], elseElse, elseThen, thenElse, thenThen);
 
         // Visit else-else.
         toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
@@ -47,7 +47,6 @@ VOID_TASK_2(execute_sylvan, std::function<void()> const*, f, std::exception_ptr*
 #endif
 
 uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
-bool InternalDdManager<DdType::Sylvan>::suspended = false;
 
 // It is important that the variable pairs start at an even offset, because sylvan assumes this to be true for
 // some operations.
@@ -82,9 +81,11 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         sylvan_gc_hook_pregc(TASK(gc_start));
         sylvan_gc_hook_postgc(TASK(gc_end));
 #endif
-        // TODO: uncomment these to disable lace threads whenever they are not used. This requires that *all* DD code is run through execute
-        // lace_suspend();
-        // suspended = true;
+        // The lace workers do busy waiting, so we suspend them as long as sylvan is not used. Lace wakes the workers up whenever a
+        // task is submitted from outside of the workers (and suspends them afterwards), so this is safe for any DD operation.
+        // Code that performs many DD operations should nevertheless run through execute to avoid waking up the workers for every
+        // single operation.
+        lace_suspend();
     }
     ++numberOfInstances;
 }
@@ -229,15 +230,18 @@ bool InternalDdManager<DdType::Sylvan>::supportsOrderedInsertion() const {
 }
 
 void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool) {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "Dynamic reordering is not supported by sylvan. Consider choosing a static variable ordering heuristic instead.");
 }
 
 bool InternalDdManager<DdType::Sylvan>::isDynamicReorderingAllowed() const {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "Dynamic reordering is not supported by sylvan. Consider choosing a static variable ordering heuristic instead.");
 }
 
 void InternalDdManager<DdType::Sylvan>::triggerReordering() {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "Dynamic reordering is not supported by sylvan. Consider choosing a static variable ordering heuristic instead.");
 }
 
 void InternalDdManager<DdType::Sylvan>::debugCheck() const {
@@ -245,18 +249,11 @@ void InternalDdManager<DdType::Sylvan>::debugCheck() const {
 }
 
 void InternalDdManager<DdType::Sylvan>::execute(std::function<void()> const& f) const {
-    // Only wake up the sylvan (i.e. lace) threads when they are suspended.
+    // Running f as a lace task keeps the workers awake for the whole duration of f. Waking up and suspending the workers is
+    // reference counted by lace, so nested and concurrent calls are fine. If we already are inside a lace worker, f is
+    // executed directly.
     std::exception_ptr e = nullptr;  // propagate exception
-    if (suspended) {
-        lace_resume();
-        suspended = false;
-        RUN(execute_sylvan, &f, &e);
-        lace_suspend();
-        suspended = true;
-    } else {
-        // The sylvan threads are already running, don't suspend afterwards.
-        RUN(execute_sylvan, &f, &e);
-    }
+    RUN(execute_sylvan, &f, &e);
     if (e) {
         std::rethrow_exception(e);
     }
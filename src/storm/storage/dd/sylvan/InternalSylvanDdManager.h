@@ -158,10 +158,6 @@ class InternalDdManager<DdType::Sylvan> {
     // 'global' manager.
     static uint_fast64_t numberOfInstances;
 
-    // Since the sylvan (more specifically: lace) processes do busy waiting, we suspend them as long as
-    // sylvan is not used. This flag keeps track of whether we are currently suspending.
-    static bool suspended;
-
     // The index of the next free variable index. This needs to be shared across all instances since the sylvan
     // manager is implicitly 'global'.
     static uint_fast64_t nextFreeVariableIndex;
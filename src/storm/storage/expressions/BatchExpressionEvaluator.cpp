@@ -0,0 +1,401 @@
+#include "storm/storage/expressions/BatchExpressionEvaluator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+namespace {
+// The number of valuations that are processed by each operation at once. The values of all operations for one chunk should fit into the cache.
+uint64_t const chunkSize = 1024;
+
+template<typename Function>
+void applyUnary(double* result, double const* operand, uint64_t size, Function const& function) {
+    for (uint64_t index = 0; index < size; ++index) {
+        result[index] = function(operand[index]);
+    }
+}
+
+template<typename Function>
+void applyBinary(double* result, double const* firstOperand, double const* secondOperand, uint64_t size, Function const& function) {
+    for (uint64_t index = 0; index < size; ++index) {
+        result[index] = function(firstOperand[index], secondOperand[index]);
+    }
+}
+
+double toDouble(bool value) {
+    return value ? 1.0 : 0.0;
+}
+}  // namespace
+
+BatchExpressionEvaluator::BatchExpressionEvaluator(storm::expressions::ExpressionManager const& manager, uint64_t batchSize)
+    : manager(manager.getSharedPointer()), batchSize(batchSize) {
+    // Intentionally left empty.
+}
+
+void BatchExpressionEvaluator::setBatchSize(uint64_t batchSize) {
+    this->batchSize = batchSize;
+    for (auto& column : columns) {
+        column.resize(batchSize, 0.0);
+    }
+}
+
+uint64_t BatchExpressionEvaluator::getBatchSize() const {
+    return batchSize;
+}
+
+uint64_t BatchExpressionEvaluator::getColumnIndex(storm::expressions::Variable const& variable) {
+    auto columnIt = variableToColumn.try_emplace(variable.getIndex(), columns.size());
+    if (columnIt.second) {
+        columns.emplace_back(batchSize, 0.0);
+    }
+    return columnIt.first->second;
+}
+
+std::vector<double>& BatchExpressionEvaluator::getColumn(storm::expressions::Variable const& variable) {
+    return columns[getColumnIndex(variable)];
+}
+
+void BatchExpressionEvaluator::setBooleanValue(storm::expressions::Variable const& variable, uint64_t index, bool value) {
+    STORM_LOG_ASSERT(index < batchSize, "Index " << index << " exceeds the batch size " << batchSize << ".");
+    getColumn(variable)[index] = toDouble(value);
+}
+
+void BatchExpressionEvaluator::setIntegerValue(storm::expressions::Variable const& variable, uint64_t index, int_fast64_t value) {
+    STORM_LOG_ASSERT(index < batchSize, "Index " << index << " exceeds the batch size " << batchSize << ".");
+    getColumn(variable)[index] = static_cast<double>(value);
+}
+
+void BatchExpressionEvaluator::setRationalValue(storm::expressions::Variable const& variable, uint64_t index, double value) {
+    STORM_LOG_ASSERT(index < batchSize, "Index " << index << " exceeds the batch size " << batchSize << ".");
+    getColumn(variable)[index] = value;
+}
+
+BatchExpressionEvaluator::Program const& BatchExpressionEvaluator::getProgram(Expression const& expression) const {
+    auto programIt = programs.find(expression);
+    if (programIt == programs.end()) {
+        Program program;
+        program.supported = true;
+        std::unordered_map<BaseExpression const*, uint64_t> registers;
+        translate(expression.getBaseExpression(), program, registers);
+        programIt = programs.emplace(expression, std::move(program)).first;
+    }
+    return programIt->second;
+}
+
+uint64_t BatchExpressionEvaluator::translate(BaseExpression const& expression, Program& program,
+                                             std::unordered_map<BaseExpression const*, uint64_t>& registers) const {
+    // Subexpressions that occur multiple times are only evaluated once.
+    auto registerIt = registers.find(&expression);
+    if (registerIt != registers.end()) {
+        return registerIt->second;
+    }
+
+    Operation operation{OperationType::Constant, {}, 0.0, 0};
+    if (expression.isBooleanLiteralExpression()) {
+        operation.value = toDouble(expression.asBooleanLiteralExpression().getValue());
+    } else if (expression.isIntegerLiteralExpression()) {
+        operation.value = static_cast<double>(expression.asIntegerLiteralExpression().getValue());
+    } else if (expression.isRationalLiteralExpression()) {
+        operation.value = expression.asRationalLiteralExpression().getValueAsDouble();
+    } else if (expression.isVariableExpression()) {
+        operation.type = OperationType::Variable;
+        operation.variableIndex = expression.asVariableExpression().getVariable().getIndex();
+        program.supported &= expression.hasBooleanType() || expression.hasIntegerType() || expression.hasRationalType();
+    } else if (expression.isIfThenElseExpression()) {
+        operation.type = OperationType::IfThenElse;
+    } else if (expression.isBinaryBooleanFunctionExpression()) {
+        switch (expression.asBinaryBooleanFunctionExpression().getOperatorType()) {
+            case BinaryBooleanFunctionExpression::OperatorType::And:
+                operation.type = OperationType::And;
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Or:
+                operation.type = OperationType::Or;
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Xor:
+                operation.type = OperationType::Xor;
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Implies:
+                operation.type = OperationType::Implies;
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Iff:
+                operation.type = OperationType::Iff;
+                break;
+        }
+    } else if (expression.isBinaryNumericalFunctionExpression()) {
+        switch (expression.asBinaryNumericalFunctionExpression().getOperatorType()) {
+            case BinaryNumericalFunctionExpression::OperatorType::Plus:
+                operation.type = OperationType::Plus;
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Minus:
+                operation.type = OperationType::Minus;
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Times:
+                operation.type = OperationType::Times;
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Divide:
+                operation.type = OperationType::Divide;
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Power:
+                operation.type = OperationType::Power;
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Modulo:
+                operation.type = OperationType::Modulo;
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Logarithm:
+                operation.type = OperationType::Logarithm;
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Min:
+                operation.type = OperationType::Min;
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Max:
+                operation.type = OperationType::Max;
+                break;
+        }
+    } else if (expression.isBinaryRelationExpression()) {
+        switch (expression.asBinaryRelationExpression().getRelationType()) {
+            case RelationType::Equal:
+                operation.type = OperationType::Equal;
+                break;
+            case RelationType::NotEqual:
+                operation.type = OperationType::NotEqual;
+                break;
+            case RelationType::Less:
+                operation.type = OperationType::Less;
+                break;
+            case RelationType::LessOrEqual:
+                operation.type = OperationType::LessOrEqual;
+                break;
+            case RelationType::Greater:
+                operation.type = OperationType::Greater;
+                break;
+            case RelationType::GreaterOrEqual:
+                operation.type = OperationType::GreaterOrEqual;
+                break;
+        }
+    } else if (expression.isUnaryBooleanFunctionExpression()) {
+        operation.type = OperationType::Not;
+    } else if (expression.isUnaryNumericalFunctionExpression()) {
+        switch (expression.asUnaryNumericalFunctionExpression().getOperatorType()) {
+            case UnaryNumericalFunctionExpression::OperatorType::Minus:
+                operation.type = OperationType::Negate;
+                break;
+            case UnaryNumericalFunctionExpression::OperatorType::Floor:
+                operation.type = OperationType::Floor;
+                break;
+            case UnaryNumericalFunctionExpression::OperatorType::Ceil:
+                operation.type = OperationType::Ceil;
+                break;
+        }
+    } else if (expression.isPredicateExpression()) {
+        switch (expression.asPredicateExpression().getPredicateType()) {
+            case PredicateExpression::PredicateType::AtLeastOneOf:
+                operation.type = OperationType::AtLeastOneOf;
+                break;
+            case PredicateExpression::PredicateType::AtMostOneOf:
+                operation.type = OperationType::AtMostOneOf;
+                break;
+            case PredicateExpression::PredicateType::ExactlyOneOf:
+                operation.type = OperationType::ExactlyOneOf;
+                break;
+        }
+    } else {
+        // Other expressions (e.g. the array expressions of JANI models) are not supported.
+        program.supported = false;
+    }
+
+    if (program.supported && operation.type != OperationType::Constant && operation.type != OperationType::Variable) {
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            operation.operands.push_back(translate(*expression.getOperand(operandIndex), program, registers));
+        }
+    }
+    program.operations.push_back(std::move(operation));
+    registers.emplace(&expression, program.operations.size() - 1);
+    return program.operations.size() - 1;
+}
+
+bool BatchExpressionEvaluator::canEvaluate(Expression const& expression) const {
+    Program const& program = getProgram(expression);
+    return program.supported && std::all_of(program.operations.begin(), program.operations.end(), [this](Operation const& operation) {
+               return operation.type != OperationType::Variable || variableToColumn.count(operation.variableIndex) > 0;
+           });
+}
+
+template<typename Callback>
+void BatchExpressionEvaluator::evaluate(Expression const& expression, Callback const& callback) const {
+    Program const& program = getProgram(expression);
+    STORM_LOG_THROW(program.supported, storm::exceptions::NotSupportedException, "Unable to evaluate expression '" << expression << "' in a batch.");
+    uint64_t const numberOfOperations = program.operations.size();
+
+    std::vector<double const*> variableColumns(numberOfOperations, nullptr);
+    for (uint64_t operationIndex = 0; operationIndex < numberOfOperations; ++operationIndex) {
+        auto const& operation = program.operations[operationIndex];
+        if (operation.type == OperationType::Variable) {
+            auto columnIt = variableToColumn.find(operation.variableIndex);
+            STORM_LOG_THROW(columnIt != variableToColumn.end(), storm::exceptions::InvalidArgumentException,
+                            "Unable to evaluate expression '" << expression << "', because variable '" << manager->getVariableName(operation.variableIndex)
+                                                              << "' has no values.");
+            variableColumns[operationIndex] = columns[columnIt->second].data();
+        }
+    }
+
+    std::vector<double> registers(numberOfOperations * chunkSize);
+    for (uint64_t chunkStart = 0; chunkStart < batchSize; chunkStart += chunkSize) {
+        uint64_t const size = std::min(chunkSize, batchSize - chunkStart);
+        for (uint64_t operationIndex = 0; operationIndex < numberOfOperations; ++operationIndex) {
+            auto const& operation = program.operations[operationIndex];
+            double* result = registers.data() + operationIndex * chunkSize;
+            auto operand = [&registers, &operation](uint64_t operandIndex) -> double const* {
+                return registers.data() + operation.operands[operandIndex] * chunkSize;
+            };
+            switch (operation.type) {
+                case OperationType::Constant:
+                    std::fill(result, result + size, operation.value);
+                    break;
+                case OperationType::Variable:
+                    std::copy(variableColumns[operationIndex] + chunkStart, variableColumns[operationIndex] + chunkStart + size, result);
+                    break;
+                case OperationType::IfThenElse: {
+                    double const* condition = operand(0);
+                    double const* thenValues = operand(1);
+                    double const* elseValues = operand(2);
+                    for (uint64_t index = 0; index < size; ++index) {
+                        result[index] = condition[index] != 0.0 ? thenValues[index] : elseValues[index];
+                    }
+                    break;
+                }
+                case OperationType::And:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a != 0.0 && b != 0.0); });
+                    break;
+                case OperationType::Or:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a != 0.0 || b != 0.0); });
+                    break;
+                case OperationType::Xor:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble((a != 0.0) != (b != 0.0)); });
+                    break;
+                case OperationType::Implies:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a == 0.0 || b != 0.0); });
+                    break;
+                case OperationType::Iff:
+                case OperationType::Equal:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a == b); });
+                    break;
+                case OperationType::Not:
+                    applyUnary(result, operand(0), size, [](double a) { return toDouble(a == 0.0); });
+                    break;
+                case OperationType::Plus:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return a + b; });
+                    break;
+                case OperationType::Minus:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return a - b; });
+                    break;
+                case OperationType::Times:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return a * b; });
+                    break;
+                case OperationType::Divide:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return a / b; });
+                    break;
+                case OperationType::Power:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return std::pow(a, b); });
+                    break;
+                case OperationType::Modulo:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return std::fmod(a, b); });
+                    break;
+                case OperationType::Logarithm:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) {
+                        // Logarithms to base 2 and 10 are computed directly, since dividing the natural logarithms may introduce rounding errors.
+                        return b == 2.0 ? std::log2(a) : (b == 10.0 ? std::log10(a) : std::log(a) / std::log(b));
+                    });
+                    break;
+                case OperationType::Min:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return std::min(a, b); });
+                    break;
+                case OperationType::Max:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return std::max(a, b); });
+                    break;
+                case OperationType::Negate:
+                    applyUnary(result, operand(0), size, [](double a) { return -a; });
+                    break;
+                case OperationType::Floor:
+                    applyUnary(result, operand(0), size, [](double a) { return std::floor(a); });
+                    break;
+                case OperationType::Ceil:
+                    applyUnary(result, operand(0), size, [](double a) { return std::ceil(a); });
+                    break;
+                case OperationType::NotEqual:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a != b); });
+                    break;
+                case OperationType::Less:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a < b); });
+                    break;
+                case OperationType::LessOrEqual:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a <= b); });
+                    break;
+                case OperationType::Greater:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a > b); });
+                    break;
+                case OperationType::GreaterOrEqual:
+                    applyBinary(result, operand(0), operand(1), size, [](double a, double b) { return toDouble(a >= b); });
+                    break;
+                case OperationType::AtLeastOneOf:
+                case OperationType::AtMostOneOf:
+                case OperationType::ExactlyOneOf: {
+                    // Count the operands that hold.
+                    std::fill(result, result + size, 0.0);
+                    for (uint64_t operandIndex = 0; operandIndex < operation.operands.size(); ++operandIndex) {
+                        applyBinary(result, result, operand(operandIndex), size, [](double count, double a) { return count + toDouble(a != 0.0); });
+                    }
+                    if (operation.type == OperationType::AtLeastOneOf) {
+                        applyUnary(result, result, size, [](double count) { return toDouble(count >= 1.0); });
+                    } else if (operation.type == OperationType::AtMostOneOf) {
+                        applyUnary(result, result, size, [](double count) { return toDouble(count <= 1.0); });
+                    } else {
+                        applyUnary(result, result, size, [](double count) { return toDouble(count == 1.0); });
+                    }
+                    break;
+                }
+            }
+        }
+        callback(chunkStart, registers.data() + (numberOfOperations - 1) * chunkSize, size);
+    }
+}
+
+storm::storage::BitVector BatchExpressionEvaluator::asBool(Expression const& expression) const {
+    storm::storage::BitVector result(batchSize);
+    evaluate(expression, [&result](uint64_t chunkStart, double const* values, uint64_t size) {
+        for (uint64_t index = 0; index < size; ++index) {
+            if (values[index] == 1.0) {
+                result.set(chunkStart + index);
+            }
+        }
+    });
+    return result;
+}
+
+std::vector<int_fast64_t> BatchExpressionEvaluator::asInt(Expression const& expression) const {
+    std::vector<int_fast64_t> result(batchSize);
+    evaluate(expression, [&result](uint64_t chunkStart, double const* values, uint64_t size) {
+        for (uint64_t index = 0; index < size; ++index) {
+            result[chunkStart + index] = static_cast<int_fast64_t>(values[index]);
+        }
+    });
+    return result;
+}
+
+std::vector<double> BatchExpressionEvaluator::asRational(Expression const& expression) const {
+    std::vector<double> result(batchSize);
+    evaluate(expression, [&result](uint64_t chunkStart, double const* values, uint64_t size) {
+        std::copy(values, values + size, result.begin() + chunkStart);
+    });
+    return result;
+}
+
+}  // namespace expressions
+}  // namespace storm
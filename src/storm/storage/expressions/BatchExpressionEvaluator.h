@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+class ExpressionManager;
+class Variable;
+
+/*!
+ * Evaluates expressions over a batch of valuations at once. The values of each variable are stored column-wise, i.e., as one vector over all
+ * valuations of the batch. Expressions are translated to a sequence of operations that are each applied to (a chunk of) all valuations, which
+ * avoids the per-valuation overhead of the ExpressionEvaluator and allows the compiler to vectorize the evaluation.
+ *
+ * As the ExprtkExpressionEvaluator, all values are represented as doubles.
+ */
+class BatchExpressionEvaluator {
+   public:
+    /*!
+     * Creates an evaluator for the expressions of the given manager.
+     *
+     * @param manager The manager responsible for the expressions.
+     * @param batchSize The number of valuations of a batch.
+     */
+    BatchExpressionEvaluator(storm::expressions::ExpressionManager const& manager, uint64_t batchSize = 0);
+
+    /*!
+     * Sets the number of valuations of a batch. The values of all variables are kept (as far as possible).
+     */
+    void setBatchSize(uint64_t batchSize);
+
+    /*!
+     * Retrieves the number of valuations of a batch.
+     */
+    uint64_t getBatchSize() const;
+
+    /*!
+     * Sets the value of the given variable in the valuation with the given index.
+     */
+    void setBooleanValue(storm::expressions::Variable const& variable, uint64_t index, bool value);
+    void setIntegerValue(storm::expressions::Variable const& variable, uint64_t index, int_fast64_t value);
+    void setRationalValue(storm::expressions::Variable const& variable, uint64_t index, double value);
+
+    /*!
+     * Retrieves the index of the column that holds the values of the given variable. The column is created if there is none.
+     * Setting values via the column index avoids looking up the column of the variable for each valuation.
+     */
+    uint64_t getColumnIndex(storm::expressions::Variable const& variable);
+
+    /*!
+     * Sets the value in the given column for the valuation with the given index. Boolean values are represented by 0 and 1.
+     */
+    void setValue(uint64_t columnIndex, uint64_t index, double value) {
+        STORM_LOG_ASSERT(index < batchSize, "Index " << index << " exceeds the batch size " << batchSize << ".");
+        columns[columnIndex][index] = value;
+    }
+
+    /*!
+     * Checks whether the given expression can be evaluated, i.e., whether it only consists of supported operations over variables for which
+     * values were set.
+     */
+    bool canEvaluate(Expression const& expression) const;
+
+    /*!
+     * Evaluates the given boolean expression for all valuations of the batch.
+     *
+     * @return The valuations (given by their index) that satisfy the expression.
+     */
+    storm::storage::BitVector asBool(Expression const& expression) const;
+
+    /*!
+     * Evaluates the given integer expression for all valuations of the batch.
+     */
+    std::vector<int_fast64_t> asInt(Expression const& expression) const;
+
+    /*!
+     * Evaluates the given expression for all valuations of the batch.
+     */
+    std::vector<double> asRational(Expression const& expression) const;
+
+   private:
+    enum class OperationType {
+        Constant,
+        Variable,
+        IfThenElse,
+        And,
+        Or,
+        Xor,
+        Implies,
+        Iff,
+        Not,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Power,
+        Modulo,
+        Logarithm,
+        Min,
+        Max,
+        Negate,
+        Floor,
+        Ceil,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        AtLeastOneOf,
+        AtMostOneOf,
+        ExactlyOneOf
+    };
+
+    /*!
+     * An operation that writes its result to the register with the same index as the operation.
+     */
+    struct Operation {
+        OperationType type;
+        // The registers holding the operands.
+        std::vector<uint64_t> operands;
+        // The value of constants.
+        double value;
+        // The index of the variable for variable operations.
+        uint64_t variableIndex;
+    };
+
+    /*!
+     * The translation of an expression. The value of the expression is the value of the last operation.
+     */
+    struct Program {
+        std::vector<Operation> operations;
+        // Whether all operations are supported.
+        bool supported;
+    };
+
+    /*!
+     * Retrieves the translation of the given expression.
+     */
+    Program const& getProgram(Expression const& expression) const;
+
+    /*!
+     * Appends the operations that compute the given expression to the program.
+     *
+     * @param registers The registers holding the values of the subexpressions that were already translated.
+     * @return The register holding the value of the expression.
+     */
+    uint64_t translate(BaseExpression const& expression, Program& program, std::unordered_map<BaseExpression const*, uint64_t>& registers) const;
+
+    /*!
+     * Evaluates the given expression and calls the given function with the values of each chunk of valuations.
+     */
+    template<typename Callback>
+    void evaluate(Expression const& expression, Callback const& callback) const;
+
+    /*!
+     * Retrieves the column of the given variable, which is created if there is none.
+     */
+    std::vector<double>& getColumn(storm::expressions::Variable const& variable);
+
+    // The manager responsible for the expressions.
+    std::shared_ptr<storm::expressions::ExpressionManager const> manager;
+
+    uint64_t batchSize;
+
+    // The values of the variables (indexed by the index of the variable). Variables without values have no column.
+    std::unordered_map<uint64_t, uint64_t> variableToColumn;
+    std::vector<std::vector<double>> columns;
+
+    // The translations of all evaluated expressions.
+    mutable std::unordered_map<Expression, Program> programs;
+};
+
+}  // namespace expressions
+}  // namespace storm
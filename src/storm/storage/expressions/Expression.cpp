@@ -8,6 +8,7 @@
 #include "storm/storage/expressions/CompiledExpression.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionUniqueTable.h"
 #include "storm/storage/expressions/Expressions.h"
 #include "storm/storage/expressions/LinearityCheckVisitor.h"
 #include "storm/storage/expressions/OperatorType.h"
@@ -76,6 +77,9 @@ storm::RationalNumber Expression::evaluateAsRational() const {
 }
 
 Expression Expression::simplify() const {
+    if (auto uniqueTable = this->getManager().getUniqueTable()) {
+        return Expression(uniqueTable->simplify(this->getBaseExpressionPointer()));
+    }
     return Expression(this->getBaseExpression().simplify());
 }
 
@@ -217,6 +221,21 @@ bool Expression::isSyntacticallyEqual(storm::expressions::Expression const& othe
     if (this->getBaseExpressionPointer() == other.getBaseExpressionPointer()) {
         return true;
     }
+    // With hash-consing, structurally equal expressions have the same representative.
+    if (this->isInitialized() && other.isInitialized() && this->getManager() == other.getManager() && this->getManager().isHashConsingEnabled()) {
+        auto uniqueTable = this->getManager().getUniqueTable();
+        bool thisComplete = false;
+        bool otherComplete = false;
+        auto internedThis = uniqueTable->intern(this->getBaseExpressionPointer(), &thisComplete);
+        auto internedOther = uniqueTable->intern(other.getBaseExpressionPointer(), &otherComplete);
+        if (internedThis.get() == internedOther.get()) {
+            return true;
+        }
+        // Expressions with subexpressions that can not be interned (e.g. array expressions) may be equal nonetheless.
+        if (thisComplete && otherComplete) {
+            return false;
+        }
+    }
     SyntacticalEqualityCheckVisitor checker;
     return checker.isSyntacticallyEqual(*this, other);
 }
@@ -2,6 +2,7 @@
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/storage/expressions/ExpressionUniqueTable.h"
 #include "storm/storage/expressions/Expressions.h"
 #include "storm/storage/expressions/Variable.h"
 #include "storm/utility/macros.h"
@@ -78,7 +79,11 @@ ExpressionManager::~ExpressionManager() {
 }
 
 std::shared_ptr<ExpressionManager> ExpressionManager::clone() const {
-    return std::shared_ptr<ExpressionManager>(new ExpressionManager(*this));
+    std::shared_ptr<ExpressionManager> result(new ExpressionManager(*this));
+    // The clone needs its own unique table, because expressions refer to their manager.
+    result->uniqueTable.reset();
+    result->setHashConsing(this->isHashConsingEnabled());
+    return result;
 }
 
 Expression ExpressionManager::boolean(bool value) const {
@@ -102,21 +107,27 @@ bool ExpressionManager::operator==(ExpressionManager const& other) const {
 }
 
 Type const& ExpressionManager::getBooleanType() const {
-    if (!booleanType) {
-        booleanType = Type(this->getSharedPointer(), std::shared_ptr<BaseType>(new BooleanType()));
-    }
+    std::call_once(typeSynchronization.booleanType, [this]() {
+        // A copied manager already has the type.
+        if (!booleanType) {
+            booleanType = Type(this->getSharedPointer(), std::shared_ptr<BaseType>(new BooleanType()));
+        }
+    });
     return booleanType.get();
 }
 
 Type const& ExpressionManager::getIntegerType() const {
-    if (!integerType) {
-        integerType = Type(this->getSharedPointer(), std::shared_ptr<BaseType>(new IntegerType()));
-    }
+    std::call_once(typeSynchronization.integerType, [this]() {
+        if (!integerType) {
+            integerType = Type(this->getSharedPointer(), std::shared_ptr<BaseType>(new IntegerType()));
+        }
+    });
     return integerType.get();
 }
 
 Type const& ExpressionManager::getBitVectorType(std::size_t width) const {
     Type type(this->getSharedPointer(), std::shared_ptr<BaseType>(new BitVectorType(width)));
+    std::lock_guard<std::mutex> lock(typeSynchronization.typeSetMutex);
     auto typeIterator = bitvectorTypes.find(type);
     if (typeIterator == bitvectorTypes.end()) {
         auto iteratorBoolPair = bitvectorTypes.insert(type);
@@ -126,14 +137,17 @@ Type const& ExpressionManager::getBitVectorType(std::size_t width) const {
 }
 
 Type const& ExpressionManager::getRationalType() const {
-    if (!rationalType) {
-        rationalType = Type(this->getSharedPointer(), std::shared_ptr<BaseType>(new RationalType()));
-    }
+    std::call_once(typeSynchronization.rationalType, [this]() {
+        if (!rationalType) {
+            rationalType = Type(this->getSharedPointer(), std::shared_ptr<BaseType>(new RationalType()));
+        }
+    });
     return rationalType.get();
 }
 
 Type const& ExpressionManager::getArrayType(Type elementType) const {
     Type type(this->getSharedPointer(), std::shared_ptr<BaseType>(new ArrayType(elementType)));
+    std::lock_guard<std::mutex> lock(typeSynchronization.typeSetMutex);
     return *arrayTypes.insert(type).first;
 }
 
@@ -328,6 +342,29 @@ std::shared_ptr<ExpressionManager const> ExpressionManager::getSharedPointer() c
     return this->shared_from_this();
 }
 
+void ExpressionManager::setHashConsing(bool value) {
+    if (!value) {
+        uniqueTable.reset();
+    } else if (!uniqueTable) {
+        uniqueTable = std::make_shared<ExpressionUniqueTable>(*this);
+    }
+}
+
+bool ExpressionManager::isHashConsingEnabled() const {
+    return static_cast<bool>(uniqueTable);
+}
+
+Expression ExpressionManager::intern(Expression const& expression) const {
+    if (!uniqueTable || !expression.isInitialized()) {
+        return expression;
+    }
+    return Expression(uniqueTable->intern(expression.getBaseExpressionPointer()));
+}
+
+ExpressionUniqueTable* ExpressionManager::getUniqueTable() const {
+    return uniqueTable.get();
+}
+
 std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager) {
     out << "manager {\n";
 
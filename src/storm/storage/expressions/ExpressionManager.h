@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <iterator>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -19,6 +20,7 @@ namespace storm {
 namespace expressions {
 // Forward-declare manager class for iterator class.
 class ExpressionManager;
+class ExpressionUniqueTable;
 
 class VariableIterator {
    public:
@@ -395,6 +397,36 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
      */
     std::shared_ptr<ExpressionManager const> getSharedPointer() const;
 
+    /*!
+     * Enables or disables hash-consing of the expressions of this manager. If enabled, the results of substitutions and simplifications are
+     * interned, i.e., structurally equal expressions share the same representation. This allows for checking syntactical equality in constant
+     * time and memoizes simplifications. Must not be called while expressions of this manager are built concurrently.
+     *
+     * @param value If true, hash-consing is enabled.
+     */
+    void setHashConsing(bool value);
+
+    /*!
+     * Retrieves whether hash-consing is enabled for the expressions of this manager.
+     */
+    bool isHashConsingEnabled() const;
+
+    /*!
+     * Retrieves the unique representative of the given expression, i.e., the (only) interned expression that is structurally equal to the given
+     * one. If hash-consing is disabled, the expression is returned unchanged.
+     *
+     * @param expression The expression to intern.
+     * @return The unique representative of the expression.
+     */
+    Expression intern(Expression const& expression) const;
+
+    /*!
+     * Retrieves the unique table of the expressions of this manager.
+     *
+     * @return The unique table or null if hash-consing is disabled.
+     */
+    ExpressionUniqueTable* getUniqueTable() const;
+
     friend std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager);
 
    private:
@@ -487,6 +519,26 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
     mutable boost::optional<Type> rationalType;
     mutable std::unordered_set<Type> arrayTypes;
 
+    /*!
+     * Synchronizes the lazy creation of the types, as expressions may be built concurrently. Copies start with fresh flags.
+     */
+    struct TypeSynchronization {
+        TypeSynchronization() = default;
+        TypeSynchronization(TypeSynchronization const&) {}
+        TypeSynchronization& operator=(TypeSynchronization const&) {
+            return *this;
+        }
+
+        std::once_flag booleanType;
+        std::once_flag integerType;
+        std::once_flag rationalType;
+        std::mutex typeSetMutex;
+    };
+    mutable TypeSynchronization typeSynchronization;
+
+    // The interned expressions of this manager (if hash-consing is enabled).
+    std::shared_ptr<ExpressionUniqueTable> uniqueTable;
+
     // A mask that can be used to query whether a variable is an auxiliary variable.
     static const uint64_t auxiliaryMask = (1ull << 50);
 
@@ -0,0 +1,277 @@
+#include "storm/storage/expressions/ExpressionUniqueTable.h"
+
+#include <sstream>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+namespace {
+enum class ExpressionKind : uint64_t {
+    IfThenElse,
+    BinaryBooleanFunction,
+    BinaryNumericalFunction,
+    BinaryRelation,
+    BooleanLiteral,
+    IntegerLiteral,
+    RationalLiteral,
+    UnaryBooleanFunction,
+    UnaryNumericalFunction,
+    Variable,
+    Predicate,
+    Other
+};
+
+ExpressionKind getKind(BaseExpression const& expression) {
+    if (expression.isIfThenElseExpression()) {
+        return ExpressionKind::IfThenElse;
+    } else if (expression.isBinaryBooleanFunctionExpression()) {
+        return ExpressionKind::BinaryBooleanFunction;
+    } else if (expression.isBinaryNumericalFunctionExpression()) {
+        return ExpressionKind::BinaryNumericalFunction;
+    } else if (expression.isBinaryRelationExpression()) {
+        return ExpressionKind::BinaryRelation;
+    } else if (expression.isBooleanLiteralExpression()) {
+        return ExpressionKind::BooleanLiteral;
+    } else if (expression.isIntegerLiteralExpression()) {
+        return ExpressionKind::IntegerLiteral;
+    } else if (expression.isRationalLiteralExpression()) {
+        return ExpressionKind::RationalLiteral;
+    } else if (expression.isUnaryBooleanFunctionExpression()) {
+        return ExpressionKind::UnaryBooleanFunction;
+    } else if (expression.isUnaryNumericalFunctionExpression()) {
+        return ExpressionKind::UnaryNumericalFunction;
+    } else if (expression.isVariableExpression()) {
+        return ExpressionKind::Variable;
+    } else if (expression.isPredicateExpression()) {
+        return ExpressionKind::Predicate;
+    }
+    // Expressions of other kinds (e.g. the array expressions of JANI models) are not interned.
+    return ExpressionKind::Other;
+}
+
+/*!
+ * Retrieves the value (or operator) that distinguishes expressions of the same kind with the same operands.
+ */
+uint64_t getData(ExpressionKind kind, BaseExpression const& expression) {
+    switch (kind) {
+        case ExpressionKind::BinaryBooleanFunction:
+            return static_cast<uint64_t>(expression.asBinaryBooleanFunctionExpression().getOperatorType());
+        case ExpressionKind::BinaryNumericalFunction:
+            return static_cast<uint64_t>(expression.asBinaryNumericalFunctionExpression().getOperatorType());
+        case ExpressionKind::BinaryRelation:
+            return static_cast<uint64_t>(expression.asBinaryRelationExpression().getRelationType());
+        case ExpressionKind::BooleanLiteral:
+            return expression.asBooleanLiteralExpression().getValue() ? 1 : 0;
+        case ExpressionKind::IntegerLiteral:
+            return static_cast<uint64_t>(expression.asIntegerLiteralExpression().getValue());
+        case ExpressionKind::UnaryBooleanFunction:
+            return static_cast<uint64_t>(expression.asUnaryBooleanFunctionExpression().getOperatorType());
+        case ExpressionKind::UnaryNumericalFunction:
+            return static_cast<uint64_t>(expression.asUnaryNumericalFunctionExpression().getOperatorType());
+        case ExpressionKind::Variable:
+            return expression.asVariableExpression().getVariable().getIndex();
+        case ExpressionKind::Predicate:
+            return static_cast<uint64_t>(expression.asPredicateExpression().getPredicateType());
+        default:
+            return 0;
+    }
+}
+
+/*!
+ * Creates an expression that is equal to the given one, but has the given operands.
+ */
+std::shared_ptr<BaseExpression const> replaceOperands(ExpressionKind kind, BaseExpression const& expression,
+                                                      std::vector<std::shared_ptr<BaseExpression const>> const& operands) {
+    ExpressionManager const& manager = expression.getManager();
+    Type const& type = expression.getType();
+    switch (kind) {
+        case ExpressionKind::IfThenElse:
+            return std::make_shared<IfThenElseExpression>(manager, type, operands[0], operands[1], operands[2]);
+        case ExpressionKind::BinaryBooleanFunction:
+            return std::make_shared<BinaryBooleanFunctionExpression>(manager, type, operands[0], operands[1],
+                                                                     expression.asBinaryBooleanFunctionExpression().getOperatorType());
+        case ExpressionKind::BinaryNumericalFunction:
+            return std::make_shared<BinaryNumericalFunctionExpression>(manager, type, operands[0], operands[1],
+                                                                       expression.asBinaryNumericalFunctionExpression().getOperatorType());
+        case ExpressionKind::BinaryRelation:
+            return std::make_shared<BinaryRelationExpression>(manager, type, operands[0], operands[1],
+                                                              expression.asBinaryRelationExpression().getRelationType());
+        case ExpressionKind::UnaryBooleanFunction:
+            return std::make_shared<UnaryBooleanFunctionExpression>(manager, type, operands[0],
+                                                                    expression.asUnaryBooleanFunctionExpression().getOperatorType());
+        case ExpressionKind::UnaryNumericalFunction:
+            return std::make_shared<UnaryNumericalFunctionExpression>(manager, type, operands[0],
+                                                                      expression.asUnaryNumericalFunctionExpression().getOperatorType());
+        case ExpressionKind::Predicate:
+            return std::make_shared<PredicateExpression>(manager, type, operands, expression.asPredicateExpression().getPredicateType());
+        default:
+            STORM_LOG_ASSERT(false, "Unexpected kind of expression.");
+            return expression.getSharedPointer();
+    }
+}
+
+// The initial number of entries at which deleted entries are removed from the table.
+uint64_t const initialCleanupThreshold = 1024;
+}  // namespace
+
+bool ExpressionUniqueTable::Key::operator==(Key const& other) const {
+    return kind == other.kind && typeMask == other.typeMask && data == other.data && literal == other.literal && operands == other.operands;
+}
+
+std::size_t ExpressionUniqueTable::KeyHash::operator()(Key const& key) const {
+    std::size_t seed = 0;
+    boost::hash_combine(seed, key.kind);
+    boost::hash_combine(seed, key.typeMask);
+    boost::hash_combine(seed, key.data);
+    boost::hash_combine(seed, key.literal);
+    for (auto const* operand : key.operands) {
+        boost::hash_combine(seed, operand);
+    }
+    return seed;
+}
+
+ExpressionUniqueTable::ExpressionUniqueTable(ExpressionManager const& manager) : manager(manager), cleanupThreshold(initialCleanupThreshold) {
+    // Intentionally left empty.
+}
+
+std::shared_ptr<BaseExpression const> ExpressionUniqueTable::intern(std::shared_ptr<BaseExpression const> const& expression, bool* complete) {
+    std::unordered_map<BaseExpression const*, InternedExpression> cache;
+    InternedExpression result = internRecursively(expression, cache);
+    if (complete != nullptr) {
+        *complete = result.second;
+    }
+    return result.first;
+}
+
+ExpressionUniqueTable::InternedExpression ExpressionUniqueTable::internRecursively(std::shared_ptr<BaseExpression const> const& expression,
+                                                                                   std::unordered_map<BaseExpression const*, InternedExpression>& cache) {
+    ExpressionKind kind = getKind(*expression);
+    if (kind == ExpressionKind::Other || &expression->getManager() != &manager) {
+        return InternedExpression(expression, false);
+    }
+    auto cacheIt = cache.find(expression.get());
+    if (cacheIt != cache.end()) {
+        return cacheIt->second;
+    }
+
+    Key key;
+    key.kind = static_cast<uint64_t>(kind);
+    key.typeMask = expression->getType().getMask();
+    key.data = getData(kind, *expression);
+    if (kind == ExpressionKind::RationalLiteral) {
+        std::stringstream stream;
+        stream << *expression;
+        key.literal = stream.str();
+    }
+
+    uint64_t arity = expression->getArity();
+    std::vector<std::shared_ptr<BaseExpression const>> operands;
+    operands.reserve(arity);
+    for (uint64_t operandIndex = 0; operandIndex < arity; ++operandIndex) {
+        operands.push_back(expression->getOperand(operandIndex));
+        key.operands.push_back(operands.back().get());
+    }
+
+    InternedExpression result;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto tableIt = table.find(key);
+        if (tableIt != table.end() && tableIt->second.representative.lock() == expression) {
+            // The expression already is a representative (and so are its operands).
+            result = InternedExpression(expression, tableIt->second.complete);
+        }
+    }
+    if (result.first.get() == nullptr) {
+        bool operandsChanged = false;
+        bool complete = true;
+        for (uint64_t operandIndex = 0; operandIndex < arity; ++operandIndex) {
+            InternedExpression internedOperand = internRecursively(operands[operandIndex], cache);
+            complete &= internedOperand.second;
+            if (internedOperand.first != operands[operandIndex]) {
+                operandsChanged = true;
+                key.operands[operandIndex] = internedOperand.first.get();
+                operands[operandIndex] = std::move(internedOperand.first);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto tableIt = table.find(key);
+            if (tableIt != table.end()) {
+                result = InternedExpression(tableIt->second.representative.lock(), tableIt->second.complete);
+            }
+        }
+        // Only build a new expression if there is no representative yet.
+        if (result.first.get() == nullptr) {
+            result = findOrInsert(std::move(key), operandsChanged ? replaceOperands(kind, *expression, operands) : expression, complete);
+        }
+    }
+    cache.emplace(expression.get(), result);
+    return result;
+}
+
+ExpressionUniqueTable::InternedExpression ExpressionUniqueTable::findOrInsert(Key&& key, std::shared_ptr<BaseExpression const> const& candidate,
+                                                                              bool complete) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto insertionResult = table.try_emplace(std::move(key), Entry{candidate, complete});
+    if (!insertionResult.second) {
+        // Another thread may have inserted a representative in the meantime.
+        std::shared_ptr<BaseExpression const> representative = insertionResult.first->second.representative.lock();
+        if (representative.get() != nullptr) {
+            return InternedExpression(representative, insertionResult.first->second.complete);
+        }
+        insertionResult.first->second = Entry{candidate, complete};
+    }
+    if (table.size() >= cleanupThreshold) {
+        removeDeletedEntries();
+    }
+    return InternedExpression(candidate, complete);
+}
+
+void ExpressionUniqueTable::removeDeletedEntries() {
+    for (auto it = table.begin(); it != table.end();) {
+        if (it->second.representative.expired()) {
+            it = table.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = simplifications.begin(); it != simplifications.end();) {
+        if (it->second.first.expired()) {
+            it = simplifications.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    cleanupThreshold = std::max<uint64_t>(initialCleanupThreshold, 2 * table.size());
+}
+
+std::shared_ptr<BaseExpression const> ExpressionUniqueTable::simplify(std::shared_ptr<BaseExpression const> const& expression) {
+    std::shared_ptr<BaseExpression const> internedExpression = intern(expression);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = simplifications.find(internedExpression.get());
+        // The memoized simplification is only valid if the expression was not deleted in the meantime.
+        if (it != simplifications.end() && it->second.first.lock() == internedExpression) {
+            return it->second.second ? it->second.second : internedExpression;
+        }
+    }
+
+    // Simplifying does not access the table, so other threads may continue in the meantime.
+    std::shared_ptr<BaseExpression const> result = intern(internedExpression->simplify());
+    std::lock_guard<std::mutex> lock(mutex);
+    simplifications[internedExpression.get()] = std::make_pair(internedExpression, result == internedExpression ? nullptr : result);
+    return result;
+}
+
+uint64_t ExpressionUniqueTable::getNumberOfEntries() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return table.size();
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace storm {
+namespace expressions {
+
+class BaseExpression;
+class ExpressionManager;
+
+/*!
+ * A unique table for the expressions of an expression manager (also known as hash-consing). Every interned expression is the unique representative
+ * of all structurally equal expressions, so (syntactical) equality of interned expressions amounts to comparing pointers and subexpressions that
+ * occur several times are only stored once. The table only holds weak references, i.e., it does not keep expressions alive.
+ *
+ * All operations may be called concurrently.
+ */
+class ExpressionUniqueTable {
+   public:
+    /*!
+     * Creates an empty unique table for the expressions of the given manager.
+     */
+    ExpressionUniqueTable(ExpressionManager const& manager);
+
+    /*!
+     * Retrieves the unique representative of the given expression. Subexpressions of the result are interned as well.
+     * Expressions that belong to another manager are returned unchanged.
+     *
+     * @param expression The expression to intern.
+     * @param complete If given, this is set to true iff all subexpressions could be interned. Subexpressions of other kinds (e.g. the array
+     * expressions of JANI models) are kept as they are, so structurally equal expressions only share the same representative if they are complete.
+     * @return The unique representative, which is the given expression itself if it already is interned.
+     */
+    std::shared_ptr<BaseExpression const> intern(std::shared_ptr<BaseExpression const> const& expression, bool* complete = nullptr);
+
+    /*!
+     * Simplifies the given expression and interns the result. Simplifications of interned expressions are memoized.
+     *
+     * @param expression The expression to simplify.
+     * @return The (interned) simplified expression.
+     */
+    std::shared_ptr<BaseExpression const> simplify(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves the number of entries in the table. This includes entries whose expression was already deleted, but not yet removed.
+     */
+    uint64_t getNumberOfEntries() const;
+
+   private:
+    /*!
+     * Identifies an expression by its kind, its type, its operator (or value) and the addresses of its (interned) operands.
+     */
+    struct Key {
+        bool operator==(Key const& other) const;
+
+        uint64_t kind;
+        uint64_t typeMask;
+        uint64_t data;
+        std::string literal;
+        std::vector<BaseExpression const*> operands;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Entry {
+        std::weak_ptr<BaseExpression const> representative;
+        // Whether all subexpressions of the representative are interned.
+        bool complete;
+    };
+
+    // The representative of an expression together with the information whether it is complete.
+    typedef std::pair<std::shared_ptr<BaseExpression const>, bool> InternedExpression;
+
+    /*!
+     * Interns the given expression and all its subexpressions. The cache maps subexpressions to their representatives, so subexpressions that
+     * occur multiple times are only processed once. The mutex is only locked while the table is accessed, so several expressions may be interned
+     * concurrently.
+     */
+    InternedExpression internRecursively(std::shared_ptr<BaseExpression const> const& expression,
+                                         std::unordered_map<BaseExpression const*, InternedExpression>& cache);
+
+    /*!
+     * Retrieves the representative for the given key. If there is none, the given candidate becomes the representative.
+     */
+    InternedExpression findOrInsert(Key&& key, std::shared_ptr<BaseExpression const> const& candidate, bool complete);
+
+    /*!
+     * Removes all entries whose expressions were deleted. This is triggered whenever the table has doubled its size. The mutex must be locked by
+     * the caller.
+     */
+    void removeDeletedEntries();
+
+    // The manager responsible for the interned expressions.
+    ExpressionManager const& manager;
+
+    mutable std::mutex mutex;
+
+    // The representatives of all interned expressions.
+    std::unordered_map<Key, Entry, KeyHash> table;
+
+    // The memoized simplifications of interned expressions. The result is null if the expression can not be simplified further.
+    std::unordered_map<BaseExpression const*, std::pair<std::weak_ptr<BaseExpression const>, std::shared_ptr<BaseExpression const>>> simplifications;
+
+    // The number of entries at which deleted entries are removed.
+    uint64_t cleanupThreshold;
+};
+
+}  // namespace expressions
+}  // namespace storm
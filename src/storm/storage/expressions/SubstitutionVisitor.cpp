@@ -2,29 +2,47 @@
 #include <string>
 #include <unordered_map>
 
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expressions.h"
 #include "storm/storage/expressions/SubstitutionVisitor.h"
 
 namespace storm {
 namespace expressions {
 template<typename MapType>
-SubstitutionVisitor<MapType>::SubstitutionVisitor(MapType const& variableToExpressionMapping) : variableToExpressionMapping(variableToExpressionMapping) {
+SubstitutionVisitor<MapType>::SubstitutionVisitor(MapType const& variableToExpressionMapping)
+    : variableToExpressionMapping(variableToExpressionMapping), useCache(false) {
     // Intentionally left empty.
 }
 
 template<typename MapType>
 Expression SubstitutionVisitor<MapType>::substitute(Expression const& expression) {
-    return Expression(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getBaseExpression().accept(*this, boost::none)));
+    cache.clear();
+    useCache = expression.getManager().isHashConsingEnabled();
+    Expression result(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getBaseExpression().accept(*this, boost::none)));
+    cache.clear();
+    return expression.getManager().intern(result);
+}
+
+template<typename MapType>
+std::shared_ptr<BaseExpression const> SubstitutionVisitor<MapType>::substituteOperand(std::shared_ptr<BaseExpression const> const& operand,
+                                                                                      boost::any const& data) {
+    if (!useCache) {
+        return boost::any_cast<std::shared_ptr<BaseExpression const>>(operand->accept(*this, data));
+    }
+    auto cacheIt = cache.find(operand.get());
+    if (cacheIt != cache.end()) {
+        return cacheIt->second;
+    }
+    auto result = boost::any_cast<std::shared_ptr<BaseExpression const>>(operand->accept(*this, data));
+    cache.emplace(operand.get(), result);
+    return result;
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(IfThenElseExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> conditionExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getCondition()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> thenExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getThenExpression()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> elseExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getElseExpression()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> conditionExpression = this->substituteOperand(expression.getCondition(), data);
+    std::shared_ptr<BaseExpression const> thenExpression = this->substituteOperand(expression.getThenExpression(), data);
+    std::shared_ptr<BaseExpression const> elseExpression = this->substituteOperand(expression.getElseExpression(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (conditionExpression.get() == expression.getCondition().get() && thenExpression.get() == expression.getThenExpression().get() &&
@@ -38,10 +56,8 @@ boost::any SubstitutionVisitor<MapType>::visit(IfThenElseExpression const& expre
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = this->substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = this->substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
@@ -54,10 +70,8 @@ boost::any SubstitutionVisitor<MapType>::visit(BinaryBooleanFunctionExpression c
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = this->substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = this->substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
@@ -70,10 +84,8 @@ boost::any SubstitutionVisitor<MapType>::visit(BinaryNumericalFunctionExpression
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryRelationExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = this->substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = this->substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
@@ -97,8 +109,7 @@ boost::any SubstitutionVisitor<MapType>::visit(VariableExpression const& express
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> operandExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> operandExpression = this->substituteOperand(expression.getOperand(), data);
 
     // If the argument did not change, we simply push the expression itself.
     if (operandExpression.get() == expression.getOperand().get()) {
@@ -111,8 +122,7 @@ boost::any SubstitutionVisitor<MapType>::visit(UnaryBooleanFunctionExpression co
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> operandExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> operandExpression = this->substituteOperand(expression.getOperand(), data);
 
     // If the argument did not change, we simply push the expression itself.
     if (operandExpression.get() == expression.getOperand().get()) {
@@ -128,7 +138,7 @@ boost::any SubstitutionVisitor<MapType>::visit(PredicateExpression const& expres
     bool changed = false;
     std::vector<std::shared_ptr<BaseExpression const>> newExpressions;
     for (uint64_t i = 0; i < expression.getArity(); ++i) {
-        newExpressions.push_back(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand(i)->accept(*this, data)));
+        newExpressions.push_back(this->substituteOperand(expression.getOperand(i), data));
         if (!changed && newExpressions.back() != expression.getOperand(i)) {
             changed = true;
         }
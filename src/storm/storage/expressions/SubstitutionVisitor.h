@@ -2,6 +2,7 @@
 #define STORM_STORAGE_EXPRESSIONS_SUBSTITUTIONVISITOR_H_
 
 #include <stack>
+#include <unordered_map>
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionVisitor.h"
@@ -41,8 +42,19 @@ class SubstitutionVisitor : public ExpressionVisitor {
     virtual boost::any visit(PredicateExpression const& expression, boost::any const& data) override;
 
    protected:
+    /*!
+     * Substitutes the identifiers in the given operand. If hash-consing is enabled for the expressions, the results are cached, so operands that
+     * occur multiple times are only processed once.
+     */
+    std::shared_ptr<BaseExpression const> substituteOperand(std::shared_ptr<BaseExpression const> const& operand, boost::any const& data);
+
     // A mapping of variables to expressions with which they shall be replaced.
     MapType const& variableToExpressionMapping;
+
+   private:
+    // The substitutions of the operands that were already processed (only used if hash-consing is enabled).
+    std::unordered_map<BaseExpression const*, std::shared_ptr<BaseExpression const>> cache;
+    bool useCache;
 };
 }  // namespace expressions
 }  // namespace storm
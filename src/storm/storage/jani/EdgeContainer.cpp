@@ -1,8 +1,10 @@
 #include "storm/storage/jani/EdgeContainer.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/jani/Edge.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/TemplateEdge.h"
 #include "storm/storage/jani/Variable.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace jani {
@@ -95,11 +97,36 @@ void EdgeContainer::liftTransientDestinationAssignments(int64_t maxLevel) {
 }
 
 void EdgeContainer::substitute(std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution) {
+    std::vector<TemplateEdge*> templateEdges;
+    templateEdges.reserve(templates.size());
     for (auto& templateEdge : templates) {
-        templateEdge->substitute(substitution);
+        templateEdges.push_back(templateEdge.get());
     }
-    for (auto& edge : edges) {
-        edge.substitute(substitution);
+
+    // All (template) edges are substituted independently of each other, which is done concurrently for automata with many edges.
+    bool substituteConcurrently = false;
+#ifdef STORM_HAVE_INTELTBB
+    substituteConcurrently = std::max(templateEdges.size(), edges.size()) > 1 && storm::utility::getNumberOfThreads() > 1;
+    if (substituteConcurrently) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, templateEdges.size()), [&substitution, &templateEdges](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                templateEdges[index]->substitute(substitution);
+            }
+        });
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, edges.size()), [this, &substitution](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                edges[index].substitute(substitution);
+            }
+        });
+    }
+#endif
+    if (!substituteConcurrently) {
+        for (auto templateEdge : templateEdges) {
+            templateEdge->substitute(substitution);
+        }
+        for (auto& edge : edges) {
+            edge.substitute(substitution);
+        }
     }
 }
 
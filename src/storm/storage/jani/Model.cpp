@@ -2,6 +2,7 @@
 
 #include <algorithm>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
 #include "Compositions.h"
@@ -31,6 +32,7 @@
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 #include "storm/solver/SmtSolver.h"
@@ -1100,6 +1102,30 @@ Model& Model::replaceUnassignedVariablesWithConstants() {
     return *this;
 }
 
+namespace {
+/*!
+ * Applies the substitution to all given automata. The automata are independent of each other, so this is done concurrently (if possible).
+ */
+void substituteInAutomata(std::vector<Automaton>& automata, std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution) {
+    bool substituteConcurrently = false;
+#ifdef STORM_HAVE_INTELTBB
+    substituteConcurrently = automata.size() > 1 && storm::utility::getNumberOfThreads() > 1;
+    if (substituteConcurrently) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, automata.size(), 1), [&automata, &substitution](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t automatonIndex = range.begin(); automatonIndex < range.end(); ++automatonIndex) {
+                automata[automatonIndex].substitute(substitution);
+            }
+        });
+    }
+#endif
+    if (!substituteConcurrently) {
+        for (auto& automaton : automata) {
+            automaton.substitute(substitution);
+        }
+    }
+}
+}  // namespace
+
 Model& Model::substituteConstantsInPlace() {
     // Gather all defining expressions of constants.
     std::map<storm::expressions::Variable, storm::expressions::Expression> constantSubstitution;
@@ -1128,9 +1154,7 @@ Model& Model::substituteConstantsInPlace() {
     }
 
     // Substitute constants in variables of automata and their edges.
-    for (auto& automaton : this->getAutomata()) {
-        automaton.substitute(constantSubstitution);
-    }
+    substituteInAutomata(this->getAutomata(), constantSubstitution);
 
     return *this;
 }
@@ -1196,9 +1220,7 @@ void Model::substitute(std::map<storm::expressions::Variable, storm::expressions
     }
 
     // Substitute in variables of automata and their edges.
-    for (auto& automaton : this->getAutomata()) {
-        automaton.substitute(substitution);
-    }
+    substituteInAutomata(this->getAutomata(), substitution);
 }
 
 void Model::substituteFunctions() {
@@ -1,8 +1,10 @@
 #include "storm/storage/prism/Module.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/InvalidAccessException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace prism {
@@ -264,10 +266,23 @@ Module Module::substitute(std::map<storm::expressions::Variable, storm::expressi
         newIntegerVariables.emplace_back(integerVariable.substitute(substitution));
     }
 
-    std::vector<Command> newCommands;
-    newCommands.reserve(this->getNumberOfCommands());
-    for (auto const& command : this->getCommands()) {
-        newCommands.emplace_back(command.substitute(substitution));
+    // The commands are substituted independently of each other, which is done concurrently for programs with many commands.
+    std::vector<Command> newCommands(this->getNumberOfCommands());
+    bool substituteConcurrently = false;
+#ifdef STORM_HAVE_INTELTBB
+    substituteConcurrently = newCommands.size() > 1 && storm::utility::getNumberOfThreads() > 1;
+    if (substituteConcurrently) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, newCommands.size()), [this, &substitution, &newCommands](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t commandIndex = range.begin(); commandIndex < range.end(); ++commandIndex) {
+                newCommands[commandIndex] = this->getCommands()[commandIndex].substitute(substitution);
+            }
+        });
+    }
+#endif
+    if (!substituteConcurrently) {
+        for (uint64_t commandIndex = 0; commandIndex < newCommands.size(); ++commandIndex) {
+            newCommands[commandIndex] = this->getCommands()[commandIndex].substitute(substitution);
+        }
     }
 
     return Module(this->getName(), newBooleanVariables, newIntegerVariables, this->getClockVariables(), this->getInvariant(), newCommands, this->getFilename(),
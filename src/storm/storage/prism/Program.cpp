@@ -7,6 +7,7 @@
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Property.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/InternalException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -18,6 +19,7 @@
 #include "storm/storage/jani/visitor/JaniExpressionSubstitutionVisitor.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/solver.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 #include "storm/storage/prism/CompositionVisitor.h"
@@ -1107,15 +1109,32 @@ Program Program::substituteConstantsFormulas(bool substituteConstants, bool subs
         newIntegerVariables.emplace_back(integerVariable.substitute(substitution));
     }
 
-    std::vector<Module> newModules;
-    newModules.reserve(this->getNumberOfModules());
-    for (auto const& module : this->getModules()) {
+    std::vector<Module> newModules(this->getNumberOfModules());
+    auto substituteModule = [this, &substitution, &newModules](uint64_t moduleIndex) {
+        auto const& module = this->getModule(moduleIndex);
         if (module.isRenamedFromModule()) {
             // The renaming needs to be applied to the substitution as well.
             auto renamedSubstitution = getSubstitutionForRenamedModule(module, substitution);
-            newModules.emplace_back(module.substitute(renamedSubstitution));
+            newModules[moduleIndex] = module.substitute(renamedSubstitution);
         } else {
-            newModules.emplace_back(module.substitute(substitution));
+            newModules[moduleIndex] = module.substitute(substitution);
+        }
+    };
+    // Modules are substituted independently of each other (and the commands of each module are substituted concurrently as well).
+    bool substituteConcurrently = false;
+#ifdef STORM_HAVE_INTELTBB
+    substituteConcurrently = newModules.size() > 1 && storm::utility::getNumberOfThreads() > 1;
+    if (substituteConcurrently) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, newModules.size(), 1), [&substituteModule](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t moduleIndex = range.begin(); moduleIndex < range.end(); ++moduleIndex) {
+                substituteModule(moduleIndex);
+            }
+        });
+    }
+#endif
+    if (!substituteConcurrently) {
+        for (uint64_t moduleIndex = 0; moduleIndex < newModules.size(); ++moduleIndex) {
+            substituteModule(moduleIndex);
         }
     }
 
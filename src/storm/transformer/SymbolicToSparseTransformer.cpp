@@ -1,5 +1,6 @@
 #include "SymbolicToSparseTransformer.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/logic/AtomicExpressionFormula.h"
 #include "storm/logic/AtomicLabelFormula.h"
@@ -35,6 +36,48 @@ struct LabelInformation {
     std::map<std::string, storm::expressions::Expression> expressionLabels;
 };
 
+template<storm::dd::DdType Type, typename ValueType>
+storm::models::sparse::StateLabeling translateLabeling(storm::models::symbolic::Model<Type, ValueType> const& symbolicModel, storm::dd::Odd const& odd,
+                                                       std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    // Obtaining the states of a label may create new DD nodes, which is why this has to be done sequentially.
+    std::vector<std::pair<std::string, storm::dd::Bdd<Type>>> labelsAndStates;
+    labelsAndStates.emplace_back("init", symbolicModel.getInitialStates());
+    labelsAndStates.emplace_back("deadlock", symbolicModel.getDeadlockStates());
+    if (formulas.empty()) {
+        for (auto const& label : symbolicModel.getLabels()) {
+            labelsAndStates.emplace_back(label, symbolicModel.getStates(label));
+        }
+    } else {
+        LabelInformation labelInfo(formulas);
+        for (auto const& label : labelInfo.atomicLabels) {
+            labelsAndStates.emplace_back(label, symbolicModel.getStates(label));
+        }
+        for (auto const& expressionLabel : labelInfo.expressionLabels) {
+            labelsAndStates.emplace_back(expressionLabel.first, symbolicModel.getStates(expressionLabel.second));
+        }
+    }
+
+    // The translation of the BDDs to bit vectors only reads the BDDs, so the labels can be translated concurrently.
+    std::vector<storm::storage::BitVector> labelVectors(labelsAndStates.size());
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, labelsAndStates.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            labelVectors[index] = labelsAndStates[index].second.toVector(odd);
+        }
+    });
+#else
+    for (uint64_t index = 0; index < labelsAndStates.size(); ++index) {
+        labelVectors[index] = labelsAndStates[index].second.toVector(odd);
+    }
+#endif
+
+    storm::models::sparse::StateLabeling labelling(odd.getTotalOffset());
+    for (uint64_t index = 0; index < labelsAndStates.size(); ++index) {
+        labelling.addLabel(labelsAndStates[index].first, std::move(labelVectors[index]));
+    }
+    return labelling;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(
     storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
@@ -57,23 +100,7 @@ std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmc
         rewardModels.emplace(rewardModelNameAndModel.first,
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicDtmc.getInitialStates().toVector(this->odd));
-    labelling.addLabel("deadlock", symbolicDtmc.getDeadlockStates().toVector(this->odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicDtmc.getLabels()) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicDtmc.getStates(expressionLabel.second).toVector(this->odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateLabeling(symbolicDtmc, this->odd, formulas);
     return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(transitionMatrix, labelling, rewardModels);
 }
 
@@ -126,23 +153,7 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
 
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicMdp.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMdp.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicMdp.getLabels()) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMdp.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateLabeling(symbolicMdp, odd, formulas);
 
     return std::make_shared<storm::models::sparse::Mdp<ValueType>>(transitionMatrix, labelling, rewardModels);
 }
@@ -169,23 +180,7 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmc
         rewardModels.emplace(rewardModelNameAndModel.first,
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicCtmc.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicCtmc.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicCtmc.getLabels()) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicCtmc.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateLabeling(symbolicCtmc, odd, formulas);
 
     return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(transitionMatrix, labelling, rewardModels);
 }
@@ -233,23 +228,7 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToS
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
 
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicMa.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMa.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicMa.getLabels()) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMa.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateLabeling(symbolicMa, odd, formulas);
     storm::storage::BitVector markovianStates = symbolicMa.getMarkovianStates().toVector(odd);
     storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels), false,
                                                                   std::move(markovianStates));
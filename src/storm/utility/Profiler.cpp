@@ -0,0 +1,243 @@
+#include "storm/utility/Profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/io/file.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+Profiler::Phase::Phase(std::string const& name, Phase* parent)
+    : name(name),
+      parent(parent),
+      count(0),
+      watch(false),
+      entryResidentSetSize(0),
+      exitResidentSetSize(0),
+      peakResidentSetSize(0),
+      entryProcessPeakResidentSetSize(0),
+      maximalResidentSetSizeIncrease(std::numeric_limits<int64_t>::min()) {
+    // Intentionally left empty.
+}
+
+Profiler::Profiler() : enabled(false), current(nullptr), isPeakResettable(false), observedPeakResidentSetSize(0) {
+    // Intentionally left empty.
+}
+
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+void Profiler::enable() {
+    std::lock_guard<std::mutex> lock(mutex);
+    enabled = true;
+    owner = std::this_thread::get_id();
+    root = std::make_unique<Phase>("total", nullptr);
+    root->count = 1;
+    root->entryResidentSetSize = getCurrentResidentSetSize();
+    root->peakResidentSetSize = root->entryResidentSetSize;
+    observedPeakResidentSetSize = getPeakResidentSetSize();
+    isPeakResettable = resetPeakResidentSetSize() && getPeakResidentSetSizeSinceReset() > 0;
+    STORM_LOG_WARN_COND(isPeakResettable, "Can not reset the peak memory consumption. The profiler only reports peaks that exceed all previous peaks.");
+    root->watch.start();
+    current = root.get();
+}
+
+void Profiler::disable() {
+    enabled = false;
+}
+
+bool Profiler::isEnabled() const {
+    return enabled;
+}
+
+bool Profiler::enterPhase(std::string const& name) {
+    if (!enabled || std::this_thread::get_id() != owner) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    Phase* child = nullptr;
+    for (auto const& candidate : current->children) {
+        if (candidate->name == name) {
+            child = candidate.get();
+            break;
+        }
+    }
+    if (child == nullptr) {
+        current->children.push_back(std::make_unique<Phase>(name, current));
+        child = current->children.back().get();
+    }
+    // The peak of the current phase so far is determined before the peak is reset for the child.
+    updatePeakResidentSetSize();
+    ++child->count;
+    child->entryResidentSetSize = getCurrentResidentSetSize();
+    child->peakResidentSetSize = child->entryResidentSetSize;
+    child->entryProcessPeakResidentSetSize = getPeakResidentSetSize();
+    child->watch.start();
+    current = child;
+    return true;
+}
+
+void Profiler::leavePhase() {
+    std::lock_guard<std::mutex> lock(mutex);
+    STORM_LOG_ASSERT(current != nullptr && current->parent != nullptr, "Leaving a phase that was not entered.");
+    current->watch.stop();
+    current->exitResidentSetSize = getCurrentResidentSetSize();
+    current->peakResidentSetSize = std::max(current->peakResidentSetSize, current->exitResidentSetSize);
+    updatePeakResidentSetSize();
+    current->maximalResidentSetSizeIncrease =
+        std::max(current->maximalResidentSetSizeIncrease,
+                 static_cast<int64_t>(current->peakResidentSetSize) - static_cast<int64_t>(current->entryResidentSetSize));
+    // The peak of the child is also a peak of its parent.
+    current->parent->peakResidentSetSize = std::max(current->parent->peakResidentSetSize, current->peakResidentSetSize);
+    current = current->parent;
+}
+
+void Profiler::updatePeakResidentSetSize() {
+    uint64_t peak = std::max(current->peakResidentSetSize, getCurrentResidentSetSize());
+    if (isPeakResettable) {
+        peak = std::max(peak, getPeakResidentSetSizeSinceReset());
+        resetPeakResidentSetSize();
+    } else {
+        // The process peak only tells us about the phase if it was reached after entering the phase.
+        uint64_t processPeak = getPeakResidentSetSize();
+        if (processPeak > current->entryProcessPeakResidentSetSize) {
+            peak = std::max(peak, processPeak);
+        }
+    }
+    current->peakResidentSetSize = peak;
+}
+
+void Profiler::addToCounter(std::string const& name, uint64_t value) {
+    if (!enabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    current->counters[name] += value;
+}
+
+storm::json<double> Profiler::toJson() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!root) {
+        return storm::json<double>();
+    }
+    // The root phase is still running, so its time and memory include the current measurement.
+    storm::json<double> result = toJson(*root);
+    result["rss-exit"] = getCurrentResidentSetSize();
+    result["process-peak-rss"] = getPeakResidentSetSize();
+    return result;
+}
+
+storm::json<double> Profiler::toJson(Phase const& phase) {
+    storm::json<double> result;
+    result["name"] = phase.name;
+    result["count"] = phase.count;
+    result["time"] = phase.watch.getTimeInMilliseconds() / 1000.0;
+    result["rss-entry"] = phase.entryResidentSetSize;
+    result["rss-exit"] = phase.exitResidentSetSize;
+    // The peak is only known once the phase was left.
+    if (phase.maximalResidentSetSizeIncrease != std::numeric_limits<int64_t>::min()) {
+        result["rss-peak"] = phase.peakResidentSetSize;
+        result["rss-max-increase"] = phase.maximalResidentSetSizeIncrease;
+    }
+    if (!phase.counters.empty()) {
+        storm::json<double> counters;
+        for (auto const& counter : phase.counters) {
+            counters[counter.first] = counter.second;
+        }
+        result["counters"] = std::move(counters);
+    }
+    if (!phase.children.empty()) {
+        storm::json<double> children = storm::json<double>::array();
+        for (auto const& child : phase.children) {
+            children.push_back(toJson(*child));
+        }
+        result["phases"] = std::move(children);
+    }
+    return result;
+}
+
+void Profiler::exportToJson(std::string const& filename) const {
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream << storm::dumpJson(toJson()) << '\n';
+    storm::utility::closeFile(stream);
+}
+
+uint64_t Profiler::getPeakResidentSetSize() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    uint64_t peak = ru.ru_maxrss;
+#else
+    // For Linux, this is returned in kilobytes.
+    uint64_t peak = static_cast<uint64_t>(ru.ru_maxrss) * 1024;
+#endif
+    // Resetting the peak for the phases also resets the peak reported by the operating system.
+    return std::max(peak, getInstance().observedPeakResidentSetSize.load());
+}
+
+uint64_t Profiler::getPeakResidentSetSizeSinceReset() {
+#ifdef LINUX
+    std::ifstream stream("/proc/self/status");
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            // The value is given in kilobytes.
+            uint64_t peak = std::stoull(line.substr(6)) * 1024;
+            observedPeakResidentSetSize = std::max(observedPeakResidentSetSize.load(), peak);
+            return peak;
+        }
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+bool Profiler::resetPeakResidentSetSize() {
+#ifdef LINUX
+    // Writing 5 resets the peak resident set size to the current resident set size (since Linux 4.0).
+    std::ofstream stream("/proc/self/clear_refs");
+    stream << "5";
+    stream.close();
+    return static_cast<bool>(stream);
+#else
+    return false;
+#endif
+}
+
+uint64_t Profiler::getCurrentResidentSetSize() {
+#ifdef LINUX
+    // The second entry is the number of resident pages.
+    std::ifstream stream("/proc/self/statm");
+    uint64_t size = 0;
+    uint64_t residentPages = 0;
+    if (stream >> size >> residentPages) {
+        return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+ProfilingScope::ProfilingScope(char const* name) : entered(Profiler::getInstance().isEnabled() && Profiler::getInstance().enterPhase(name)) {
+    // Intentionally left empty.
+}
+
+ProfilingScope::~ProfilingScope() {
+    if (entered) {
+        Profiler::getInstance().leavePhase();
+    }
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storm/adapters/JsonForward.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Collects a hierarchy of phases (e.g. parsing, building, graph analysis, equation solving) together with the time spent in them,
+ * the resident set size when entering and leaving each phase, the peak resident set size within each phase and counters (e.g. solver iterations).
+ *
+ * On Linux, the peak within a phase is obtained by resetting the peak of the process (via /proc/self/clear_refs) at phase boundaries and
+ * reading it (VmHWM) when the phase is left. Otherwise, the peak of the whole process is used, i.e., peaks within a phase are only detected
+ * if they exceed all previous peaks.
+ *
+ * Phases are entered and left via ProfilingScope objects. Entering a phase with the same name as an existing child of the current phase
+ * accumulates the measurements of the existing child. Only the thread that enabled the profiler enters and leaves phases, i.e., phases
+ * that are entered on other (worker) threads are not recorded. Counters may be increased from any thread and are attributed to the
+ * current phase.
+ * As long as the profiler is not enabled, all operations are no-ops.
+ */
+class Profiler {
+   public:
+    /*!
+     * Retrieves the (only) profiler instance.
+     */
+    static Profiler& getInstance();
+
+    /*!
+     * Enables the profiler. The calling thread becomes the thread whose phases are recorded. Previously collected data is discarded.
+     */
+    void enable();
+
+    /*!
+     * Disables the profiler. The collected data is kept.
+     */
+    void disable();
+
+    /*!
+     * Retrieves whether the profiler is enabled.
+     */
+    bool isEnabled() const;
+
+    /*!
+     * Enters the child of the current phase with the given name. If the calling thread is not the one that enabled the profiler, nothing happens.
+     * @return true iff the phase was entered, i.e., leavePhase needs to be called eventually.
+     */
+    bool enterPhase(std::string const& name);
+
+    /*!
+     * Leaves the current phase.
+     */
+    void leavePhase();
+
+    /*!
+     * Adds the given value to the counter with the given name of the current phase.
+     */
+    void addToCounter(std::string const& name, uint64_t value = 1);
+
+    /*!
+     * Retrieves the collected data as a json tree.
+     */
+    storm::json<double> toJson() const;
+
+    /*!
+     * Writes the collected data as a json tree to the given file.
+     */
+    void exportToJson(std::string const& filename) const;
+
+    /*!
+     * Retrieves the peak resident set size of this process over its whole lifetime (in bytes). This includes peaks that were observed by the
+     * profiler before it reset the peak of the operating system.
+     */
+    static uint64_t getPeakResidentSetSize();
+
+    /*!
+     * Retrieves the current resident set size of this process (in bytes) or zero if it can not be determined on this platform.
+     */
+    static uint64_t getCurrentResidentSetSize();
+
+   private:
+    struct Phase {
+        Phase(std::string const& name, Phase* parent);
+
+        std::string name;
+        Phase* parent;
+        // How often the phase was entered.
+        uint64_t count;
+        // The time spent in the phase.
+        Stopwatch watch;
+        // The resident set size when the phase was entered and left the last time.
+        uint64_t entryResidentSetSize;
+        uint64_t exitResidentSetSize;
+        // The peak resident set size of the current (or last) visit of the phase, including the peaks of its children.
+        uint64_t peakResidentSetSize;
+        // The peak resident set size of the process when the phase was entered the last time. Only used if the peak can not be reset.
+        uint64_t entryProcessPeakResidentSetSize;
+        // The largest increase of the peak resident set size during a visit of the phase over the resident set size when entering it.
+        int64_t maximalResidentSetSizeIncrease;
+        std::map<std::string, uint64_t> counters;
+        std::vector<std::unique_ptr<Phase>> children;
+    };
+
+    Profiler();
+
+    static storm::json<double> toJson(Phase const& phase);
+
+    /*!
+     * Retrieves the peak resident set size since the last reset (in bytes). The result is only meaningful if isPeakResettable is set.
+     */
+    uint64_t getPeakResidentSetSizeSinceReset();
+
+    /*!
+     * Resets the peak resident set size of the operating system to the current resident set size.
+     * @return true iff the peak could be reset.
+     */
+    static bool resetPeakResidentSetSize();
+
+    /*!
+     * Determines the peak resident set size of the current visit of the current phase when it is left or a child is entered.
+     */
+    void updatePeakResidentSetSize();
+
+    std::atomic<bool> enabled;
+    // The thread that enabled the profiler. It is compared against without holding the mutex.
+    std::atomic<std::thread::id> owner;
+    std::unique_ptr<Phase> root;
+    Phase* current;
+    // Whether the peak resident set size can be reset at phase boundaries (only on Linux).
+    bool isPeakResettable;
+    // The largest peak resident set size that was read before resetting the peak.
+    std::atomic<uint64_t> observedPeakResidentSetSize;
+    mutable std::mutex mutex;
+};
+
+/*!
+ * Enters the phase with the given name upon construction and leaves it upon destruction.
+ */
+class ProfilingScope {
+   public:
+    explicit ProfilingScope(char const* name);
+    ~ProfilingScope();
+
+    ProfilingScope(ProfilingScope const&) = delete;
+    ProfilingScope& operator=(ProfilingScope const&) = delete;
+
+   private:
+    bool entered;
+};
+
+}  // namespace utility
+}  // namespace storm
@@ -23,6 +23,7 @@
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -412,6 +413,7 @@ template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
+    storm::utility::ProfilingScope profilingScope("graph analysis");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
@@ -837,6 +839,7 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
+    storm::utility::ProfilingScope profilingScope("graph analysis");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
 
     result.first = performProb0A(backwardTransitions, phiStates, psiStates);
@@ -1081,6 +1084,7 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
+    storm::utility::ProfilingScope profilingScope("graph analysis");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
     result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
     // Instead of calling performProb1A, we call the (more easier) performProb0A on the Prob0E states.
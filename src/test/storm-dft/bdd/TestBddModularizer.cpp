@@ -64,7 +64,21 @@ static std::vector<ModularizerTestData> modularizerTestData{
         STORM_TEST_RESOURCES_DIR "/dft/mcs.dft",
         0.9984947969,
     },
+    {
+        "IsomorphicModules",
+        STORM_TEST_RESOURCES_DIR "/dft/bdd/IsomorphicModulesTest.dft",
+        0.002910353919,
+    },
 };
 INSTANTIATE_TEST_SUITE_P(BddModularizer, BddModularizerTest, testing::ValuesIn(modularizerTestData), [](auto const &info) { return info.param.testname; });
 
+TEST(BddModularizerTest, IsomorphicModulesAnalysedOnce) {
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/bdd/IsomorphicModulesTest.dft")};
+    storm::dft::modelchecker::DftModularizationChecker<double> checker(dft);
+    // M1 and M2 are isomorphic. M3 and M4 differ in the order of the PAND children.
+    EXPECT_EQ(4ul, checker.getNumberOfDynamicModules());
+    EXPECT_EQ(3ul, checker.getNumberOfAnalysedDynamicModules());
+    EXPECT_NEAR(0.002910353919, checker.getProbabilityAtTimebound(1), 1e-6);
+}
+
 }  // namespace
@@ -0,0 +1,61 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/simulator/DFTMonteCarloSimulator.h"
+#include "storm-dft/storage/DftSymmetries.h"
+
+namespace {
+
+// Helper function
+std::vector<storm::dft::simulator::UnreliabilityEstimate> estimateDft(std::string const& file, std::vector<double> const& timebounds, double precision,
+                                                                      bool relative = false, uint64_t splittingFactor = 1, uint64_t maximalLevel = 0) {
+    // Load, build and prepare DFT
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(file)));
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+
+    // Set relevant events
+    storm::dft::utility::RelevantEvents relevantEvents = storm::dft::api::computeRelevantEvents({}, {});
+    dft->setRelevantEvents(relevantEvents, false);
+
+    // Find symmetries
+    storm::dft::storage::DftSymmetries symmetries;
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+
+    storm::dft::simulator::DFTMonteCarloSimulator<double> simulator(*dft, stateGenerationInfo, 5u);
+    simulator.setPrecision(precision, relative);
+    simulator.setMaximalNumberOfTraces(1000000);
+    simulator.setImportanceSplitting(splittingFactor, maximalLevel);
+    return simulator.estimateUnreliability(timebounds);
+}
+
+TEST(DftMonteCarloSimulatorTest, AndUnreliability) {
+    auto estimates = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", {2, 1}, 0.002);
+    ASSERT_EQ(2ul, estimates.size());
+    EXPECT_EQ(2, estimates[0].timebound);
+    EXPECT_NEAR(estimates[0].probability, 0.3995764009, 0.01);
+    EXPECT_LE(estimates[0].halfWidth, 0.002);
+    EXPECT_EQ(1, estimates[1].timebound);
+    EXPECT_NEAR(estimates[1].probability, 0.1548181217, 0.01);
+    EXPECT_LE(estimates[1].halfWidth, 0.002);
+}
+
+TEST(DftMonteCarloSimulatorTest, Reproducible) {
+    auto estimates = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/spare.dft", {1}, 0.005);
+    auto estimates2 = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/spare.dft", {1}, 0.005);
+    EXPECT_NEAR(estimates[0].probability, 0.1118530638, 0.01);
+    EXPECT_EQ(estimates[0].probability, estimates2[0].probability);
+}
+
+TEST(DftMonteCarloSimulatorTest, ImportanceSplitting) {
+    auto estimates = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft", {1}, 0.1, true, 2, 4);
+    EXPECT_NEAR(estimates[0].probability, 0.00021997582, 0.00005);
+}
+
+TEST(DftMonteCarloSimulatorTest, InvalidStates) {
+    // Invalid states are currently not supported
+    STORM_SILENT_EXPECT_THROW(estimateDft(STORM_TEST_RESOURCES_DIR "/dft/mutex.dft", {1}, 0.01), storm::exceptions::NotSupportedException);
+}
+
+}  // namespace
@@ -1160,4 +1160,43 @@ TEST(PrismMenuGame, WlanFullAbstractionTest_Sylvan) {
     storm::settings::mutableAbstractionSettings().restoreDefaults();
 }
 
+TEST(PrismMenuGame, WlanParallelAbstractionTest_Cudd) {
+    auto abstractWlan = [](bool parallel) {
+        auto& settings = storm::settings::mutableAbstractionSettings();
+        settings.setAddAllGuards(false);
+        settings.setAddAllInitialExpressions(false);
+        settings.setParallelAbstraction(parallel);
+
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+        program = program.substituteConstantsFormulas();
+        program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+
+        std::vector<storm::expressions::Expression> initialPredicates;
+        storm::expressions::ExpressionManager& manager = program.getManager();
+
+        initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+        initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+        initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+
+        storm::gbar::abstraction::prism::PrismMenuGameAbstractor<storm::dd::DdType::CUDD, double> abstractor(program, smtSolverFactory);
+        storm::gbar::abstraction::MenuGameRefiner<storm::dd::DdType::CUDD, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)});
+
+        storm::gbar::abstraction::MenuGame<storm::dd::DdType::CUDD, double> game = abstractor.abstract();
+        storm::settings::mutableAbstractionSettings().restoreDefaults();
+        return std::make_tuple(game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount());
+    };
+
+    // Computing the abstractions of the commands concurrently yields the same game as the sequential computation.
+    auto sequentialResult = abstractWlan(false);
+    auto parallelResult = abstractWlan(true);
+    EXPECT_EQ(1800ull, std::get<0>(sequentialResult));
+    EXPECT_EQ(16ull, std::get<1>(sequentialResult));
+    EXPECT_EQ(8ull, std::get<2>(sequentialResult));
+    EXPECT_EQ(sequentialResult, parallelResult);
+}
+
 #endif
@@ -6,9 +6,12 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/api/builder.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -108,4 +111,42 @@ TYPED_TEST(ParametricDtmcPrctlModelCheckerTest, Die) {
 
     EXPECT_EQ(this->parseNumber("11/3"), quantitativeResult4[0].evaluate(instantiation));
 }
+
+TEST(ParametricDtmcEliminationModelCheckerTest, CrowdsParallel) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    auto expManager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::parser::FormulaParser formulaParser(expManager);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>> checker(*dtmc);
+    std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = checker.check(*formula);
+    std::unique_ptr<storm::modelchecker::CheckResult> parallelResult;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> parallelElimination =
+            dynamic_cast<storm::settings::modules::EliminationSettings&>(
+                storm::settings::mutableManager().getModule(storm::settings::modules::EliminationSettings::moduleName))
+                .overrideParallelEliminationSet(true);
+        parallelResult = checker.check(*formula);
+    }
+
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> instantiation;
+    for (auto const& parameter : storm::models::sparse::getProbabilityParameters(*dtmc)) {
+        std::string value = parameter.name() == "PF" ? "4/5" : "1/10";
+        instantiation.emplace(parameter, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+    }
+
+    // Parametric models fall back to sequential elimination and therefore yield the same rational functions.
+    auto const& sequentialValues = sequentialResult->asExplicitQuantitativeCheckResult<storm::RationalFunction>().getValueVector();
+    auto const& parallelValues = parallelResult->asExplicitQuantitativeCheckResult<storm::RationalFunction>().getValueVector();
+    ASSERT_EQ(sequentialValues.size(), parallelValues.size());
+    for (uint64_t state = 0; state < sequentialValues.size(); ++state) {
+        EXPECT_TRUE(storm::utility::isZero(sequentialValues[state] - parallelValues[state])) << "Different results for state " << state << ".";
+        EXPECT_EQ(sequentialValues[state].evaluate(instantiation), parallelValues[state].evaluate(instantiation));
+    }
+}
 }  // namespace
@@ -0,0 +1,69 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <carl/core/VariablePool.h>
+
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/api/builder.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/utility/prism.h"
+
+namespace {
+
+void checkBatchAgainstSequential(std::string const& formulaAsString) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm";
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> const checkTask(*formulas[0]);
+    uint64_t initialState = dtmc->getInitialStates().getNextSetIndex(0);
+
+    storm::RationalFunctionVariable const& p = carl::VariablePool::getInstance().findVariableWithName("p");
+    ASSERT_NE(p, carl::Variable::NO_VARIABLE);
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (uint64_t i = 1; i < 100; ++i) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        valuation[p] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.01 * i);
+        valuations.push_back(valuation);
+    }
+
+    storm::Environment env;
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> sequentialChecker(*dtmc);
+    sequentialChecker.specifyFormula(checkTask);
+    sequentialChecker.setInstantiationsAreGraphPreserving(true);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(*dtmc);
+    batchChecker.specifyFormula(checkTask);
+    batchChecker.setInstantiationsAreGraphPreserving(true);
+    batchChecker.setMaximalBatchSize(16);
+    // Only keep the solutions of the previous batch such that old solutions are discarded.
+    batchChecker.setMaximalNumberOfWarmStartPoints(16);
+
+    std::vector<storm::utility::Stopwatch> valuationWatches;
+    auto batchResults = batchChecker.checkMultiple(env, valuations, &valuationWatches);
+    ASSERT_EQ(valuations.size(), batchResults.size());
+    EXPECT_EQ(valuations.size(), valuationWatches.size());
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        double expected = sequentialChecker.check(env, valuations[i])->asExplicitQuantitativeCheckResult<double>()[initialState];
+        double actual = batchResults[i]->asExplicitQuantitativeCheckResult<double>()[initialState];
+        EXPECT_NEAR(expected, actual, 1e-4 * std::max(1.0, expected)) << "for valuation " << i;
+    }
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, BatchProbability) {
+    checkBatchAgainstSequential("P=? [F s=7&d=2]");
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, BatchReward) {
+    checkBatchAgainstSequential("R{\"coin_flips\"}=? [F s=7]");
+}
+
+}  // namespace
@@ -1,6 +1,8 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <sstream>
+
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -16,6 +18,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm-parsers/api/model_descriptions.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 namespace {
@@ -29,6 +32,73 @@ storm::jani::Model getJaniModelFromPrism(std::string const& pathInTestResourcesD
     return m;
 }
 
+/*!
+ * Creates a model in which the i-th and the (n+i)-th variable always have the same value. As these variables are declared far apart,
+ * the order of declaration yields DDs that are exponentially larger than those for an order that places them next to each other.
+ */
+storm::jani::Model getPairedFlipsJaniModel(uint64_t numberOfPairs) {
+    std::stringstream stream;
+    stream << "dtmc\n\nmodule flips\n";
+    for (std::string prefix : {"a", "b"}) {
+        for (uint64_t i = 0; i < numberOfPairs; ++i) {
+            stream << "    " << prefix << i << " : bool init false;\n";
+        }
+    }
+    for (uint64_t i = 0; i < numberOfPairs; ++i) {
+        stream << "    [] true -> 0.5 : (a" << i << "'=!a" << i << ") & (b" << i << "'=!b" << i << ") + 0.5 : true;\n";
+    }
+    stream << "endmodule\n";
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parseFromString(stream.str(), "flips");
+    return modelDescription.toJani(true).preprocess().asJaniModel();
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, ForceVariableOrdering) {
+    auto janiModel = getJaniModelFromPrism("dtmc/crowds-5-5.pm");
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+    options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = builder.build(janiModel, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+
+    janiModel = getJaniModelFromPrism("mdp/coin2-2.nm");
+    model = builder.build(janiModel, options);
+    EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+    EXPECT_EQ(272ul, mdp->getNumberOfStates());
+    EXPECT_EQ(492ul, mdp->getNumberOfTransitions());
+    EXPECT_EQ(400ul, mdp->getNumberOfChoices());
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, ForceVariableOrderingNodeCount) {
+    auto janiModel = getPairedFlipsJaniModel(8);
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+    options.variableOrdering = storm::builder::DdVariableOrdering::Declaration;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> declarationModel = builder.build(janiModel, options);
+    options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> forceModel = builder.build(janiModel, options);
+
+    EXPECT_EQ(256ul, declarationModel->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions());
+    EXPECT_LT(4 * forceModel->getReachableStates().getNodeCount(), declarationModel->getReachableStates().getNodeCount());
+    EXPECT_LT(forceModel->getTransitionMatrix().getNodeCount(), declarationModel->getTransitionMatrix().getNodeCount());
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, ForceVariableOrderingAutomatonOutsideOfComposition) {
+    // The second automaton does not appear in the composition, so its location variable is not part of the model.
+    auto janiModel = getJaniModelFromPrism("mdp/two_dice.nm");
+    ASSERT_EQ(2ul, janiModel.getNumberOfAutomata());
+    janiModel.setSystemComposition(std::make_shared<storm::jani::AutomatonComposition>(janiModel.getAutomaton(0).getName()));
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+    for (auto ordering : {storm::builder::DdVariableOrdering::Declaration, storm::builder::DdVariableOrdering::Force}) {
+        options.variableOrdering = ordering;
+        STORM_SILENT_EXPECT_THROW(builder.build(janiModel, options), storm::exceptions::InvalidArgumentException);
+    }
+}
+
 TEST(DdJaniModelBuilderTest_Sylvan, Dtmc) {
     auto janiModel = getJaniModelFromPrism("dtmc/die.pm");
     storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
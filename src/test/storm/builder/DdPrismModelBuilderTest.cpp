@@ -1,7 +1,11 @@
 #include "storm-config.h"
+
+#include <sstream>
+
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/modelchecker/helper/utility/CachedTransitionMatrix.h"
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -9,9 +13,90 @@
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/Odd.h"
 #include "test/storm_gtest.h"
 
+namespace {
+/*!
+ * Creates a program in which the i-th and the (n+i)-th variable always have the same value. As these variables are declared far apart,
+ * the order of declaration yields DDs that are exponentially larger than those for an order that places them next to each other.
+ */
+storm::prism::Program createPairedFlipsProgram(uint64_t numberOfPairs) {
+    std::stringstream stream;
+    stream << "dtmc\n\nmodule flips\n";
+    for (std::string prefix : {"a", "b"}) {
+        for (uint64_t i = 0; i < numberOfPairs; ++i) {
+            stream << "    " << prefix << i << " : bool init false;\n";
+        }
+    }
+    for (uint64_t i = 0; i < numberOfPairs; ++i) {
+        stream << "    [] true -> 0.5 : (a" << i << "'=!a" << i << ") & (b" << i << "'=!b" << i << ") + 0.5 : true;\n";
+    }
+    stream << "endmodule\n";
+    return storm::parser::PrismParser::parseFromString(stream.str(), "flips");
+}
+
+template<storm::dd::DdType DdType>
+void checkForceVariableOrderingNodeCount() {
+    storm::prism::Program program = createPairedFlipsProgram(8);
+    typename storm::builder::DdPrismModelBuilder<DdType>::Options options;
+    options.variableOrdering = storm::builder::DdVariableOrdering::Declaration;
+    std::shared_ptr<storm::models::symbolic::Model<DdType>> declarationModel = storm::builder::DdPrismModelBuilder<DdType>().build(program, options);
+    options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+    std::shared_ptr<storm::models::symbolic::Model<DdType>> forceModel = storm::builder::DdPrismModelBuilder<DdType>().build(program, options);
+
+    EXPECT_EQ(256ul, declarationModel->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions());
+    EXPECT_LT(4 * forceModel->getReachableStates().getNodeCount(), declarationModel->getReachableStates().getNodeCount());
+    EXPECT_LT(forceModel->getTransitionMatrix().getNodeCount(), declarationModel->getTransitionMatrix().getNodeCount());
+}
+
+template<storm::dd::DdType DdType>
+void checkExplicitTransitionMatrixCache(std::string const& path) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(path);
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<DdType>> model = storm::builder::DdPrismModelBuilder<DdType>().build(program);
+    std::shared_ptr<storm::models::symbolic::Model<DdType> const> constModel = model;
+    storm::dd::Odd const& odd = constModel->getReachableStatesOdd();
+    EXPECT_EQ(&odd, &constModel->getReachableStatesOdd());
+
+    auto toMatrix = [&](storm::dd::Add<DdType, double> const& matrix) {
+        if (constModel->getNondeterminismVariables().empty()) {
+            return matrix.toMatrix(odd, odd);
+        } else {
+            return matrix.toMatrix(constModel->getNondeterminismVariables(), odd, odd);
+        }
+    };
+
+    // The matrix is converted once and then reused.
+    storm::storage::SparseMatrix<double> const& explicitMatrix = constModel->getExplicitTransitionMatrix();
+    EXPECT_EQ(&explicitMatrix, &constModel->getExplicitTransitionMatrix());
+    EXPECT_EQ(model->getNumberOfStates(), explicitMatrix.getRowGroupCount());
+    EXPECT_EQ(model->getNumberOfTransitions(), explicitMatrix.getEntryCount());
+    EXPECT_TRUE(toMatrix(constModel->getTransitionMatrix()) == explicitMatrix);
+
+    // Modifying the symbolic matrix invalidates the cache.
+    storm::storage::SparseMatrix<double> originalMatrix = explicitMatrix;
+    model->getTransitionMatrix() *= model->getManager().getConstant(0.5);
+    storm::storage::SparseMatrix<double> const& modifiedMatrix = constModel->getExplicitTransitionMatrix();
+    EXPECT_TRUE(toMatrix(constModel->getTransitionMatrix()) == modifiedMatrix);
+    EXPECT_FALSE(originalMatrix == modifiedMatrix);
+
+    // The cache is only used by the hybrid engine if it is not disabled.
+    EXPECT_TRUE(storm::modelchecker::helper::usesCachedTransitionMatrix(*constModel, constModel->getTransitionMatrix()));
+    std::unique_ptr<storm::settings::SettingMemento> noCache =
+        dynamic_cast<storm::settings::modules::ModelCheckerSettings&>(
+            storm::settings::mutableManager().getModule(storm::settings::modules::ModelCheckerSettings::moduleName))
+            .overrideNoExplicitMatrixCacheSet(true);
+    EXPECT_FALSE(storm::modelchecker::helper::usesCachedTransitionMatrix(*constModel, constModel->getTransitionMatrix()));
+}
+}  // namespace
+
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
@@ -46,6 +131,35 @@ TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     EXPECT_EQ(2505ul, model->getNumberOfTransitions());
 }
 
+TEST(DdPrismModelBuilderTest_Sylvan, ForceVariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+    EXPECT_EQ(272ul, mdp->getNumberOfStates());
+    EXPECT_EQ(492ul, mdp->getNumberOfTransitions());
+    EXPECT_EQ(400ul, mdp->getNumberOfChoices());
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ForceVariableOrderingNodeCount) {
+    checkForceVariableOrderingNodeCount<storm::dd::DdType::Sylvan>();
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ForceVariableOrderingNodeCount) {
+    checkForceVariableOrderingNodeCount<storm::dd::DdType::CUDD>();
+}
+
 TEST(DdPrismModelBuilderTest_Cudd, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
@@ -357,3 +471,13 @@ TEST(UnboundedTest_Cudd, Mdp) {
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
     EXPECT_FALSE(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().canHandle(program));
 }
+
+TEST(DdPrismModelBuilderTest_Sylvan, ExplicitTransitionMatrixCache) {
+    checkExplicitTransitionMatrixCache<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    checkExplicitTransitionMatrixCache<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ExplicitTransitionMatrixCache) {
+    checkExplicitTransitionMatrixCache<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    checkExplicitTransitionMatrixCache<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+}
@@ -0,0 +1,110 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "storm/generator/Distribution.h"
+#include "storm/storage/BitVector.h"
+
+namespace {
+
+template<typename IndexType>
+std::map<IndexType, double> toMap(storm::generator::Distribution<IndexType, double> const& distribution) {
+    std::map<IndexType, double> result;
+    for (auto const& entry : distribution) {
+        EXPECT_TRUE(result.emplace(entry.getState(), entry.getValue()).second) << "Duplicate entry for index " << entry.getState() << ".";
+    }
+    return result;
+}
+
+TEST(DistributionTest, MergeDuplicates) {
+    storm::generator::Distribution<uint32_t, double> distribution;
+    distribution.add(3, 0.25);
+    distribution.add(1, 0.25);
+    distribution.add(3, 0.125);
+    distribution.add(storm::generator::DistributionEntry<uint32_t, double>(1, 0.375));
+
+    std::map<uint32_t, double> expected = {{1, 0.625}, {3, 0.375}};
+    EXPECT_EQ(expected, toMap(distribution));
+
+    storm::generator::Distribution<uint32_t, double> other;
+    other.add(3, 0.5);
+    other.add(7, 0.5);
+    distribution.add(std::move(other));
+    expected = {{1, 0.625}, {3, 0.875}, {7, 0.5}};
+    EXPECT_EQ(expected, toMap(distribution));
+    EXPECT_EQ(other.begin(), other.end());
+}
+
+TEST(DistributionTest, GrowBeyondInitialSlots) {
+    // Enough distinct indices to grow the hash table several times. Each index is added twice, once before and once after the growth.
+    uint32_t const numberOfIndices = 100;
+    storm::generator::Distribution<uint32_t, double> distribution;
+    std::map<uint32_t, double> expected;
+    for (uint32_t index = 0; index < numberOfIndices; ++index) {
+        uint32_t scrambledIndex = (index * 37) % numberOfIndices;
+        distribution.add(scrambledIndex, 1.0);
+        expected[scrambledIndex] += 1.0;
+    }
+    for (uint32_t index = 0; index < numberOfIndices; index += 3) {
+        distribution.add(index, 0.5);
+        expected[index] += 0.5;
+    }
+    EXPECT_EQ(expected, toMap(distribution));
+
+    // The distribution can be reused after clearing it.
+    distribution.clear();
+    EXPECT_EQ(distribution.begin(), distribution.end());
+    distribution.add(5, 1.0);
+    distribution.add(5, 1.0);
+    expected = {{5, 2.0}};
+    EXPECT_EQ(expected, toMap(distribution));
+}
+
+TEST(DistributionTest, CompressAfterMerge) {
+    storm::generator::Distribution<uint32_t, double> distribution;
+    std::vector<uint32_t> indices = {40, 2, 17, 2, 99, 40, 0, 17, 63, 5, 40, 21, 8, 33, 12, 71, 2, 44, 90, 3};
+    std::map<uint32_t, double> expected;
+    for (auto index : indices) {
+        distribution.add(index, 0.5);
+        expected[index] += 0.5;
+    }
+    distribution.compress();
+
+    // After compressing, the entries are sorted and merged.
+    typedef std::vector<std::pair<uint32_t, double>> EntryVector;
+    EntryVector entries;
+    for (auto const& entry : distribution) {
+        entries.emplace_back(entry.getState(), entry.getValue());
+    }
+    EXPECT_EQ(EntryVector(expected.begin(), expected.end()), entries);
+
+    // Entries added after compressing are still merged with the existing ones.
+    distribution.add(17, 1.0);
+    distribution.add(1, 1.0);
+    expected[17] += 1.0;
+    expected[1] += 1.0;
+    EXPECT_EQ(expected, toMap(distribution));
+    distribution.compress();
+    entries.clear();
+    for (auto const& entry : distribution) {
+        entries.emplace_back(entry.getState(), entry.getValue());
+    }
+    EXPECT_EQ(EntryVector(expected.begin(), expected.end()), entries);
+}
+
+TEST(DistributionTest, BitVectorIndices) {
+    storm::generator::Distribution<storm::storage::BitVector, double> distribution;
+    std::map<storm::storage::BitVector, double> expected;
+    for (uint64_t index = 0; index < 40; ++index) {
+        storm::storage::BitVector state(64);
+        state.setFromInt(0, 64, index % 20);
+        distribution.add(state, 0.25);
+        expected[state] += 0.25;
+    }
+    distribution.compress();
+    EXPECT_EQ(expected, toMap(distribution));
+}
+
+}  // namespace
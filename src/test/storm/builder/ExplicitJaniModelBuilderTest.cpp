@@ -200,4 +200,41 @@ TEST(ExplicitJaniModelBuilderTest, enumerateInitial) {
     EXPECT_EQ(145ul, model->getNumberOfTransitions());
     EXPECT_EQ(72ul, model->getInitialStates().getNumberOfSetBits());
 }
+
+TEST(ExplicitJaniModelBuilderTest, LabelingTransientAndStateLabels) {
+    std::string const programString =
+        "dtmc\n"
+        "module grid\n"
+        "  x : [0..199] init 0;\n"
+        "  y : [0..99] init 0;\n"
+        "  [] x<199 -> 0.5 : (x'=x+1) + 0.5 : (y'=mod(y+1, 100));\n"
+        "  [] x=199 -> 1 : (x'=0);\n"
+        "endmodule\n"
+        "label \"diagonal\" = x=y;\n"
+        "label \"pattern\" = mod(x+2*y, 7)=3 & !(x>150 | y<3);\n";
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parseFromString(programString, "grid.pm");
+    storm::jani::Model janiModel = modelDescription.toJani().preprocess().asJaniModel();
+
+    // The labels of the PRISM program become transient variables, which are evaluated state by state. Expression labels only refer to state
+    // variables and are evaluated in batches.
+    storm::expressions::Variable x = janiModel.getManager().getVariable("x");
+    storm::expressions::Variable y = janiModel.getManager().getVariable("y");
+    storm::expressions::Expression xGreaterY = x.getExpression() > y.getExpression();
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels().setBuildStateValuations().addLabel(xGreaterY);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(janiModel, options).build();
+    ASSERT_EQ(20000ul, model->getNumberOfStates());
+
+    std::stringstream xGreaterYLabel;
+    xGreaterYLabel << xGreaterY;
+    auto const& valuations = model->getStateValuations();
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        int64_t xValue = valuations.getIntegerValue(state, x);
+        int64_t yValue = valuations.getIntegerValue(state, y);
+        EXPECT_EQ(xValue == yValue, model->getStateLabeling().getStateHasLabel("diagonal", state)) << "in state " << state;
+        EXPECT_EQ((xValue + 2 * yValue) % 7 == 3 && !(xValue > 150 || yValue < 3), model->getStateLabeling().getStateHasLabel("pattern", state))
+            << "in state " << state;
+        EXPECT_EQ(xValue > yValue, model->getStateLabeling().getStateHasLabel(xGreaterYLabel.str(), state)) << "in state " << state;
+    }
+}
 }  // namespace
@@ -225,3 +225,33 @@ TEST(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitPrismModelBuilderTest, LabelingInBatches) {
+    // The model has more states than are labeled in a single batch.
+    std::string const programString =
+        "dtmc\n"
+        "module grid\n"
+        "  x : [0..199] init 0;\n"
+        "  y : [0..99] init 0;\n"
+        "  [] x<199 -> 0.5 : (x'=x+1) + 0.5 : (y'=mod(y+1, 100));\n"
+        "  [] x=199 -> 1 : (x'=0);\n"
+        "endmodule\n"
+        "label \"diagonal\" = x=y;\n"
+        "label \"pattern\" = mod(x+2*y, 7)=3 & !(x>150 | y<3);\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "grid.pm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels().setBuildStateValuations();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    ASSERT_EQ(20000ul, model->getNumberOfStates());
+
+    storm::expressions::Variable x = program.getManager().getVariable("x");
+    storm::expressions::Variable y = program.getManager().getVariable("y");
+    auto const& valuations = model->getStateValuations();
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        int64_t xValue = valuations.getIntegerValue(state, x);
+        int64_t yValue = valuations.getIntegerValue(state, y);
+        EXPECT_EQ(xValue == yValue, model->getStateLabeling().getStateHasLabel("diagonal", state)) << "in state " << state;
+        EXPECT_EQ((xValue + 2 * yValue) % 7 == 3 && !(xValue > 150 || yValue < 3), model->getStateLabeling().getStateHasLabel("pattern", state))
+            << "in state " << state;
+    }
+}
@@ -10,12 +10,14 @@
 #include "storm/api/properties.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -408,4 +410,32 @@ TYPED_TEST(MarkovAutomatonCslModelCheckerTest, HOASimple) {
         EXPECT_FALSE(checker->canHandle(tasks[0]));
     }
 }
+
+TEST(MarkovAutomatonCslModelCheckerTest, UnifPlusMultipleTimeBounds) {
+    std::string formulasString = "Pmax=? [F<=0.5 s=3]";
+    formulasString += "; Pmax=? [F<=1.3 s=3]";
+    formulasString += "; Pmax=? [F<=3 s=3]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::MarkovAutomaton<double>>();
+
+    storm::Environment env;
+    env.solver().timeBounded().setMaMethod(storm::solver::MaBoundedReachabilityMethod::UnifPlus);
+    storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(*model);
+    auto const& boundedUntilFormula = formulas[0]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+    storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, double> task(boundedUntilFormula);
+    task.setOptimizationDirection(storm::OptimizationDirection::Maximize);
+    auto results = checker.computeMultipleBoundedUntilProbabilities(env, task, {0.5, 1.3, 3});
+    ASSERT_EQ(3ul, results.size());
+    for (uint64_t i = 0; i < formulas.size(); ++i) {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[i]));
+        auto const& expected = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& actual = results[i]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expected.size(), actual.size());
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], actual[state], 1e-5) << "for time bound " << i << " and state " << state;
+        }
+    }
+    EXPECT_NEAR(0.727468207, results[1]->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-5);
+}
 }  // namespace
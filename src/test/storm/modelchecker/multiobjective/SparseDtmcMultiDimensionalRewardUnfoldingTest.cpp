@@ -6,8 +6,10 @@
 #include "storm/environment/Environment.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/utility/constants.h"
 
@@ -101,20 +103,29 @@ TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
         storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalNumber>>();
     uint_fast64_t const initState = *dtmc->getInitialStates().begin();
     ;
-    std::unique_ptr<storm::modelchecker::CheckResult> result;
-
-    result = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formulas[0], true));
-    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
-    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("78686542099694893/1268858272000000000")),
-              result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
-
-    result = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formulas[1], true));
-    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
-    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("13433618626105041/1268858272000000000")),
-              result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 
-    result = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formulas[2], true));
-    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
-    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")),
-              result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+    // Analyzing independent epochs concurrently yields the same results.
+    for (bool parallelEpochs : {false, true}) {
+        SCOPED_TRACE(parallelEpochs ? "parallel epochs" : "sequential epochs");
+        std::unique_ptr<storm::settings::SettingMemento> parallelEpochsMemento =
+            dynamic_cast<storm::settings::modules::ModelCheckerSettings&>(
+                storm::settings::mutableManager().getModule(storm::settings::modules::ModelCheckerSettings::moduleName))
+                .overrideParallelEpochsSet(parallelEpochs);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+        result = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formulas[0], true));
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("78686542099694893/1268858272000000000")),
+                  result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+
+        result = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formulas[1], true));
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("13433618626105041/1268858272000000000")),
+                  result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+
+        result = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formulas[2], true));
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")),
+                  result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+    }
 }
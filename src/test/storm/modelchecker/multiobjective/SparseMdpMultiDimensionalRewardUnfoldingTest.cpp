@@ -10,8 +10,10 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/utility/constants.h"
 
@@ -285,6 +287,49 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_lower_bounds) {
     EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_parallel_epochs) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ F{\"r\"}<=5,{\"l\"}<=3 x=N ] ";
+    formulasAsString += "; \n Pmax=? [ F{\"r\"}<=6,{\"l\"}<=2 x=N ] ";
+    formulasAsString += "; \n Pmin=? [ F{\"r\"}<=8,{\"l\"}<=4 x=N ] ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalNumber>> mdp =
+        storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    std::vector<storm::RationalNumber> sequentialResults;
+    for (auto const& formula : formulas) {
+        auto result = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<storm::RationalNumber>(formula, true));
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        sequentialResults.push_back(result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+    }
+
+    std::unique_ptr<storm::settings::SettingMemento> parallelEpochs =
+        dynamic_cast<storm::settings::modules::ModelCheckerSettings&>(
+            storm::settings::mutableManager().getModule(storm::settings::modules::ModelCheckerSettings::moduleName))
+            .overrideParallelEpochsSet(true);
+    std::vector<storm::RationalNumber> parallelResults;
+    for (auto const& formula : formulas) {
+        auto result = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<storm::RationalNumber>(formula, true));
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        parallelResults.push_back(result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+    }
+    EXPECT_EQ(sequentialResults, parallelResults);
+
+    // Moving left never helps, so only the bound on the right steps matters for the maximal probabilities.
+    storm::RationalNumber expectedResult = storm::utility::pow(storm::utility::convertNumber<storm::RationalNumber>(0.5), 5);
+    EXPECT_EQ(expectedResult, parallelResults[0]);
+    expectedResult = storm::utility::convertNumber<storm::RationalNumber, std::string>("7/64");
+    EXPECT_EQ(expectedResult, parallelResults[1]);
+    EXPECT_EQ(storm::utility::zero<storm::RationalNumber>(), parallelResults[2]);
+}
+
 #ifdef STORM_HAVE_Z3_OPTIMIZE
 
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, one_dim_walk_small) {
@@ -490,4 +490,46 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, resource_gathering) {
     }
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, batchSize) {
+    if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
+        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
+    }
+    storm::Environment env;
+    env.modelchecker().multi().setMethod(storm::modelchecker::multiobjective::MultiObjectiveMethod::Pcaa);
+    storm::Environment batchEnv = env;
+    batchEnv.modelchecker().multi().setBatchSize(3);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_simple_lra.nm";
+    std::string formulasAsString = "multi(R{\"first\"}max=? [ LRA ], R{\"second\"}max=? [ LRA ]);\n";
+    formulasAsString += "multi(R{\"first\"}min=? [ LRA ], R{\"second\"}max=? [ LRA ]);\n";
+    formulasAsString += "multi(R{\"first\"}min=? [ C ], R{\"second\"}min=? [ LRA ]);\n";
+    formulasAsString += "multi(R{\"first\"}min=? [ C ], R{\"first\"}max=? [ LRA ]);\n";
+    formulasAsString += "multi(LRAmax=? [ x=1 ], R{\"second\"}max=? [ LRA ]);\n";
+    // With batch sizes greater than one, the total reward objectives (including reachability probabilities) are also solved concurrently.
+    formulasAsString += "multi(R{\"first\"}min=? [ C ], R{\"third\"}max=? [ C ], Pmax=? [ F x=3 ]);\n";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    storm::generator::NextStateGeneratorOptions options(formulas);
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+    // Performing several refinement steps at once yields the same pareto optimal points as performing them one after another.
+    double eps = 1e-4;
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result =
+            storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formula->asMultiObjectiveFormula());
+        std::unique_ptr<storm::modelchecker::CheckResult> batchResult =
+            storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(batchEnv, *mdp, formula->asMultiObjectiveFormula());
+        ASSERT_TRUE(result->isExplicitParetoCurveCheckResult());
+        ASSERT_TRUE(batchResult->isExplicitParetoCurveCheckResult());
+        auto const& points = result->asExplicitParetoCurveCheckResult<double>().getPoints();
+        auto const& batchPoints = batchResult->asExplicitParetoCurveCheckResult<double>().getPoints();
+        EXPECT_TRUE(expectSubset(batchPoints, points, eps)) << "Non-Pareto point found for " << *formula << ".";
+        EXPECT_TRUE(expectSubset(points, batchPoints, eps)) << "Pareto point missing for " << *formula << ".";
+    }
+}
+
 #endif /* STORM_HAVE_Z3_OPTIMIZE */
@@ -4,6 +4,8 @@
 
 #include "storm-config.h"
 
+#include <sstream>
+
 #include "storm-conv/api/storm-conv.h"
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm-parsers/api/properties.h"
@@ -21,9 +23,14 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/PrismParser.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/task_arena.h"
+#endif
+
 namespace {
 
 class SparseValueTypeValueIterationEnvironment {
@@ -483,4 +490,54 @@ TYPED_TEST(LraMdpPrctlModelCheckerTest, cs_nfail) {
     EXPECT_NEAR(this->parseNumber("0"), result[*mdp->getInitialStates().begin()], this->precision());
 }
 
-}  // namespace
\ No newline at end of file
+TYPED_TEST(LraMdpPrctlModelCheckerTest, ManyMecsConcurrently) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    // From the initial state, one of 16 cycles of different lengths is chosen. Each cycle forms a MEC in which staying at x=0 is optional.
+    uint64_t const numberOfCycles = 16;
+    std::stringstream programStream;
+    programStream << "mdp\n\nmodule cycles\n    c : [0.." << numberOfCycles << "] init 0;\n    x : [0.." << numberOfCycles << "] init 0;\n";
+    for (uint64_t cycle = 1; cycle <= numberOfCycles; ++cycle) {
+        programStream << "    [] c=0 -> (c'=" << cycle << ");\n";
+        programStream << "    [] c=" << cycle << " -> (x'=mod(x+1, " << (cycle + 1) << "));\n";
+        programStream << "    [] c=" << cycle << " & x=0 -> (x'=0);\n";
+    }
+    programStream << "endmodule\n\nlabel \"zero\" = c>0 & x=0;\nlabel \"first\" = c=1 & x=0;\nlabel \"last\" = c=" << numberOfCycles << " & x=0;\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programStream.str(), "LraMdpPrctlModelCheckerTest");
+    auto model = storm::api::buildSparseModel<ValueType>(program, storm::builder::BuilderOptions(true, true));
+    auto mdp = model->template as<storm::models::sparse::Mdp<ValueType>>();
+    EXPECT_EQ(153ul, mdp->getNumberOfStates());
+    uint64_t initialState = *mdp->getInitialStates().begin();
+    uint64_t firstState = *mdp->getStates("first").begin();
+    uint64_t lastState = *mdp->getStates("last").begin();
+
+    storm::parser::FormulaParser formulaParser;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> checker(*mdp);
+    for (auto const& formulaString : {"LRAmin=? [\"zero\"]", "LRAmax=? [\"zero\"]"}) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        auto check = [&]() { return checker.check(this->env(), *formula)->template asExplicitQuantitativeCheckResult<ValueType>().getValueVector(); };
+#ifdef STORM_HAVE_INTELTBB
+        tbb::task_arena arena(1);
+        std::vector<ValueType> sequentialResult = arena.execute(check);
+#else
+        std::vector<ValueType> sequentialResult = check();
+#endif
+        std::vector<ValueType> concurrentResult = check();
+        ASSERT_EQ(sequentialResult.size(), concurrentResult.size());
+        for (uint64_t state = 0; state < sequentialResult.size(); ++state) {
+            EXPECT_NEAR(sequentialResult[state], concurrentResult[state], this->precision()) << "Different results for state " << state << ".";
+        }
+
+        if (formula->asOperatorFormula().getOptimalityType() == storm::solver::OptimizationDirection::Minimize) {
+            EXPECT_NEAR(this->parseNumber("1/17"), concurrentResult[initialState], this->precision());
+            EXPECT_NEAR(this->parseNumber("1/2"), concurrentResult[firstState], this->precision());
+            EXPECT_NEAR(this->parseNumber("1/17"), concurrentResult[lastState], this->precision());
+        } else {
+            EXPECT_NEAR(this->parseNumber("1"), concurrentResult[initialState], this->precision());
+            EXPECT_NEAR(this->parseNumber("1"), concurrentResult[firstState], this->precision());
+            EXPECT_NEAR(this->parseNumber("1"), concurrentResult[lastState], this->precision());
+        }
+    }
+}
+
+}  // namespace
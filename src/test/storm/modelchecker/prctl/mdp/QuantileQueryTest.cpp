@@ -8,6 +8,9 @@
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
 #include "storm/parser/CSVParser.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
@@ -302,4 +305,25 @@ TYPED_TEST(QuantileQueryTest, resources) {
     compare = this->compareResult(model, result, expectedResult);
     EXPECT_TRUE(compare.first) << compare.second;
 }
+
+TYPED_TEST(QuantileQueryTest, resources_parallel_epochs) {
+    typedef storm::models::sparse::Mdp<typename TestFixture::ValueType> ModelType;
+
+    std::unique_ptr<storm::settings::SettingMemento> parallelEpochs =
+        dynamic_cast<storm::settings::modules::ModelCheckerSettings&>(
+            storm::settings::mutableManager().getModule(storm::settings::modules::ModelCheckerSettings::moduleName))
+            .overrideParallelEpochsSet(true);
+
+    std::string formulasString = "quantile(max GOLD, max GEM, Pmax>0.95 [F{\"gold\"}>=GOLD,{\"gem\"}>=GEM,{\"steps\"}<=100 true]);\n";
+
+    auto modelFormulas = this->template buildModelFormulas<ModelType>(STORM_TEST_RESOURCES_DIR "/mdp/quantiles_resources.nm", formulasString);
+    auto model = std::move(modelFormulas.first);
+    auto tasks = this->getTasks(modelFormulas.second);
+    auto checker = this->template createModelChecker<ModelType>(model);
+
+    std::vector<std::string> expectedResult = {"0, 10", "1, 9", "4, 8", "7, 7", "8, 4", "9, 2", "10, 0"};
+    auto result = checker->check(this->env(), tasks[0]);
+    auto compare = this->compareResult(model, result, expectedResult);
+    EXPECT_TRUE(compare.first) << compare.second;
+}
 }  // namespace
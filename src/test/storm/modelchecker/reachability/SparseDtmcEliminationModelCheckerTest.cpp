@@ -10,6 +10,7 @@
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
 TEST(SparseDtmcEliminationModelCheckerTest, Die) {
@@ -109,6 +110,31 @@ TEST(SparseDtmcEliminationModelCheckerTest, Crowds) {
     EXPECT_NEAR(0.96592521978041668, quantitativeResult5[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(SparseDtmcEliminationModelCheckerTest, CrowdsParallel) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    std::unique_ptr<storm::settings::SettingMemento> parallelElimination =
+        dynamic_cast<storm::settings::modules::EliminationSettings&>(
+            storm::settings::mutableManager().getModule(storm::settings::modules::EliminationSettings::moduleName))
+            .overrideParallelEliminationSet(true);
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formula);
+    EXPECT_NEAR(0.3328800375801578281, result->asExplicitQuantitativeCheckResult<double>()[0],
+                storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observeOnlyTrueSender\"]");
+    result = checker.check(storm::modelchecker::CheckTask<storm::logic::Formula>(*formula).setOnlyInitialStatesRelevant(true));
+    EXPECT_NEAR(0.32153724292835045, result->asExplicitQuantitativeCheckResult<double>()[0],
+                storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
+
 TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
         storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/leader4_8.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4_8.lab", "",
@@ -6,6 +6,7 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
 
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
@@ -23,6 +24,42 @@ TEST(DirectEncodingParserTest, DtmcParsing) {
     ASSERT_EQ(1260ul, modelPtr->getStates("observe0Greater1").getNumberOfSetBits());
 }
 
+TEST(DirectEncodingParserTest, DtmcParsingValues) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> exactModelPtr =
+        storm::parser::DirectEncodingParser<storm::RationalNumber>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+
+    // Values are parsed exactly.
+    ASSERT_EQ(8607ul, exactModelPtr->getNumberOfStates());
+    ASSERT_EQ(15113ul, exactModelPtr->getNumberOfTransitions());
+    auto row = modelPtr->getTransitionMatrix().getRow(1);
+    auto exactRow = exactModelPtr->getTransitionMatrix().getRow(1);
+    ASSERT_EQ(2ul, row.getNumberOfEntries());
+    ASSERT_EQ(2ul, exactRow.getNumberOfEntries());
+    EXPECT_EQ(3ul, row.begin()[1].getColumn());
+    EXPECT_EQ(0.833, row.begin()[0].getValue());
+    EXPECT_EQ(0.167, row.begin()[1].getValue());
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("833/1000")), exactRow.begin()[0].getValue());
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("167/1000")), exactRow.begin()[1].getValue());
+    EXPECT_EQ(4650ul, exactModelPtr->getStates("observeIGreater1").getNumberOfSetBits());
+}
+
+TEST(DirectEncodingParserTest, DtmcParsingInChunks) {
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> modelPtr =
+        storm::parser::DirectEncodingParser<storm::RationalNumber>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+
+    // Tiny chunks force the boundaries between chunks into the middle of state blocks.
+    storm::parser::DirectEncodingParserOptions options;
+    options.minimalChunkSize = 64;
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> chunkedModelPtr =
+        storm::parser::DirectEncodingParser<storm::RationalNumber>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", options);
+
+    ASSERT_EQ(8607ul, chunkedModelPtr->getNumberOfStates());
+    EXPECT_TRUE(modelPtr->getTransitionMatrix() == chunkedModelPtr->getTransitionMatrix());
+    EXPECT_TRUE(modelPtr->getStateLabeling() == chunkedModelPtr->getStateLabeling());
+}
+
 TEST(DirectEncodingParserTest, MdpParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
         storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
@@ -45,6 +82,26 @@ TEST(DirectEncodingParserTest, MdpParsing) {
     ASSERT_TRUE(!modelPtr->getRewardModel("coinflips").isAllZero());
 }
 
+TEST(DirectEncodingParserTest, MdpParsingInChunks) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+
+    // Tiny chunks force the boundaries between chunks into the middle of state blocks.
+    options.minimalChunkSize = 16;
+    std::shared_ptr<storm::models::sparse::Model<double>> chunkedModelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+
+    ASSERT_EQ(169ul, chunkedModelPtr->getNumberOfStates());
+    ASSERT_EQ(254ul, chunkedModelPtr->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    EXPECT_TRUE(modelPtr->getTransitionMatrix() == chunkedModelPtr->getTransitionMatrix());
+    EXPECT_TRUE(modelPtr->getStateLabeling() == chunkedModelPtr->getStateLabeling());
+    EXPECT_TRUE(modelPtr->getChoiceLabeling() == chunkedModelPtr->getChoiceLabeling());
+    EXPECT_EQ(modelPtr->getRewardModel("coinflips").getStateActionRewardVector(),
+              chunkedModelPtr->getRewardModel("coinflips").getStateActionRewardVector());
+}
+
 TEST(DirectEncodingParserTest, CtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
         storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
@@ -0,0 +1,57 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+
+namespace {
+
+TEST(DynamicStatePriorityQueueTest, PopOrderWithUpdates) {
+    uint64_t const numberOfStates = 100;
+    storm::storage::FlexibleSparseMatrix<double> matrix(numberOfStates);
+    std::vector<double> oneStepProbabilities(numberOfStates, 0.0);
+
+    // Penalties that are changed from outside of the queue.
+    std::vector<uint_fast64_t> penalties(numberOfStates);
+    std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        penalties[state] = (state * 37) % 11;
+        statePenalties.emplace_back(state, penalties[state]);
+    }
+    std::sort(statePenalties.begin(), statePenalties.end(),
+              [](std::pair<storm::storage::sparse::state_type, uint_fast64_t> const& a,
+                 std::pair<storm::storage::sparse::state_type, uint_fast64_t> const& b) { return a.second < b.second; });
+
+    auto penaltyFunction = [&penalties](storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const&,
+                                        storm::storage::FlexibleSparseMatrix<double> const&, std::vector<double> const&) { return penalties[state]; };
+    storm::solver::stateelimination::DynamicStatePriorityQueue<double> queue(statePenalties, matrix, matrix, oneStepProbabilities, penaltyFunction);
+    EXPECT_EQ(numberOfStates, queue.size());
+
+    std::vector<bool> popped(numberOfStates, false);
+    uint64_t round = 0;
+    while (queue.hasNext()) {
+        storm::storage::sparse::state_type state = queue.pop();
+        ASSERT_FALSE(popped[state]);
+        // The popped state has minimal penalty and minimal index among the states with that penalty.
+        for (uint64_t other = 0; other < numberOfStates; ++other) {
+            if (!popped[other] && other != state) {
+                EXPECT_TRUE(penalties[state] < penalties[other] || (penalties[state] == penalties[other] && state < other));
+            }
+        }
+        popped[state] = true;
+
+        // Change the penalties of some of the remaining states (and of the popped one, which must be ignored).
+        for (uint64_t other = round % 3; other < numberOfStates; other += 3) {
+            penalties[other] = (penalties[other] * 7 + round) % 13;
+            queue.update(other);
+        }
+        ++round;
+    }
+    EXPECT_EQ(numberOfStates, round);
+    EXPECT_EQ(0ull, queue.size());
+}
+
+}  // namespace
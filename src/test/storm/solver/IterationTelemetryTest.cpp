@@ -0,0 +1,107 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/solver/BinaryTraceWriter.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    return builder.build(2);
+}
+
+std::vector<storm::solver::IterationRecord> solveWithTelemetry(storm::solver::MinMaxMethod method, storm::OptimizationDirection dir, double& result) {
+    storm::Environment env;
+    env.solver().minMax().setMethod(method);
+    env.solver().setForceSoundness(method != storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    std::vector<storm::solver::IterationRecord> records;
+    env.solver().setIterationTelemetryCallback([&records](storm::solver::IterationRecord const& record) { records.push_back(record); });
+
+    auto A = createMatrix();
+    std::vector<double> x(1);
+    std::vector<double> b = {0.099, 0.5};
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(0.0, 2.0);
+    solver->setRequirementsChecked();
+    solver->solveEquations(env, dir, x, b);
+    result = x[0];
+    return records;
+}
+
+TEST(IterationTelemetryTest, ValueIteration) {
+    double result;
+    auto records = solveWithTelemetry(storm::solver::MinMaxMethod::ValueIteration, storm::OptimizationDirection::Maximize, result);
+    EXPECT_NEAR(0.99, result, 1e-5);
+    ASSERT_FALSE(records.empty());
+    for (uint64_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(storm::solver::IterationMethod::ValueIteration, records[i].method);
+        EXPECT_EQ(i + 1, records[i].iteration);
+        ASSERT_TRUE(records[i].residual.has_value());
+        ASSERT_TRUE(records[i].changedChoices.has_value());
+        EXPECT_FALSE(records[i].boundGap.has_value());
+    }
+    // The first iteration selects a choice for the (only) state. Eventually, the choice to stay in the state remains optimal.
+    EXPECT_EQ(1ull, records.front().changedChoices.value());
+    EXPECT_EQ(0ull, records.back().changedChoices.value());
+    EXPECT_LE(records.back().residual.value(), 1e-5);
+}
+
+TEST(IterationTelemetryTest, IntervalIteration) {
+    double result;
+    auto records = solveWithTelemetry(storm::solver::MinMaxMethod::IntervalIteration, storm::OptimizationDirection::Minimize, result);
+    EXPECT_NEAR(0.5, result, 1e-5);
+    ASSERT_FALSE(records.empty());
+    for (auto const& record : records) {
+        EXPECT_EQ(storm::solver::IterationMethod::IntervalIteration, record.method);
+        ASSERT_TRUE(record.boundGap.has_value());
+    }
+    EXPECT_LE(records.back().boundGap.value(), 1e-5);
+}
+
+TEST(IterationTelemetryTest, BinaryTrace) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_iteration_trace_test.bin").string();
+    std::vector<storm::solver::IterationRecord> records;
+    for (uint64_t i = 1; i <= 10000; ++i) {
+        storm::solver::IterationRecord record{storm::solver::IterationMethod::SoundValueIteration, i, {}, {}, {}, 100 * i};
+        if (i % 2 == 0) {
+            record.residual = 1.0 / i;
+        }
+        if (i % 3 == 0) {
+            record.boundGap = 2.0 / i;
+        }
+        if (i % 5 == 0) {
+            record.changedChoices = i / 5;
+        }
+        records.push_back(record);
+    }
+    {
+        auto callback = storm::solver::BinaryTraceWriter::createCallback(filename);
+        for (auto const& record : records) {
+            callback(record);
+        }
+    }
+    auto readRecords = storm::solver::BinaryTraceWriter::read(filename);
+    std::remove(filename.c_str());
+    ASSERT_EQ(records.size(), readRecords.size());
+    for (uint64_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].method, readRecords[i].method);
+        EXPECT_EQ(records[i].iteration, readRecords[i].iteration);
+        EXPECT_EQ(records[i].residual, readRecords[i].residual);
+        EXPECT_EQ(records[i].boundGap, readRecords[i].boundGap);
+        EXPECT_EQ(records[i].changedChoices, readRecords[i].changedChoices);
+        EXPECT_EQ(records[i].sweepTimeInNanoseconds, readRecords[i].sweepTimeInNanoseconds);
+    }
+}
+
+}  // namespace
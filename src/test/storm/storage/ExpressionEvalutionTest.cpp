@@ -1,6 +1,8 @@
 #include "adapters/RationalNumberAdapter.h"
 #include "storage/expressions/OperatorType.h"
 #include "storm-parsers/parser/ExpressionCreator.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/expressions/BatchExpressionEvaluator.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
@@ -93,3 +95,46 @@ TEST(ExpressionEvaluation, NegativeModulo) {
     EXPECT_NEAR(result3, expectedDouble, 1e-6);
     EXPECT_NEAR(result4, expectedDouble, 1e-6);
 }
+
+TEST(ExpressionEvaluation, BatchEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::expressions::Variable z;
+    storm::expressions::Variable w;
+    ASSERT_NO_THROW(x = manager->declareBooleanVariable("x"));
+    ASSERT_NO_THROW(y = manager->declareIntegerVariable("y"));
+    ASSERT_NO_THROW(z = manager->declareRationalVariable("z"));
+    ASSERT_NO_THROW(w = manager->declareIntegerVariable("w"));
+
+    storm::expressions::Expression iteExpression = storm::expressions::ite(x, y + z, manager->integer(3) * z);
+    storm::expressions::Expression modExpression = storm::expressions::modulo(y, manager->integer(7)) - storm::expressions::maximum(y, manager->integer(5));
+    storm::expressions::Expression boolExpression = (y > manager->integer(10) && !x) || storm::expressions::xclusiveor(x, y == manager->integer(4));
+
+    // The batch is larger than a single chunk.
+    uint64_t const batchSize = 2500;
+    storm::expressions::BatchExpressionEvaluator batchEval(*manager, batchSize);
+    storm::expressions::ExprtkExpressionEvaluator eval(*manager);
+    for (uint64_t i = 0; i < batchSize; ++i) {
+        batchEval.setBooleanValue(x, i, i % 3 == 0);
+        batchEval.setIntegerValue(y, i, static_cast<int_fast64_t>(i % 20) - 3);
+        batchEval.setRationalValue(z, i, i / static_cast<double>(10));
+    }
+
+    EXPECT_TRUE(batchEval.canEvaluate(iteExpression));
+    EXPECT_FALSE(batchEval.canEvaluate(y + w));
+    STORM_SILENT_EXPECT_THROW(batchEval.asInt(y + w), storm::exceptions::InvalidArgumentException);
+
+    std::vector<double> iteResult = batchEval.asRational(iteExpression);
+    std::vector<int_fast64_t> modResult = batchEval.asInt(modExpression);
+    storm::storage::BitVector boolResult = batchEval.asBool(boolExpression);
+    for (uint64_t i = 0; i < batchSize; ++i) {
+        eval.setBooleanValue(x, i % 3 == 0);
+        eval.setIntegerValue(y, static_cast<int_fast64_t>(i % 20) - 3);
+        eval.setRationalValue(z, i / static_cast<double>(10));
+        EXPECT_NEAR(eval.asRational(iteExpression), iteResult[i], 1e-6);
+        EXPECT_EQ(eval.asInt(modExpression), modResult[i]);
+        EXPECT_EQ(eval.asBool(boolExpression), boolResult.get(i));
+    }
+}
@@ -1,16 +1,20 @@
 #include <map>
 #include <string>
+#include <thread>
 
 #include "storm-parsers/parser/ValueParser.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/exceptions/UnexpectedException.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionUniqueTable.h"
 #include "storm/storage/expressions/LinearityCheckVisitor.h"
 #include "storm/storage/expressions/RationalFunctionToExpression.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/expressions/ToRationalFunctionVisitor.h"
+#include "storm/storage/jani/expressions/JaniExpressions.h"
 #include "test/storm_gtest.h"
 
 TEST(Expression, FactoryMethodTest) {
@@ -343,6 +347,116 @@ TEST(Expression, SimplificationTest) {
     EXPECT_TRUE(simplifiedExpression.isFalse());
 }
 
+TEST(Expression, HashConsingTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    EXPECT_FALSE(manager->isHashConsingEnabled());
+    manager->setHashConsing(true);
+    EXPECT_TRUE(manager->isHashConsingEnabled());
+
+    storm::expressions::Expression intVarExpression = manager->declareIntegerVariable("y");
+    storm::expressions::Expression boolVarExpression = manager->declareBooleanVariable("x");
+    storm::expressions::Variable constant = manager->declareIntegerVariable("c");
+
+    storm::expressions::Expression first = (intVarExpression + manager->integer(3) < manager->rational(4.5)) && boolVarExpression;
+    storm::expressions::Expression second = (intVarExpression + manager->integer(3) < manager->rational(4.5)) && boolVarExpression;
+    storm::expressions::Expression third = (intVarExpression + manager->integer(4) < manager->rational(4.5)) && boolVarExpression;
+    EXPECT_FALSE(first.areSame(second));
+
+    storm::expressions::Expression internedFirst = manager->intern(first);
+    storm::expressions::Expression internedSecond = manager->intern(second);
+    EXPECT_TRUE(internedFirst.areSame(internedSecond));
+    EXPECT_TRUE(internedFirst.areSame(manager->intern(internedFirst)));
+    EXPECT_FALSE(internedFirst.areSame(manager->intern(third)));
+    EXPECT_TRUE(first.isSyntacticallyEqual(second));
+    EXPECT_FALSE(first.isSyntacticallyEqual(third));
+
+    // Subexpressions are shared as well.
+    EXPECT_TRUE(manager->intern(intVarExpression + manager->integer(3)).areSame(internedFirst.getOperand(0).getOperand(0)));
+
+    // Results of substitutions are interned.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution = {std::make_pair(constant, manager->integer(3))};
+    storm::expressions::Expression substitutedExpression =
+        ((intVarExpression + constant.getExpression() < manager->rational(4.5)) && boolVarExpression).substitute(substitution);
+    EXPECT_TRUE(substitutedExpression.areSame(internedFirst));
+
+    // Simplifications are memoized.
+    storm::expressions::Expression simplifiedExpression = (intVarExpression + manager->integer(1) * manager->integer(3) > manager->integer(4)).simplify();
+    EXPECT_TRUE(simplifiedExpression.areSame(manager->intern(intVarExpression + manager->integer(3) > manager->integer(4))));
+    EXPECT_TRUE(simplifiedExpression.areSame((intVarExpression + manager->integer(1) * manager->integer(3) > manager->integer(4)).simplify()));
+
+    manager->setHashConsing(false);
+    EXPECT_FALSE(manager->isHashConsingEnabled());
+    EXPECT_TRUE(first.isSyntacticallyEqual(second));
+    EXPECT_FALSE(first.substitute(substitution).areSame(second.substitute(substitution)));
+}
+
+TEST(Expression, HashConsingUninternableTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    manager->setHashConsing(true);
+    storm::expressions::Expression intVarExpression = manager->declareIntegerVariable("y");
+
+    // Array expressions are not interned, so structurally equal expressions that contain them have different representatives.
+    auto createArray = [&]() {
+        return std::make_shared<storm::expressions::ValueArrayExpression>(
+            *manager, manager->getArrayType(manager->getIntegerType()),
+            std::vector<std::shared_ptr<storm::expressions::BaseExpression const>>{intVarExpression.getBaseExpressionPointer(),
+                                                                                   manager->integer(1).getBaseExpressionPointer()});
+    };
+    auto createAccess = [&]() {
+        storm::expressions::Expression access(std::make_shared<storm::expressions::ArrayAccessExpression>(
+            *manager, manager->getIntegerType(), createArray(), manager->integer(0).getBaseExpressionPointer()));
+        return access + manager->integer(1) > manager->integer(2);
+    };
+    storm::expressions::Expression first = createAccess();
+    storm::expressions::Expression second = createAccess();
+
+    bool complete = true;
+    auto internedFirst = manager->getUniqueTable()->intern(first.getBaseExpressionPointer(), &complete);
+    EXPECT_FALSE(complete);
+    EXPECT_NE(internedFirst.get(), manager->getUniqueTable()->intern(second.getBaseExpressionPointer()).get());
+    manager->getUniqueTable()->intern((intVarExpression + manager->integer(1)).getBaseExpressionPointer(), &complete);
+    EXPECT_TRUE(complete);
+
+    // Instead of reporting the expressions as different, the equality check falls back to the visitor (which does not support arrays).
+    storm::expressions::Expression firstArray(createArray());
+    storm::expressions::Expression secondArray(createArray());
+    STORM_SILENT_EXPECT_THROW(firstArray.isSyntacticallyEqual(secondArray), storm::exceptions::UnexpectedException);
+}
+
+TEST(Expression, HashConsingConcurrencyTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    manager->setHashConsing(true);
+    std::vector<storm::expressions::Expression> variables;
+    for (uint64_t index = 0; index < 10; ++index) {
+        variables.push_back(manager->declareIntegerVariable("x" + std::to_string(index)));
+    }
+
+    // All threads build the same expressions independently and intern them.
+    uint64_t const numberOfThreads = 8;
+    uint64_t const numberOfExpressions = 500;
+    std::vector<std::vector<storm::expressions::Expression>> results(numberOfThreads);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (uint64_t index = 0; index < numberOfExpressions; ++index) {
+                storm::expressions::Expression expression = variables[index % variables.size()] + manager->integer(index % 7);
+                expression = expression * variables[(index / 10) % variables.size()] - manager->rational(0.5);
+                results[thread].push_back(manager->intern(expression > manager->integer(index % 3)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (uint64_t index = 0; index < numberOfExpressions; ++index) {
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_TRUE(results[0][index].areSame(results[thread][index]));
+        }
+        EXPECT_TRUE(results[0][index].getOperand(0).getOperand(1).areSame(manager->intern(manager->rational(0.5))));
+    }
+}
+
 TEST(Expression, SimpleEvaluationTest) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
@@ -6,6 +6,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "test/storm_gtest.h"
 
@@ -179,3 +180,39 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, RepeatedRefinement) {
+    // The SCC {0,1,2,3} loses choices in two rounds before the MEC {0,1,2} remains.
+    storm::storage::SparseMatrixBuilder<double> builder(7, 5, 9, true, true, 5);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 1.0);
+    builder.newRowGroup(1);
+    builder.addNextValue(1, 2, 1.0);
+    builder.addNextValue(2, 0, 0.5);
+    builder.addNextValue(2, 3, 0.5);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, 1.0);
+    builder.addNextValue(4, 3, 1.0);
+    builder.newRowGroup(5);
+    builder.addNextValue(5, 0, 0.5);
+    builder.addNextValue(5, 4, 0.5);
+    builder.newRowGroup(6);
+    builder.addNextValue(6, 4, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(matrix, backwardTransitions);
+    ASSERT_EQ(2ull, mecDecomposition.size());
+    ASSERT_TRUE(mecDecomposition[0].getStateSet() == storm::storage::MaximalEndComponent::set_type{4});
+    EXPECT_TRUE(mecDecomposition[0].getChoicesForState(4) == storm::storage::MaximalEndComponent::set_type{6});
+    ASSERT_TRUE((mecDecomposition[1].getStateSet() == storm::storage::MaximalEndComponent::set_type{0, 1, 2}));
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0});
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{1});
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(2) == storm::storage::MaximalEndComponent::set_type{3});
+
+    // Without state 2, no EC remains among the states 0, 1 and 3.
+    storm::storage::BitVector subsystem(5, {0, 1, 3, 4});
+    mecDecomposition = storm::storage::MaximalEndComponentDecomposition<double>(matrix, backwardTransitions, subsystem);
+    ASSERT_EQ(1ull, mecDecomposition.size());
+    EXPECT_TRUE(mecDecomposition[0].getStateSet() == storm::storage::MaximalEndComponent::set_type{4});
+}
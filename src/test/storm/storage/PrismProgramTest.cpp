@@ -1,4 +1,7 @@
 #include "storm-config.h"
+
+#include <sstream>
+
 #include "storm-parsers/parser/PrismParser.h"
 #include "test/storm_gtest.h"
 
@@ -6,6 +9,10 @@
 #include "storm/storage/jani/Model.h"
 #include "storm/utility/solver.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/task_arena.h"
+#endif
+
 #ifdef STORM_HAVE_MSAT
 TEST(PrismProgramTest, FlattenModules) {
     storm::prism::Program program;
@@ -185,4 +192,80 @@ TEST(PrismProgramTest, ReplaceConstantByVariable) {
                         origPrismProgram.getConstant("CrowdSize"), origPrismProgram.getManager().integer(0), origPrismProgram.getManager().integer(20), true));
     EXPECT_NO_THROW(transformedPrismProgram.getGlobalIntegerVariable("CrowdSize"));
     EXPECT_FALSE(transformedPrismProgram.hasConstant("CrowdSize"));
-}
\ No newline at end of file
+}
+
+namespace {
+std::string createProgramWithManyModules(uint64_t numberOfModules, uint64_t maxValue) {
+    std::stringstream stream;
+    stream << "mdp\n\nconst int N = " << maxValue << ";\nconst double p = 0.3;\nformula step = N - 1;\n";
+    for (uint64_t module = 0; module < numberOfModules; ++module) {
+        std::string x = "x" + std::to_string(module);
+        stream << "\nmodule m" << module << "\n    " << x << " : [0..N] init 0;\n";
+        for (uint64_t value = 0; value <= maxValue; ++value) {
+            stream << "    [] " << x << " = " << value << " & " << x << " <= step -> p : (" << x << "'=min(" << x << " + 1, N)) + 1 - p : (" << x
+                   << "'=max(" << x << " - " << (value % 3) << ", 0));\n";
+        }
+        stream << "endmodule\n";
+    }
+    return stream.str();
+}
+
+template<typename FunctionType>
+auto runSingleThreaded(FunctionType const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    tbb::task_arena arena(1);
+    return arena.execute(function);
+#else
+    return function();
+#endif
+}
+}  // namespace
+
+TEST(PrismProgramTest, SubstituteConstantsFormulasConcurrently) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(createProgramWithManyModules(8, 31), "PrismProgramTest");
+    ASSERT_EQ(8ull, program.getNumberOfModules());
+
+    storm::prism::Program sequentialProgram = runSingleThreaded([&program]() { return program.substituteConstantsFormulas(); });
+    storm::prism::Program concurrentProgram = program.substituteConstantsFormulas();
+
+    std::stringstream sequentialStream, concurrentStream;
+    sequentialStream << sequentialProgram;
+    concurrentStream << concurrentProgram;
+    EXPECT_EQ(sequentialStream.str(), concurrentStream.str());
+
+    std::set<storm::expressions::Variable> constants = {program.getManager().getVariable("N"), program.getManager().getVariable("p")};
+    for (auto const& module : concurrentProgram.getModules()) {
+        ASSERT_EQ(32ull, module.getNumberOfCommands());
+        for (auto const& command : module.getCommands()) {
+            EXPECT_FALSE(command.getGuardExpression().containsVariable(constants)) << "Constants remain in " << command << ".";
+            for (auto const& update : command.getUpdates()) {
+                EXPECT_FALSE(update.getLikelihoodExpression().containsVariable(constants)) << "Constants remain in " << command << ".";
+            }
+        }
+    }
+}
+
+TEST(PrismProgramTest, SubstituteJaniConstantsConcurrently) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(createProgramWithManyModules(8, 31), "PrismProgramTest");
+    storm::jani::Model janiModel = program.toJani();
+    ASSERT_EQ(8ull, janiModel.getNumberOfAutomata());
+
+    storm::jani::Model sequentialModel = runSingleThreaded([&janiModel]() { return janiModel.substituteConstantsFunctions(); });
+    storm::jani::Model concurrentModel = janiModel.substituteConstantsFunctions();
+
+    std::stringstream sequentialStream, concurrentStream;
+    sequentialStream << sequentialModel;
+    concurrentStream << concurrentModel;
+    EXPECT_EQ(sequentialStream.str(), concurrentStream.str());
+
+    std::set<storm::expressions::Variable> constants = {janiModel.getManager().getVariable("N"), janiModel.getManager().getVariable("p")};
+    for (auto const& automaton : concurrentModel.getAutomata()) {
+        ASSERT_EQ(32ull, automaton.getNumberOfEdges());
+        for (auto const& edge : automaton.getEdges()) {
+            EXPECT_FALSE(edge.getGuard().containsVariable(constants));
+            for (auto const& destination : edge.getDestinations()) {
+                EXPECT_FALSE(destination.getProbability().containsVariable(constants));
+            }
+        }
+    }
+}
@@ -0,0 +1,148 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <functional>
+#include <sstream>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/transformer/SymbolicToSparseTransformer.h"
+#include "storm/utility/vector.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/task_arena.h"
+#endif
+
+namespace {
+
+/*!
+ * Creates a model with 2^15 reachable states, which is large enough for the DDs to be translated concurrently.
+ * For MDPs, there is an additional nondeterministic choice in half of the states.
+ */
+storm::prism::Program createLargeGridProgram(bool nondeterministic) {
+    std::stringstream stream;
+    stream << (nondeterministic ? "mdp" : "dtmc") << "\n\n";
+    stream << "module grid\n";
+    stream << "    x : [0..255] init 0;\n";
+    stream << "    y : [0..127] init 0;\n";
+    stream << "    [] true -> 0.5 : (x'=mod(x+1,256)) + 0.25 : (y'=mod(y+1,128)) + 0.25 : (x'=mod(3*x+y,256)) & (y'=mod(x+y,128));\n";
+    if (nondeterministic) {
+        stream << "    [] x<128 -> (x'=mod(x+y,256));\n";
+    }
+    stream << "endmodule\n\n";
+    stream << "label \"diagonal\" = x=y;\n";
+    stream << "label \"odd\" = mod(x,2)=1;\n";
+    return storm::parser::PrismParser::parseFromString(stream.str(), "grid");
+}
+
+template<storm::dd::DdType DdType>
+std::shared_ptr<storm::models::symbolic::Model<DdType, double>> buildLargeGridModel(bool nondeterministic) {
+    // Build the full model such that all labels are included.
+    return storm::api::buildSymbolicModel<DdType, double>(createLargeGridProgram(nondeterministic), std::vector<std::shared_ptr<storm::logic::Formula const>>(),
+                                                          true);
+}
+
+template<typename ResultType>
+ResultType runSingleThreaded(std::function<ResultType()> const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    ResultType result;
+    tbb::task_arena arena(1);
+    arena.execute([&]() { result = function(); });
+    return result;
+#else
+    return function();
+#endif
+}
+
+template<storm::dd::DdType DdType>
+void checkLargeDtmcTranslation() {
+    auto symbolicModel = buildLargeGridModel<DdType>(false)->template as<storm::models::symbolic::Dtmc<DdType, double>>();
+    ASSERT_EQ(32768ul, symbolicModel->getNumberOfStates());
+
+    storm::transformer::SymbolicDtmcToSparseDtmcTransformer<DdType, double> transformer;
+    auto model = transformer.translate(*symbolicModel);
+    auto sequentialModel = runSingleThreaded<std::shared_ptr<storm::models::sparse::Dtmc<double>>>(
+        [&]() { return storm::transformer::SymbolicDtmcToSparseDtmcTransformer<DdType, double>().translate(*symbolicModel); });
+    EXPECT_EQ(sequentialModel->getTransitionMatrix(), model->getTransitionMatrix());
+    EXPECT_EQ(sequentialModel->getStateLabeling(), model->getStateLabeling());
+
+    // Compare the matrix with a matrix-vector multiplication that is carried out on the DDs.
+    storm::dd::Odd const& odd = transformer.getOdd();
+    std::vector<double> values(model->getNumberOfStates());
+    for (uint64_t state = 0; state < values.size(); ++state) {
+        values[state] = static_cast<double>(state % 7 + 1);
+    }
+    auto valuesAdd = storm::dd::Add<DdType, double>::fromVector(symbolicModel->getManager(), values, odd, symbolicModel->getRowVariables());
+    std::vector<double> expected = (symbolicModel->getTransitionMatrix() * valuesAdd.swapVariables(symbolicModel->getRowColumnMetaVariablePairs()))
+                                       .sumAbstract(symbolicModel->getColumnVariables())
+                                       .toVector(odd);
+    std::vector<double> actual(model->getNumberOfStates());
+    model->getTransitionMatrix().multiplyWithVector(values, actual);
+    EXPECT_EQ(expected, actual);
+
+    for (std::string const& label : {"diagonal", "odd"}) {
+        EXPECT_EQ(symbolicModel->getStates(label).toVector(odd), model->getStates(label)) << "for label " << label;
+    }
+}
+
+template<storm::dd::DdType DdType>
+void checkLargeMdpTranslation() {
+    auto symbolicModel = buildLargeGridModel<DdType>(true)->template as<storm::models::symbolic::Mdp<DdType, double>>();
+    ASSERT_EQ(32768ul, symbolicModel->getNumberOfStates());
+
+    auto model = storm::transformer::SymbolicMdpToSparseMdpTransformer<DdType, double>::translate(*symbolicModel);
+    auto sequentialModel = runSingleThreaded<std::shared_ptr<storm::models::sparse::Mdp<double>>>(
+        [&]() { return storm::transformer::SymbolicMdpToSparseMdpTransformer<DdType, double>::translate(*symbolicModel); });
+    EXPECT_EQ(sequentialModel->getTransitionMatrix(), model->getTransitionMatrix());
+    EXPECT_EQ(sequentialModel->getStateLabeling(), model->getStateLabeling());
+    EXPECT_EQ(32768ul + 16384ul, model->getNumberOfChoices());
+
+    // The order of the choices within a row group is not fixed, so compare the maximal values over the choices.
+    storm::dd::Odd odd = symbolicModel->getReachableStates().createOdd();
+    std::vector<double> values(model->getNumberOfStates());
+    for (uint64_t state = 0; state < values.size(); ++state) {
+        values[state] = static_cast<double>(state % 7 + 1);
+    }
+    auto valuesAdd = storm::dd::Add<DdType, double>::fromVector(symbolicModel->getManager(), values, odd, symbolicModel->getRowVariables());
+    std::vector<double> expected = (symbolicModel->getTransitionMatrix() * valuesAdd.swapVariables(symbolicModel->getRowColumnMetaVariablePairs()))
+                                       .sumAbstract(symbolicModel->getColumnVariables())
+                                       .maxAbstract(symbolicModel->getNondeterminismVariables())
+                                       .toVector(odd);
+    std::vector<double> choiceValues(model->getNumberOfChoices());
+    model->getTransitionMatrix().multiplyWithVector(values, choiceValues);
+    std::vector<double> actual(model->getNumberOfStates());
+    storm::utility::vector::reduceVectorMax(choiceValues, actual, model->getTransitionMatrix().getRowGroupIndices());
+    EXPECT_EQ(expected, actual);
+
+    for (std::string const& label : {"diagonal", "odd"}) {
+        EXPECT_EQ(symbolicModel->getStates(label).toVector(odd), model->getStates(label)) << "for label " << label;
+    }
+}
+
+TEST(SymbolicToSparseTransformerTest, LargeDtmcConcurrently_Cudd) {
+    checkLargeDtmcTranslation<storm::dd::DdType::CUDD>();
+}
+
+TEST(SymbolicToSparseTransformerTest, LargeDtmcConcurrently_Sylvan) {
+    checkLargeDtmcTranslation<storm::dd::DdType::Sylvan>();
+}
+
+TEST(SymbolicToSparseTransformerTest, LargeMdpConcurrently_Cudd) {
+    checkLargeMdpTranslation<storm::dd::DdType::CUDD>();
+}
+
+TEST(SymbolicToSparseTransformerTest, LargeMdpConcurrently_Sylvan) {
+    checkLargeMdpTranslation<storm::dd::DdType::Sylvan>();
+}
+
+}  // namespace
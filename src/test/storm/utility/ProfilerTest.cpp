@@ -0,0 +1,106 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/Profiler.h"
+
+namespace {
+
+TEST(ProfilerTest, Nesting) {
+    auto& profiler = storm::utility::Profiler::getInstance();
+    profiler.enable();
+    {
+        storm::utility::ProfilingScope outer("outer");
+        {
+            storm::utility::ProfilingScope inner("inner");
+            profiler.addToCounter("iterations", 3);
+        }
+        profiler.addToCounter("iterations");
+        // Phases of other threads are not recorded, but counters are attributed to the current phase.
+        std::thread worker([&profiler]() {
+            storm::utility::ProfilingScope ignored("worker");
+            profiler.addToCounter("iterations");
+        });
+        worker.join();
+    }
+    {
+        // Entering a phase again accumulates the measurements.
+        storm::utility::ProfilingScope outer("outer");
+        storm::utility::ProfilingScope inner("inner");
+    }
+    profiler.disable();
+
+    auto result = profiler.toJson();
+    EXPECT_EQ("total", result["name"].get<std::string>());
+    ASSERT_EQ(1ull, result["phases"].size());
+    auto const& outer = result["phases"][0];
+    EXPECT_EQ("outer", outer["name"].get<std::string>());
+    EXPECT_EQ(2ull, outer["count"].get<uint64_t>());
+    EXPECT_EQ(2ull, outer["counters"]["iterations"].get<uint64_t>());
+    EXPECT_TRUE(outer.contains("rss-entry"));
+    EXPECT_TRUE(outer.contains("rss-exit"));
+    EXPECT_TRUE(outer.contains("rss-max-increase"));
+    ASSERT_EQ(1ull, outer["phases"].size());
+    auto const& inner = outer["phases"][0];
+    EXPECT_EQ("inner", inner["name"].get<std::string>());
+    EXPECT_EQ(2ull, inner["count"].get<uint64_t>());
+    EXPECT_EQ(3ull, inner["counters"]["iterations"].get<uint64_t>());
+    EXPECT_FALSE(inner.contains("phases"));
+    EXPECT_GE(outer["time"].get<double>(), inner["time"].get<double>());
+}
+
+TEST(ProfilerTest, PeakWithinPhase) {
+    auto& profiler = storm::utility::Profiler::getInstance();
+    profiler.enable();
+    uint64_t const allocationSize = 64 * 1024 * 1024;
+    {
+        storm::utility::ProfilingScope phase("allocate");
+        // Touch all pages of the allocation such that they become resident. The memory is released before the phase is left.
+        std::vector<char> memory(allocationSize, 1);
+        EXPECT_EQ(1, memory.back());
+    }
+    profiler.disable();
+
+    auto const& phase = profiler.toJson()["phases"][0];
+    ASSERT_TRUE(phase.contains("rss-peak"));
+    EXPECT_GE(phase["rss-peak"].get<uint64_t>(), phase["rss-exit"].get<uint64_t>());
+#ifdef LINUX
+    // The peak within the phase is only reported reliably if the peak can be reset.
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    clearRefs.close();
+    if (clearRefs) {
+        EXPECT_GE(phase["rss-max-increase"].get<int64_t>(), static_cast<int64_t>(allocationSize / 2));
+    }
+#endif
+}
+
+TEST(ProfilerTest, JsonExport) {
+    auto& profiler = storm::utility::Profiler::getInstance();
+    profiler.enable();
+    {
+        storm::utility::ProfilingScope phase("phase");
+        profiler.addToCounter("counter", 42);
+    }
+    profiler.disable();
+
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_profiler_test.json").string();
+    profiler.exportToJson(filename);
+    std::ifstream stream(filename);
+    auto result = storm::json<double>::parse(stream);
+    stream.close();
+    std::filesystem::remove(filename);
+
+    EXPECT_TRUE(result.contains("process-peak-rss"));
+    ASSERT_EQ(1ull, result["phases"].size());
+    EXPECT_EQ("phase", result["phases"][0]["name"].get<std::string>());
+    EXPECT_EQ(42ull, result["phases"][0]["counters"]["counter"].get<uint64_t>());
+}
+
+}  // namespace